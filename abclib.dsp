@@ -1279,6 +1279,10 @@ SOURCE=.\src\bdd\llb\llb2Image.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\bdd\llb\llb2Pth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\bdd\llb\llb3Image.c
 # End Source File
 # Begin Source File
@@ -1967,6 +1971,10 @@ SOURCE=.\src\sat\cnf\cnfPost.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\cnf\cnfPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\cnf\cnfUtil.c
 # End Source File
 # Begin Source File
@@ -2179,6 +2187,10 @@ SOURCE=.\src\sat\satoko\solver_api.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\satoko\solver_par.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\satoko\utils\sort.h
 # End Source File
 # Begin Source File
@@ -2847,6 +2859,10 @@ SOURCE=.\src\opt\dar\darPrec.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dar\darPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dar\darRefact.c
 # End Source File
 # Begin Source File
@@ -2967,6 +2983,10 @@ SOURCE=.\src\opt\dau\dauCanon.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dau\dauCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dau\dauCore.c
 # End Source File
 # Begin Source File
@@ -3055,6 +3075,10 @@ SOURCE=.\src\opt\sfm\sfmNtk.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\sfm\sfmPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\sfm\sfmSat.c
 # End Source File
 # Begin Source File
@@ -3411,6 +3435,10 @@ SOURCE=.\src\map\if\ifMatch2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\if\ifPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\if\ifReduce.c
 # End Source File
 # Begin Source File
@@ -3995,6 +4023,14 @@ SOURCE=.\src\misc\util\utilNam.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilProf.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilProf.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSignal.c
 # End Source File
 # Begin Source File
@@ -4795,6 +4831,10 @@ SOURCE=.\src\aig\gia\giaCut.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaCutDb.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaDfs.c
 # End Source File
 # Begin Source File
@@ -5027,6 +5067,14 @@ SOURCE=.\src\aig\gia\giaSim2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\aig\gia\giaSoa.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSort.c
 # End Source File
 # Begin Source File
@@ -5731,6 +5779,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -5815,6 +5867,10 @@ SOURCE=.\src\proof\ssw\sswPart.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\ssw\sswPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\ssw\sswRarity.c
 # End Source File
 # Begin Source File
@@ -1156,11 +1156,22 @@ void Aig_ManRandomTest1()
 #define NUMBER1  3716960521u
 #define NUMBER2  2174103536u
 
+// the generator state is thread-local, so that the engines running 
+// in several threads (such as partitioned signal correspondence) 
+// do not share it and produce the same results as in one thread
+#if defined(_MSC_VER)
+#define AIG_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define AIG_THREAD_LOCAL __thread
+#else
+#define AIG_THREAD_LOCAL
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Creates a sequence of random numbers.]
 
-  Description []
+  Description [Each thread has its own sequence.]
                
   SideEffects []
 
@@ -1169,8 +1180,8 @@ void Aig_ManRandomTest1()
 ***********************************************************************/
 unsigned Aig_ManRandom( int fReset )
 {
-    static unsigned int m_z = NUMBER1;
-    static unsigned int m_w = NUMBER2;
+    static AIG_THREAD_LOCAL unsigned int m_z = NUMBER1;
+    static AIG_THREAD_LOCAL unsigned int m_w = NUMBER2;
     if ( fReset )
     {
         m_z = NUMBER1;
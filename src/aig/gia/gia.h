@@ -52,6 +52,16 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Gia_MmFixed_t_        Gia_MmFixed_t;    
 typedef struct Gia_MmFlex_t_         Gia_MmFlex_t;     
 typedef struct Gia_MmStep_t_         Gia_MmStep_t;     
+typedef struct Gia_HashTab_t_        Gia_HashTab_t;    
+typedef struct Gia_CutDb_t_          Gia_CutDb_t;      
+
+// compression of AIGER files
+typedef enum { 
+    GIA_AIGER_RAW = 0,         // 0: uncompressed
+    GIA_AIGER_GZ,              // 1: gzip
+    GIA_AIGER_BZ2,             // 2: bzip2
+    GIA_AIGER_ZST              // 3: zstd
+} Gia_AigerZip_t;
 
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
@@ -103,6 +113,7 @@ struct Gia_Man_t_
     int            nObjsAlloc;    // number of allocated objects
     Gia_Obj_t *    pObjs;         // the array of objects
     unsigned *     pMuxes;        // control signals of MUXes
+    Vec_Int_t *    vFanLits;      // fanin literals of the AND nodes (structure-of-arrays mode)
     int            nXors;         // the number of XORs
     int            nMuxes;        // the number of MUXes 
     int            nBufs;         // the number of buffers
@@ -110,6 +121,7 @@ struct Gia_Man_t_
     Vec_Int_t *    vCos;          // the vector of COs (POs + LIs)
     Vec_Int_t      vHash;         // hash links
     Vec_Int_t      vHTable;       // hash table
+    Gia_HashTab_t * pHashTab;     // open-addressing hash table (used instead of vHTable when present)
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
@@ -132,6 +144,7 @@ struct Gia_Man_t_
     int            nFansAlloc;    // the size of fanout representation
     Vec_Int_t *    vFanoutNums;   // static fanout
     Vec_Int_t *    vFanout;       // static fanout
+    Vec_Ptr_t *    vCutDbs;       // cut databases shared by the mappers
     Vec_Int_t *    vMapping;      // mapping for each node
     Vec_Wec_t *    vMapping2;     // mapping for each node
     Vec_Wec_t *    vFanouts2;     // mapping fanouts 
@@ -288,6 +301,7 @@ struct Gia_ParSim_t_
     int            RandSeed;      // seed to generate random numbers
     int            TimeLimit;     // time limit in seconds
     int            fCheckMiter;   // check if miter outputs are non-zero
+    int            nProcs;        // the number of threads
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
 };
@@ -304,6 +318,9 @@ struct Gia_ManSim_t_
     unsigned *     pDataSim;     // simulation data
     unsigned *     pDataSimCis;  // simulation data for CIs
     unsigned *     pDataSimCos;  // simulation data for COs
+    // multi-threaded simulation
+    int            nThreads;     // the number of threads
+    void *         pThData;      // the data of the threads
 };
 
 typedef struct Jf_Par_t_ Jf_Par_t; 
@@ -342,6 +359,7 @@ struct Jf_Par_t_
     int            fCutHashing;
     int            fCutSimple;
     int            fCutGroup;
+    int            fUseCutDb;
     int            fVerbose;
     int            fVeryVerbose;
     int            nLutSizeMax;
@@ -875,6 +893,12 @@ static inline void Gia_ManPatchCoDriver( Gia_Man_t * p, int iCoIndex, int iLit0
     pObjCo->iDiff0  = Gia_ObjId(p, pObjCo) - Abc_Lit2Var(iLit0);
     pObjCo->fCompl0 = Abc_LitIsCompl(iLit0);
 }
+// should be called after changing the fanins of an existing AND node in place
+static inline void Gia_ManSoaDrop( Gia_Man_t * p, int iObj )  
+{
+    if ( p->vFanLits && Vec_IntSize(p->vFanLits) > 2 * iObj )
+        Vec_IntShrink( p->vFanLits, 2 * iObj );
+}
 
 #define GIA_ZER 1
 #define GIA_ONE 2
@@ -1208,7 +1232,9 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
-extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern int                 Gia_AigerFileCompression( char * pFileName );
+extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromStream( char * pFileName, int Type, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
@@ -1251,6 +1277,13 @@ extern void                Gia_ManPrintFanio( Gia_Man_t * pGia, int nNodes );
 extern Gia_Man_t *         Gia_ManDupCof( Gia_Man_t * p, int iVar );
 extern Gia_Man_t *         Gia_ManDupCofAllInt( Gia_Man_t * p, Vec_Int_t * vSigs, int fVerbose );
 extern Gia_Man_t *         Gia_ManDupCofAll( Gia_Man_t * p, int nFanLim, int fVerbose );
+/*=== giaCutDb.c ==========================================================*/
+extern Gia_CutDb_t *       Gia_ManCutDbPrepare( Gia_Man_t * pGia, Gia_Man_t * p, int nLutSize, int nCutNum, int fTruth, int fVerbose );
+extern void                Gia_ManCutDbTransfer( Gia_Man_t * pOld, Gia_Man_t * pNew );
+extern void                Gia_ManCutDbStop( Gia_Man_t * p );
+extern int *               Gia_CutDbObjCuts( Gia_CutDb_t * p, int iObj, Vec_Mem_t * vTtMem );
+extern void                Gia_CutDbAddCutSet( Gia_CutDb_t * p, int iObj, int * pList, Vec_Mem_t * vTtMem );
+extern void                Gia_CutDbPrintStats( Gia_CutDb_t * p );
 /*=== giaDfs.c ============================================================*/
 extern void                Gia_ManCollectCis( Gia_Man_t * p, int * pNodes, int nNodes, Vec_Int_t * vSupp );
 extern void                Gia_ManCollectAnds_rec( Gia_Man_t * p, int iObj, Vec_Int_t * vNodes );
@@ -1373,6 +1406,7 @@ extern Gia_Man_t *         Gia_ManSpecReduceInitFrames( Gia_Man_t * p, Abc_Cex_t
 extern void                Gia_ManEquivTransform( Gia_Man_t * p, int fVerbose );
 extern void                Gia_ManEquivImprove( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManEquivToChoices( Gia_Man_t * p, int nSnapshots );
+extern Gia_Man_t *         Gia_ManEquivToSibls( Gia_Man_t * p );
 extern int                 Gia_ManCountChoiceNodes( Gia_Man_t * p );
 extern int                 Gia_ManCountChoices( Gia_Man_t * p );
 extern int                 Gia_ManFilterEquivsForSpeculation( Gia_Man_t * pGia, char * pName1, char * pName2, int fLatchA, int fLatchB );
@@ -1427,6 +1461,10 @@ extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashAndMulti2( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashDualMiter( Gia_Man_t * p, Vec_Int_t * vOuts );
+extern void                Gia_ManHashStartOpen( Gia_Man_t * p, int nObjsMax );
+extern int                 Gia_ManHashIsConcurrent( Gia_Man_t * p );
+extern void                Gia_ManHashAndBatch( Gia_Man_t * p, int * pFans, int nPairs, int * pRes );
+extern Gia_Man_t *         Gia_ManRehashPar( Gia_Man_t * p, int nProcs, int fVerbose );
 /*=== giaIf.c ===========================================================*/
 extern void                Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile );
 extern void                Gia_ManPrintPackingStats( Gia_Man_t * p );
@@ -1534,6 +1572,7 @@ extern int *               Gia_SortFloats( float * pArray, int * pPerm, int nSiz
 /*=== giaSim.c ============================================================*/
 extern void                Gia_ManSimSetDefaultParams( Gia_ParSim_t * p );
 extern int                 Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
+extern int                 Gia_ManSimBenchmark( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
 extern unsigned *          Gia_SimDataExt( Gia_ManSim_t * p, int i );
 extern unsigned *          Gia_SimDataCiExt( Gia_ManSim_t * p, int i );
 extern unsigned *          Gia_SimDataCoExt( Gia_ManSim_t * p, int i );
@@ -1551,6 +1590,22 @@ extern void                Gia_ManIncrSimStart( Gia_Man_t * p, int nWords, int n
 extern void                Gia_ManIncrSimSet( Gia_Man_t * p, Vec_Int_t * vObjLits );
 extern int                 Gia_ManIncrSimCheckOver( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, int iLit1 );
+/*=== giaSimd.c ============================================================*/
+extern int                 Gia_SimdLevelMax();
+extern int                 Gia_SimdLevel();
+extern int                 Gia_SimdSetLevel( int Level );
+extern char *              Gia_SimdLevelName( int Level );
+extern void                Gia_SimdAnd( word * pOut, word * p0, word * p1, int fCompl0, int fCompl1, int nWords );
+/*=== giaSoa.c ============================================================*/
+extern void                Gia_ManSoaSetDefault( int fEnable );
+extern int                 Gia_ManSoaIsDefault();
+extern void                Gia_ManSoaStart( Gia_Man_t * p );
+extern void                Gia_ManSoaStop( Gia_Man_t * p );
+extern int *               Gia_ManSoaFanins( Gia_Man_t * p );
+extern int                 Gia_ManSoaLevelNum( Gia_Man_t * p, int * pLits );
+extern void                Gia_ManSoaCreateRefs( Gia_Man_t * p, int * pLits );
+extern void                Gia_ManSoaCollectAnds_rec( Gia_Man_t * p, int * pLits, int iObj, Vec_Int_t * vNodes );
+extern void                Gia_ManSoaTest( Gia_Man_t * p, int nIters, int fVerbose );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
@@ -549,14 +549,14 @@ void Gia_ManReprFromAigRepr2( Aig_Man_t * pAig, Gia_Man_t * pGia )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose )
+Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int nThreads, int fVerbose )
 {
     Gia_Man_t * pGia;
     Aig_Man_t * pNew, * pTemp;
     if ( p->pManTime && p->vLevels == NULL )
         Gia_ManLevelWithBoxes( p );
     pNew = Gia_ManToAig( p, 0 );
-    pNew = Dar_ManCompress2( pTemp = pNew, 1, fUpdateLevel, 1, 0, fVerbose );
+    pNew = Dar_ManCompress2Par( pTemp = pNew, 1, fUpdateLevel, 1, 0, nThreads, fVerbose );
     Aig_ManStop( pTemp );
     pGia = Gia_ManFromAig( pNew );
     Aig_ManStop( pNew );
@@ -577,9 +577,18 @@ Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose )
 ***********************************************************************/
 Gia_Man_t * Gia_ManPerformDch( Gia_Man_t * p, void * pPars )
 {
+    extern Gia_Man_t * Cec_ComputeChoicesPar( Gia_Man_t * p, Dch_Pars_t * pPars );
+    Dch_Pars_t * pParsDch = (Dch_Pars_t *)pPars;
     int fUseMapping = 0;
     Gia_Man_t * pGia, * pGia1;
     Aig_Man_t * pNew;
+    // the multi-threaded engine does not support boxes and power-aware synthesis
+    if ( pParsDch->nThreads > 1 && !pParsDch->fPower && !p->pManTime && !Gia_ManBufNum(p) )
+    {
+        pGia = Cec_ComputeChoicesPar( p, pParsDch );
+        Gia_ManTransferTiming( pGia, p );
+        return pGia;
+    }
     if ( p->pManTime && p->vLevels == NULL )
         Gia_ManLevelWithBoxes( p );
     if ( fUseMapping && Gia_ManHasMapping(p) )
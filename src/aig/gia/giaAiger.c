@@ -22,15 +22,55 @@
 #include "gia.h"
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
+#include "misc/zlib/zlib.h"
+#include "misc/bzlib/bzlib.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
+#ifdef _WIN32
+#define vsnprintf _vsnprintf
+#endif
+
 #define XAIG_VERBOSE 0
+#define GIA_AIGER_BUFFER (1 << 20)  // the size of the output buffer
+#define GIA_AIGER_PAD    64         // the zero padding after the input buffer
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// streaming reader of a compressed AIGER file
+typedef struct Gia_AigRd_t_ Gia_AigRd_t;
+struct Gia_AigRd_t_
+{
+    FILE *          pFile;     // the file
+    gzFile          pGz;       // the gzip stream
+    BZFILE *        pBz;       // the bzip2 stream
+    int             fEof;      // the end of the stream is reached
+    unsigned char * pBuffer;   // the window with the uncompressed data
+    size_t          nBuffer;   // the size of the window
+    size_t          nData;     // the number of bytes in the window
+    unsigned char * pHead;     // the header and the CO drivers
+    size_t          nHead;     // the size of the header and the CO drivers
+};
+
+// streaming writer of a compressed AIGER file
+typedef struct Gia_AigWr_t_ Gia_AigWr_t;
+struct Gia_AigWr_t_
+{
+    FILE *          pFile;     // the file
+    gzFile          pGz;       // the gzip stream
+    BZFILE *        pBz;       // the bzip2 stream
+    int             fError;    // an error occurred
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -164,7 +204,221 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
 /**Function*************************************************************
 
-  Synopsis    [Reads the AIG in the binary AIGER format.]
+  Synopsis    [Maps the AIGER literal into the literal of the new AIG.]
+
+  Description [The map is not used when the AIG is read without structural
+  hashing because, in this case, object IDs are equal to AIGER variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_AigerMapLit( Vec_Int_t * vNodes, unsigned uLit )
+{
+    return vNodes ? Abc_LitNotCond( Vec_IntEntry(vNodes, uLit >> 1), (uLit & 1) ) : (int)uLit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Detects the compression of the file using its magic bytes.]
+
+  Description [Returns -1 if the file cannot be opened.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_AigerFileCompression( char * pFileName )
+{
+    unsigned char Magic[4] = {0};
+    FILE * pFile;
+    int nBytes;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return -1;
+    nBytes = fread( Magic, 1, 4, pFile );
+    fclose( pFile );
+    if ( nBytes >= 2 && Magic[0] == 0x1f && Magic[1] == 0x8b )
+        return GIA_AIGER_GZ;
+    if ( nBytes >= 3 && Magic[0] == 'B' && Magic[1] == 'Z' && Magic[2] == 'h' )
+        return GIA_AIGER_BZ2;
+    if ( nBytes == 4 && Magic[0] == 0x28 && Magic[1] == 0xB5 && Magic[2] == 0x2F && Magic[3] == 0xFD )
+        return GIA_AIGER_ZST;
+    return GIA_AIGER_RAW;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the streaming reader of a compressed file.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_AigRd_t * Gia_AigRdStart( char * pFileName, int Type )
+{
+    Gia_AigRd_t * p;
+    int bzError = BZ_OK;
+    p = ABC_CALLOC( Gia_AigRd_t, 1 );
+    if ( Type == GIA_AIGER_GZ )
+        p->pGz = gzopen( pFileName, "rb" );
+    else if ( Type == GIA_AIGER_BZ2 && (p->pFile = fopen( pFileName, "rb" )) )
+    {
+        p->pBz = BZ2_bzReadOpen( &bzError, p->pFile, 0, 0, NULL, 0 );
+        if ( bzError != BZ_OK )
+        {
+            BZ2_bzReadClose( &bzError, p->pBz );
+            p->pBz = NULL;
+        }
+    }
+    if ( p->pGz == NULL && p->pBz == NULL )
+    {
+        if ( p->pFile )
+            fclose( p->pFile );
+        ABC_FREE( p );
+        return NULL;
+    }
+    p->nBuffer = GIA_AIGER_BUFFER;
+    p->pBuffer = ABC_CALLOC( unsigned char, p->nBuffer + GIA_AIGER_PAD );
+    return p;
+}
+static void Gia_AigRdStop( Gia_AigRd_t * p )
+{
+    int bzError;
+    if ( p->pGz )
+        gzclose( p->pGz );
+    if ( p->pBz )
+        BZ2_bzReadClose( &bzError, p->pBz );
+    if ( p->pFile )
+        fclose( p->pFile );
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p->pHead );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decompresses the next chunk into the free part of the window.]
+
+  Description [Returns the number of bytes added. The data in the window
+  is always followed by zero padding, which makes it safe to decode
+  a few bytes past the end of a truncated stream.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_AigRdReadMore( Gia_AigRd_t * p )
+{
+    int nBytes, nFree, bzError = BZ_OK;
+    if ( p->fEof || p->nData == p->nBuffer )
+        return 0;
+    // the decompressors take the size as an int
+    nFree = (int)Abc_MinWord( (word)(p->nBuffer - p->nData), (word)(1 << 30) );
+    if ( p->pGz )
+        nBytes = gzread( p->pGz, p->pBuffer + p->nData, (unsigned)nFree );
+    else
+        nBytes = BZ2_bzRead( &bzError, p->pBz, p->pBuffer + p->nData, nFree );
+    if ( nBytes < 0 || (bzError != BZ_OK && bzError != BZ_STREAM_END) )
+    {
+        printf( "Gia_AigRdReadMore(): Decompression has failed.\n" );
+        nBytes = 0;
+    }
+    if ( nBytes == 0 || bzError != BZ_OK )
+        p->fEof = 1;
+    p->nData += (size_t)nBytes;
+    memset( p->pBuffer + p->nData, 0, GIA_AIGER_PAD );
+    return nBytes;
+}
+static int Gia_AigRdFill( Gia_AigRd_t * p )
+{
+    if ( p->nData == p->nBuffer )
+    {
+        p->pBuffer = ABC_REALLOC( unsigned char, p->pBuffer, 2 * p->nBuffer + GIA_AIGER_PAD );
+        p->nBuffer *= 2;
+    }
+    return Gia_AigRdReadMore( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the unread data to the beginning of the window and refills it.]
+
+  Description [Returns the new position of the unread data.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned char * Gia_AigRdRefill( Gia_AigRd_t * p, unsigned char * pCur )
+{
+    size_t nLeft = pCur < p->pBuffer + p->nData ? (size_t)(p->pBuffer + p->nData - pCur) : 0;
+    memmove( p->pBuffer, pCur, nLeft );
+    p->nData = nLeft;
+    while ( Gia_AigRdReadMore( p ) );
+    memset( p->pBuffer + p->nData, 0, GIA_AIGER_PAD );
+    return p->pBuffer;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the header and the CO drivers into a separate buffer.]
+
+  Description [The CO drivers precede the AND gates but are used after
+  the AND gates are created, so they are kept until the end of reading.
+  The window is left holding the beginning of the AND gates.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_AigRdLoadHead( Gia_AigRd_t * p )
+{
+    size_t k;
+    int i, iField = 0, nCos = 0, fAscii;
+    // find the end of the parameter line
+    for ( k = 0; ; k++ )
+    {
+        if ( k == p->nData && !Gia_AigRdFill(p) )
+            return 0;
+        if ( p->pBuffer[k] == '\n' )
+            break;
+    }
+    if ( k < 4 || strncmp( (char *)p->pBuffer, "aig", 3 ) )
+        return 0;
+    // count the COs using the parameters (M I L O A + B C J F)
+    for ( i = 3; i < (int)k; i++ )
+        if ( p->pBuffer[i] == ' ' && ++iField != 1 && iField != 2 && iField != 5 )
+            nCos += atoi( (char *)p->pBuffer + i + 1 );
+    // skip the CO drivers
+    fAscii = (p->pBuffer[3] == ' ');
+    for ( i = 0, k++; i < nCos; k++ )
+    {
+        if ( k == p->nData && !Gia_AigRdFill(p) )
+            return 0;
+        if ( fAscii ? p->pBuffer[k] == '\n' : !(p->pBuffer[k] & 0x80) )
+            i++;
+    }
+    // move them into a separate buffer
+    p->nHead = k;
+    p->pHead = ABC_ALLOC( unsigned char, p->nHead + GIA_AIGER_PAD );
+    memcpy( p->pHead, p->pBuffer, p->nHead );
+    memset( p->pHead + p->nHead, 0, GIA_AIGER_PAD );
+    Gia_AigRdRefill( p, p->pBuffer + p->nHead );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the rest of the stream (symbols and extensions).]
 
   Description []
   
@@ -173,15 +427,37 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+static unsigned char * Gia_AigRdLoadRest( Gia_AigRd_t * p, unsigned char * pCur, size_t * pnSize )
+{
+    Gia_AigRdRefill( p, pCur );
+    while ( Gia_AigRdFill( p ) );
+    *pnSize = p->nData;
+    return p->pBuffer;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [If the streaming reader is given, the buffer contains only 
+  the header and the CO drivers, while the AND gates are decoded from the 
+  window of the reader as it is being refilled.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Gia_AigerReadFromMemoryInt( Gia_AigRd_t * pRd, char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
     Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
-    int iObj, iNode0, iNode1, fHieOnly = 0;
+    int iObj, iNode0, iNode1, fHieOnly = 0, fTrusted;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
-    unsigned char * pDrivers, * pSymbols, * pCur;
+    int fAscii = (pContents[3] == ' ');
+    unsigned char * pDrivers, * pSymbols, * pCur, * pEnd;
     unsigned uLit0, uLit1, uLit;
 
     // read the parameters (M I L O A + B C J F)
@@ -258,19 +534,21 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     pNew->fGiaSimple = fGiaSimple;
 
     // prepare the array of nodes
-    vNodes = Vec_IntAlloc( 1 + nTotal );
-    Vec_IntPush( vNodes, 0 );
+    // (without structural hashing, object IDs are the same as AIGER variables)
+    fTrusted = !fGiaSimple && fSkipStrash;
+    vNodes = fTrusted ? NULL : Vec_IntAlloc( 1 + nTotal );
+    if ( vNodes ) Vec_IntPush( vNodes, 0 );
 
     // create the PIs
     for ( i = 0; i < nInputs + nLatches; i++ )
     {
         iObj = Gia_ManAppendCi(pNew);    
-        Vec_IntPush( vNodes, iObj );
+        if ( vNodes ) Vec_IntPush( vNodes, iObj );
     }
 
     // remember the beginning of latch/PO literals
     pDrivers = pCur;
-    if ( pContents[3] == ' ' ) // standard AIGER
+    if ( fAscii ) // standard AIGER
     {
         // scroll to the beginning of the binary data
         for ( i = 0; i < nLatches + nOutputs; )
@@ -282,11 +560,35 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
 
+    // continue with the window of the streaming reader
+    pEnd = (unsigned char *)pContents + nFileSize;
+    if ( pRd )
+        pCur = pRd->pBuffer, pEnd = pRd->pBuffer + pRd->nData;
+
     // create the AND gates
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
+    if ( fTrusted )
+    {
+        // decode the deltas directly into the objects
+        for ( i = 0; i < nAnds; i++ )
+        {
+            if ( pRd && pCur + 10 > pEnd ) // two deltas take at most 10 bytes
+                pCur = Gia_AigRdRefill( pRd, pCur ), pEnd = pRd->pBuffer + pRd->nData;
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+            if ( uLit0 == uLit1 )
+                Gia_ManAppendBuf( pNew, uLit0 );
+            else
+                Gia_ManAppendAnd( pNew, uLit0, uLit1 );
+        }
+    }
+    else
     for ( i = 0; i < nAnds; i++ )
     {
+        if ( pRd && pCur + 10 > pEnd ) // two deltas take at most 10 bytes
+            pCur = Gia_AigRdRefill( pRd, pCur ), pEnd = pRd->pBuffer + pRd->nData;
         uLit = ((i + 1 + nInputs + nLatches) << 1);
         uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
         uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
@@ -294,25 +596,24 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
         iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
         assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
-        if ( !fGiaSimple && fSkipStrash )
-        {
-            if ( iNode0 == iNode1 )
-                Vec_IntPush( vNodes, Gia_ManAppendBuf(pNew, iNode0) );
-            else
-                Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
-        }
-        else
-            Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+        Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
     }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
 
+    // load the rest of the stream, which is parsed in memory
+    if ( pRd )
+    {
+        pContents = (char *)Gia_AigRdLoadRest( pRd, pCur, &nFileSize );
+        pCur = (unsigned char *)pContents;
+    }
+
     // remember the place where symbols begin
     pSymbols = pCur;
 
     // read the latch driver literals
     vDrivers = Vec_IntAlloc( nLatches + nOutputs );
-    if ( pContents[3] == ' ' ) // standard AIGER
+    if ( fAscii ) // standard AIGER
     {
         vInits = Vec_IntAlloc( nLatches );
         pCur = pDrivers;
@@ -332,14 +633,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 pCur++;
                 Vec_IntPush( vInits, 0 );
             }
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerMapLit( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         // read the PO driver literals
         for ( i = 0; i < nOutputs; i++ )
         {
             uLit0 = atoi( (char *)pCur );   while ( *pCur++ != '\n' );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerMapLit( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
 
@@ -350,14 +651,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         for ( i = 0; i < nLatches; i++ )
         {
             uLit0 = Vec_IntEntry( vLits, i );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerMapLit( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         // read the PO driver literals
         for ( i = 0; i < nOutputs; i++ )
         {
             uLit0 = Vec_IntEntry( vLits, i+nLatches );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerMapLit( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         Vec_IntFree( vLits );
@@ -777,7 +1078,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
 
     // skipping the comments
-    Vec_IntFree( vNodes );
+    Vec_IntFreeP( &vNodes );
 
     // update polarity of the additional outputs
     if ( nBad || nConstr || nJust || nFair )
@@ -861,6 +1162,122 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
     return pNew;
 }
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryInt( NULL, pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG from the compressed file.]
+
+  Description [The file is decompressed while the AND gates are decoded, 
+  so the uncompressed AIG is never held in memory as a whole. Only the 
+  header, the CO drivers, and the symbols and extensions following 
+  the AND gates are buffered.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadFromStream( char * pFileName, int Type, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    Gia_Man_t * pNew = NULL;
+    Gia_AigRd_t * pRd;
+    pRd = Gia_AigRdStart( pFileName, Type );
+    if ( pRd == NULL )
+    {
+        printf( "Gia_AigerReadFromStream(): Cannot open the compressed file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    if ( Gia_AigRdLoadHead( pRd ) )
+        pNew = Gia_AigerReadFromMemoryInt( pRd, (char *)pRd->pHead, pRd->nHead, fGiaSimple, fSkipStrash, fCheck );
+    else
+        printf( "Gia_AigerReadFromStream(): The header of the AIGER file \"%s\" is in a wrong format.\n", pFileName );
+    Gia_AigRdStop( pRd );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [Returns NULL if the file cannot be mapped, in which case
+  the caller should read it into a buffer. The pages are mapped privately,
+  so the file is not changed if the parser writes into the contents.
+  The sizes are 64-bit, so the files over 2 GB are mapped too.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_AigerMapFile( char * pFileName, size_t * pnFileSize )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    char * pContents;
+    int fd = open( pFileName, O_RDONLY );
+    *pnFileSize = 0;
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == -1 || Stat.st_size <= 0 || (ABC_UINT64_T)Stat.st_size > (ABC_UINT64_T)(size_t)-1 )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    *pnFileSize = (size_t)Stat.st_size;
+    return pContents;
+#else
+    *pnFileSize = 0;
+    return NULL;
+#endif
+}
+void Gia_AigerUnmapFile( char * pContents, size_t nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, nFileSize );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the file into a buffer.]
+
+  Description [Used when the file cannot be mapped. The buffer grows
+  while the file is read, so the size is not limited by Gia_FileSize().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_AigerReadFile( char * pFileName, size_t * pnFileSize )
+{
+    size_t nAlloc = GIA_AIGER_BUFFER, nRead;
+    char * pContents;
+    FILE * pFile = fopen( pFileName, "rb" );
+    *pnFileSize = 0;
+    if ( pFile == NULL )
+        return NULL;
+    pContents = ABC_ALLOC( char, nAlloc );
+    while ( (nRead = fread( pContents + *pnFileSize, 1, nAlloc - *pnFileSize, pFile )) > 0 )
+    {
+        *pnFileSize += nRead;
+        if ( *pnFileSize == nAlloc )
+            pContents = ABC_REALLOC( char, pContents, (nAlloc *= 2) );
+    }
+    fclose( pFile );
+    return pContents;
+}
 
 /**Function*************************************************************
 
@@ -875,22 +1292,37 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
 {
-    FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
-    int RetValue;
+    size_t nFileSize;
+    int Type;
 
-    // read the file into the buffer
+    // map the file into memory or read it into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    Type = Gia_AigerFileCompression( pFileName );
+    if ( Type == -1 )
+    {
+        printf( "Gia_AigerRead(): Cannot open the input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    if ( Type == GIA_AIGER_ZST )
+    {
+        printf( "Gia_AigerRead(): Reading zstd-compressed files is not supported in this build.\n" );
+        return NULL;
+    }
+    if ( Type != GIA_AIGER_RAW )
+        pNew = Gia_AigerReadFromStream( pFileName, Type, fGiaSimple, fSkipStrash, fCheck );
+    else if ( (pContents = Gia_AigerMapFile( pFileName, &nFileSize )) != NULL )
+    {
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        Gia_AigerUnmapFile( pContents, nFileSize );
+    }
+    else
+    {
+        pContents = Gia_AigerReadFile( pFileName, &nFileSize );
+        pNew = pContents ? Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck ) : NULL;
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1065,6 +1497,116 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
     return vBuffer;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the streaming writer.]
+
+  Description [The output is compressed if the file name ends with ".gz" 
+  or ".bz2". The stop procedure returns 0 if writing has failed.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_AigWr_t * Gia_AigWrStart( char * pFileName )
+{
+    Gia_AigWr_t * p;
+    char * pExt = strrchr( pFileName, '.' );
+    int bzError = BZ_OK;
+    p = ABC_CALLOC( Gia_AigWr_t, 1 );
+    if ( pExt && !strcmp( pExt, ".gz" ) )
+        p->pGz = gzopen( pFileName, "wb" );
+    else if ( (p->pFile = fopen( pFileName, "wb" )) && pExt && !strcmp( pExt, ".bz2" ) )
+    {
+        p->pBz = BZ2_bzWriteOpen( &bzError, p->pFile, 9, 0, 0 );
+        if ( bzError != BZ_OK )
+        {
+            BZ2_bzWriteClose( &bzError, p->pBz, 1, NULL, NULL );
+            fclose( p->pFile );
+            p->pFile = NULL;
+        }
+    }
+    if ( p->pGz == NULL && p->pFile == NULL )
+    {
+        ABC_FREE( p );
+        return NULL;
+    }
+    return p;
+}
+static int Gia_AigWrStop( Gia_AigWr_t * p )
+{
+    int bzError, RetValue = !p->fError;
+    if ( p->pGz )
+        RetValue &= (gzclose( p->pGz ) == Z_OK);
+    if ( p->pBz )
+    {
+        BZ2_bzWriteClose( &bzError, p->pBz, p->fError, NULL, NULL );
+        RetValue &= (bzError == BZ_OK);
+    }
+    if ( p->pFile )
+        RetValue &= (fclose( p->pFile ) == 0);
+    ABC_FREE( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes data into the stream.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_AigWrWrite( Gia_AigWr_t * p, void * pData, int nBytes )
+{
+    int bzError = BZ_OK;
+    if ( nBytes == 0 || p->fError )
+        return;
+    if ( p->pGz )
+        p->fError = (gzwrite( p->pGz, pData, (unsigned)nBytes ) != nBytes);
+    else if ( p->pBz )
+    {
+        BZ2_bzWrite( &bzError, p->pBz, pData, nBytes );
+        p->fError = (bzError != BZ_OK);
+    }
+    else
+        p->fError = ((int)fwrite( pData, 1, (size_t)nBytes, p->pFile ) != nBytes);
+}
+static void Gia_AigWrSize( Gia_AigWr_t * p, int nSize )
+{
+    unsigned char Buffer[5];
+    Gia_AigerWriteInt( Buffer, nSize );
+    Gia_AigWrWrite( p, Buffer, 4 );
+}
+static void Gia_AigWrPrintf( Gia_AigWr_t * p, const char * pFormat, ... )
+{
+    char Buffer[1000], * pBuffer = Buffer;
+    int nBytes;
+    va_list args;
+    va_start( args, pFormat );
+    if ( p->pGz == NULL && p->pBz == NULL )
+        nBytes = vfprintf( p->pFile, pFormat, args ), pBuffer = NULL;
+    else
+        nBytes = vsnprintf( Buffer, sizeof(Buffer), pFormat, args );
+    va_end( args );
+    if ( pBuffer == NULL )
+        return;
+    if ( nBytes < 0 || nBytes >= (int)sizeof(Buffer) )
+    {
+        va_start( args, pFormat );
+        pBuffer = vnsprintf( pFormat, args );
+        va_end( args );
+        nBytes = strlen( pBuffer );
+    }
+    Gia_AigWrWrite( p, pBuffer, nBytes );
+    if ( pBuffer != Buffer )
+        ABC_FREE( pBuffer );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writes the AIG in the binary AIGER format.]
@@ -1079,7 +1621,7 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine )
 {
     int fVerbose = XAIG_VERBOSE;
-    FILE * pFile;
+    Gia_AigWr_t * pFile;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
@@ -1095,7 +1637,12 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     }
 
     // start the output stream
-    pFile = fopen( pFileName, "wb" );
+    if ( strlen(pFileName) > 4 && !strcmp( pFileName + strlen(pFileName) - 4, ".zst" ) )
+    {
+        fprintf( stdout, "Gia_AigerWrite(): Writing zstd-compressed files is not supported in this build.\n" );
+        return;
+    }
+    pFile = Gia_AigWrStart( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
@@ -1118,7 +1665,7 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         p = pInit;
 
     // write the header "M I L O A" where M = I + L + A
-    fprintf( pFile, "aig%s %u %u %u %u %u", 
+    Gia_AigWrPrintf( pFile, "aig%s %u %u %u %u %u", 
         fCompact? "2" : "",
         Gia_ManCiNum(p) + Gia_ManAndNum(p), 
         Gia_ManPiNum(p),
@@ -1127,32 +1674,35 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         Gia_ManAndNum(p) );
     // write the extended header "B C J F"
     if ( Gia_ManConstrNum(p) )
-        fprintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
-    fprintf( pFile, "\n" ); 
+        Gia_AigWrPrintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
+    Gia_AigWrPrintf( pFile, "\n" ); 
 
     Gia_ManInvertConstraints( p );
     if ( !fCompact ) 
     {
+        vStrExt = Vec_StrAlloc( 8 * Gia_ManCoNum(p) );
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Vec_StrPrintNum( vStrExt, Gia_ObjFaninLit0p(p, pObj) ), Vec_StrPush( vStrExt, '\n' );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Vec_StrPrintNum( vStrExt, Gia_ObjFaninLit0p(p, pObj) ), Vec_StrPush( vStrExt, '\n' );
+        Gia_AigWrWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
+        Vec_StrFree( vStrExt );
     }
     else
     {
         Vec_Int_t * vLits = Gia_AigerCollectLiterals( p );
         Vec_Str_t * vBinary = Gia_AigerWriteLiterals( vLits );
-        fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), pFile );
+        Gia_AigWrWrite( pFile, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
         Vec_StrFree( vBinary );
         Vec_IntFree( vLits );
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
+    // write the nodes through the fixed-size buffer
     Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
+    nBufferSize = GIA_AIGER_BUFFER;
     pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -1162,19 +1712,16 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
         Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
         Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
+        if ( Pos > nBufferSize - 10 ) // two edges take at most 10 bytes
         {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
+            Gia_AigWrWrite( pFile, pBuffer, Pos );
+            Pos = 0;
         }
     }
     assert( Pos < nBufferSize );
 
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
+    // write the rest of the buffer
+    Gia_AigWrWrite( pFile, pBuffer, Pos );
     ABC_FREE( pBuffer );
 
     // write the symbol table
@@ -1184,44 +1731,44 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
         // write PIs
         Gia_ManForEachPi( p, pObj, i )
-            fprintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
+            Gia_AigWrPrintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
         // write latches
         Gia_ManForEachRo( p, pObj, i )
-            fprintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+            Gia_AigWrPrintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
         // write POs
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
+            Gia_AigWrPrintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
     }
 
     // write the comment
     if ( fWriteNewLine ) 
-        fprintf( pFile, "c\n" );
+        Gia_AigWrPrintf( pFile, "c\n" );
     else
-        fprintf( pFile, "c" );
+        Gia_AigWrPrintf( pFile, "c" );
 
     // write additional AIG
     if ( p->pAigExtra )
     {
-        fprintf( pFile, "a" );
+        Gia_AigWrPrintf( pFile, "a" );
         vStrExt = Gia_AigerWriteIntoMemoryStr( p->pAigExtra );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigWrSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigWrWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"a\".\n" );
     }
     // write constraints
     if ( p->nConstrs )
     {
-        fprintf( pFile, "c" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nConstrs );
+        Gia_AigWrPrintf( pFile, "c" );
+        Gia_AigWrSize( pFile, 4 );
+        Gia_AigWrSize( pFile, p->nConstrs );
     }
     // write timing information
     if ( p->nAnd2Delay )
     {
-        fprintf( pFile, "d" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nAnd2Delay );
+        Gia_AigWrPrintf( pFile, "d" );
+        Gia_AigWrSize( pFile, 4 );
+        Gia_AigWrSize( pFile, p->nAnd2Delay );
     }
     if ( p->pManTime )
     {
@@ -1229,18 +1776,18 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         pTimes = Tim_ManGetArrTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "i" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigWrPrintf( pFile, "i" );
+            Gia_AigWrSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigWrWrite( pFile, pTimes, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"i\".\n" );
         }
         pTimes = Tim_ManGetReqTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "o" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigWrPrintf( pFile, "o" );
+            Gia_AigWrSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigWrWrite( pFile, pTimes, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"o\".\n" );
         }
@@ -1249,35 +1796,35 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     if ( p->pReprs && p->pNexts )
     {
         extern Vec_Str_t * Gia_WriteEquivClasses( Gia_Man_t * p );
-        fprintf( pFile, "e" );
+        Gia_AigWrPrintf( pFile, "e" );
         vStrExt = Gia_WriteEquivClasses( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigWrSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigWrWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
     // write flop classes
     if ( p->vFlopClasses )
     {
-        fprintf( pFile, "f" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManRegNum(p) );
+        Gia_AigWrPrintf( pFile, "f" );
+        Gia_AigWrSize( pFile, 4*Gia_ManRegNum(p) );
         assert( Vec_IntSize(p->vFlopClasses) == Gia_ManRegNum(p) );
-        fwrite( Vec_IntArray(p->vFlopClasses), 1, 4*Gia_ManRegNum(p), pFile );
+        Gia_AigWrWrite( pFile, Vec_IntArray(p->vFlopClasses), 4*Gia_ManRegNum(p) );
     }
     // write gate classes
     if ( p->vGateClasses )
     {
-        fprintf( pFile, "g" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigWrPrintf( pFile, "g" );
+        Gia_AigWrSize( pFile, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vGateClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vGateClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigWrWrite( pFile, Vec_IntArray(p->vGateClasses), 4*Gia_ManObjNum(p) );
     }
     // write hierarchy info
     if ( p->pManTime )
     {
-        fprintf( pFile, "h" );
+        Gia_AigWrPrintf( pFile, "h" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigWrSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigWrWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"h\".\n" );
     }
@@ -1285,10 +1832,10 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     if ( p->vPacking )
     {
         extern Vec_Str_t * Gia_WritePacking( Vec_Int_t * vPacking );
-        fprintf( pFile, "k" );
+        Gia_AigWrPrintf( pFile, "k" );
         vStrExt = Gia_WritePacking( p->vPacking );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigWrSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigWrWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"k\".\n" );
     }
@@ -1297,11 +1844,11 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     {
         Vec_Int_t * vPairs = Gia_ManEdgeToArray( p );
         int i;
-        fprintf( pFile, "w" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(vPairs)/2 );
+        Gia_AigWrPrintf( pFile, "w" );
+        Gia_AigWrSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
+        Gia_AigWrSize( pFile, Vec_IntSize(vPairs)/2 );
         for ( i = 0; i < Vec_IntSize(vPairs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(vPairs, i) );
+            Gia_AigWrSize( pFile, Vec_IntEntry(vPairs, i) );
         Vec_IntFree( vPairs );
     }
     // write mapping
@@ -1310,109 +1857,110 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         extern Vec_Str_t * Gia_AigerWriteMapping( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingSimple( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "m" );
+        Gia_AigWrPrintf( pFile, "m" );
         vStrExt = Gia_AigerWriteMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigWrSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigWrWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"m\".\n" );
     }
     // write placement
     if ( p->pPlacement )
     {
-        fprintf( pFile, "p" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
-        fwrite( p->pPlacement, 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigWrPrintf( pFile, "p" );
+        Gia_AigWrSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigWrWrite( pFile, p->pPlacement, 4*Gia_ManObjNum(p) );
     }
     // write register classes
     if ( p->vRegClasses )
     {
         int i;
-        fprintf( pFile, "r" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegClasses) );
+        Gia_AigWrPrintf( pFile, "r" );
+        Gia_AigWrSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
+        Gia_AigWrSize( pFile, Vec_IntSize(p->vRegClasses) );
         for ( i = 0; i < Vec_IntSize(p->vRegClasses); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
+            Gia_AigWrSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
     }
     // write register inits
     if ( p->vRegInits )
     {
         int i;
-        fprintf( pFile, "s" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegInits) );
+        Gia_AigWrPrintf( pFile, "s" );
+        Gia_AigWrSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
+        Gia_AigWrSize( pFile, Vec_IntSize(p->vRegInits) );
         for ( i = 0; i < Vec_IntSize(p->vRegInits); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegInits, i) );
+            Gia_AigWrSize( pFile, Vec_IntEntry(p->vRegInits, i) );
     }
     // write configuration data
     if ( p->vConfigs )
     {
-        fprintf( pFile, "b" );
+        Gia_AigWrPrintf( pFile, "b" );
         assert( p->pCellStr != NULL );
-        Gia_FileWriteBufferSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
-        fwrite( p->pCellStr, 1, strlen(p->pCellStr) + 1, pFile );
-//        fwrite( Vec_IntArray(p->vConfigs), 1, 4*Vec_IntSize(p->vConfigs), pFile );
+        Gia_AigWrSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
+        Gia_AigWrWrite( pFile, p->pCellStr, strlen(p->pCellStr) + 1 );
+//        Gia_AigWrWrite( pFile, Vec_IntArray(p->vConfigs), 4*Vec_IntSize(p->vConfigs) );
         for ( i = 0; i < Vec_IntSize(p->vConfigs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vConfigs, i) );
+            Gia_AigWrSize( pFile, Vec_IntEntry(p->vConfigs, i) );
     }
     // write choices
     if ( Gia_ManHasChoices(p) )
     {
         int i, nPairs = 0;
-        fprintf( pFile, "q" );
+        Gia_AigWrPrintf( pFile, "q" );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             nPairs += (Gia_ObjSibl(p, i) > 0);
-        Gia_FileWriteBufferSize( pFile, 4*(nPairs * 2 + 1) );
-        Gia_FileWriteBufferSize( pFile, nPairs );
+        Gia_AigWrSize( pFile, 4*(nPairs * 2 + 1) );
+        Gia_AigWrSize( pFile, nPairs );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             if ( Gia_ObjSibl(p, i) )
             {
                 assert( i > Gia_ObjSibl(p, i) );
-                Gia_FileWriteBufferSize( pFile, i );
-                Gia_FileWriteBufferSize( pFile, Gia_ObjSibl(p, i) );
+                Gia_AigWrSize( pFile, i );
+                Gia_AigWrSize( pFile, Gia_ObjSibl(p, i) );
             }
         if ( fVerbose ) printf( "Finished writing extension \"q\".\n" );
     }
     // write switching activity
     if ( p->pSwitching )
     {
-        fprintf( pFile, "u" );
-        Gia_FileWriteBufferSize( pFile, Gia_ManObjNum(p) );
-        fwrite( p->pSwitching, 1, Gia_ManObjNum(p), pFile );
+        Gia_AigWrPrintf( pFile, "u" );
+        Gia_AigWrSize( pFile, Gia_ManObjNum(p) );
+        Gia_AigWrWrite( pFile, p->pSwitching, Gia_ManObjNum(p) );
     }
 /*
     // write timing information
     if ( p->pManTime )
     {
-        fprintf( pFile, "t" );
+        Gia_AigWrPrintf( pFile, "t" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 0 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigWrSize( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigWrWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
 */
     // write object classes
     if ( p->vObjClasses )
     {
-        fprintf( pFile, "v" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigWrPrintf( pFile, "v" );
+        Gia_AigWrSize( pFile, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vObjClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vObjClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigWrWrite( pFile, Vec_IntArray(p->vObjClasses), 4*Gia_ManObjNum(p) );
     }
     // write name
     if ( p->pName )
     {
-        fprintf( pFile, "n" );
-        Gia_FileWriteBufferSize( pFile, strlen(p->pName)+1 );
-        fwrite( p->pName, 1, strlen(p->pName), pFile );
-        fprintf( pFile, "%c", '\0' );
+        Gia_AigWrPrintf( pFile, "n" );
+        Gia_AigWrSize( pFile, strlen(p->pName)+1 );
+        Gia_AigWrWrite( pFile, p->pName, strlen(p->pName) );
+        Gia_AigWrPrintf( pFile, "%c", '\0' );
     }
     // write comments
     if ( fWriteNewLine )
-        fprintf( pFile, "c\n" );
-    fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
-    fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
-    fclose( pFile );
+        Gia_AigWrPrintf( pFile, "c\n" );
+    Gia_AigWrPrintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+    Gia_AigWrPrintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+    if ( !Gia_AigWrStop( pFile ) )
+        fprintf( stdout, "Gia_AigerWrite(): Writing the output file \"%s\" has failed.\n", pFileName );
     if ( p != pInit )
     {
         pInit->pManTime  = p->pManTime;  p->pManTime = NULL;
@@ -0,0 +1,445 @@
+/**CFile****************************************************************
+
+  FileName    [giaCutDb.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Cut database shared by the mappers.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaCutDb.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cut set of an object is stored in the same way as in &mf and &nf:
+// the number of cuts, followed by the cuts, each of which is represented
+// by (nLeaves | (iFunc << 5)) followed by the leaves. If the truth tables
+// are used, iFunc is the literal of the truth table in vTtMem.
+//
+// The database is used by &mf and &nf only; &if, &lf and &jf re-enumerate
+// the cuts in each mapping round. A separate database is kept for each
+// cut size, so the cuts are not shared by the runs with different -K.
+
+struct Gia_CutDb_t_
+{
+    int            nLutSize;      // the max cut size
+    int            nCutNum;       // the max number of cuts at a node
+    int            fTruth;        // the cuts are minimized using truth tables
+    int            fUpdate;       // the new cut sets are recorded
+    Vec_Int_t *    vObjKeys;      // structural keys of the objects (3 entries per object)
+    Vec_Int_t *    vCutSets;      // cut set handles (0 if the cut set is not available)
+    Vec_Int_t *    vCuts;         // cut sets
+    Vec_Mem_t *    vTtMem;        // truth tables of the cuts
+    Vec_Int_t *    vImport;       // truth table IDs in the mapper (-1 if not computed)
+    Vec_Int_t *    vExport;       // truth table IDs in the database (-1 if not computed)
+    Vec_Int_t *    vTemp;         // cut set translated for the mapper
+    int            nDeadInts;     // the number of entries in the unused cut sets
+    // statistics
+    int            nObjsValid;    // objects whose cut sets are valid
+    int            nObjsReused;   // objects whose cut sets were used
+    int            nObjsAdded;    // objects whose cut sets were added
+};
+
+static inline int  Gia_CutDbCutSize( int * pCut )   { return pCut[0] & 31;                 }
+static inline int  Gia_CutDbCutFunc( int * pCut )   { return ((unsigned)pCut[0] >> 5);     }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates and deallocates the database.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_CutDb_t * Gia_CutDbAlloc( int nLutSize, int nCutNum, int fTruth )
+{
+    Gia_CutDb_t * p = ABC_CALLOC( Gia_CutDb_t, 1 );
+    p->nLutSize = nLutSize;
+    p->nCutNum  = nCutNum;
+    p->fTruth   = fTruth;
+    p->vObjKeys = Vec_IntAlloc( 0 );
+    p->vCutSets = Vec_IntAlloc( 0 );
+    p->vCuts    = Vec_IntAlloc( 1 << 16 );
+    p->vTtMem   = fTruth ? Vec_MemAllocForTT( nLutSize, 0 ) : NULL;
+    p->vImport  = Vec_IntAlloc( 0 );
+    p->vExport  = Vec_IntAlloc( 0 );
+    p->vTemp    = Vec_IntAlloc( 0 );
+    Vec_IntPush( p->vCuts, 0 ); // handle 0 is not used
+    return p;
+}
+void Gia_CutDbFree( Gia_CutDb_t * p )
+{
+    if ( p->vTtMem )
+    {
+        Vec_MemHashFree( p->vTtMem );
+        Vec_MemFree( p->vTtMem );
+    }
+    Vec_IntFree( p->vObjKeys );
+    Vec_IntFree( p->vCutSets );
+    Vec_IntFree( p->vCuts );
+    Vec_IntFree( p->vImport );
+    Vec_IntFree( p->vExport );
+    Vec_IntFree( p->vTemp );
+    ABC_FREE( p );
+}
+double Gia_CutDbMemory( Gia_CutDb_t * p )
+{
+    double Mem = sizeof(Gia_CutDb_t);
+    Mem += 4.0 * (Vec_IntCap(p->vObjKeys) + Vec_IntCap(p->vCutSets) + Vec_IntCap(p->vCuts));
+    Mem += p->vTtMem ? Vec_MemMemory(p->vTtMem) : 0;
+    return Mem;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the structural key of the object.]
+
+  Description [The cuts of the node depend only on the keys of the nodes
+  in its transitive fanin, which include the fanin literals, the MUX
+  control literal, and the choice sibling.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_CutDbObjKey( Gia_Man_t * p, int iObj, int * pKey )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    pKey[0] = pKey[1] = pKey[2] = -1;
+    if ( Gia_ObjIsAnd(pObj) )
+    {
+        pKey[0] = Gia_ObjFaninLit0( pObj, iObj );
+        pKey[1] = Gia_ObjFaninLit1( pObj, iObj );
+        if ( Gia_ObjIsMuxId(p, iObj) )
+            pKey[2] = 2 * Gia_ObjFaninLit2(p, iObj);
+        else if ( Gia_ObjSibl(p, iObj) )
+            pKey[2] = 2 * Gia_ObjSibl(p, iObj) + 1;
+    }
+    else if ( Gia_ObjIsCi(pObj) )
+        pKey[0] = -2;
+    else if ( Gia_ObjIsCo(pObj) )
+        pKey[0] = -3;
+}
+static inline int Gia_CutDbSetSize( int * pList )
+{
+    int i, * pCut = pList + 1;
+    for ( i = 0; i < pList[0]; i++ )
+        pCut += Gia_CutDbCutSize(pCut) + 1;
+    return pCut - pList;
+}
+static inline void Gia_CutDbRemoveSet( Gia_CutDb_t * p, int iObj )
+{
+    int iCutSet = Vec_IntEntry( p->vCutSets, iObj );
+    if ( iCutSet == 0 )
+        return;
+    p->nDeadInts += Gia_CutDbSetSize( Vec_IntEntryP(p->vCuts, iCutSet) );
+    Vec_IntWriteEntry( p->vCutSets, iObj, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Invalidates the cut sets after the AIG has changed.]
+
+  Description [Compares the structural key of each object with the one
+  recorded when its cut set was added. The cut set is removed if the key
+  of the node or of any node in its transitive fanin has changed. The keys
+  are updated to match the current AIG. Returns the number of objects
+  whose cut sets remain valid.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_CutDbValidate( Gia_CutDb_t * p, Gia_Man_t * pGia )
+{
+    Vec_Str_t * vChanged = Vec_StrStart( Gia_ManObjNum(pGia) );
+    char * pChanged = Vec_StrArray( vChanged );
+    int i, k, iFan, Key[3], * pKey, nObjs = Gia_ManObjNum(pGia), nValid = 0;
+    // remove the cut sets of the objects that no longer exist
+    for ( i = nObjs; i < Vec_IntSize(p->vCutSets); i++ )
+        Gia_CutDbRemoveSet( p, i );
+    Vec_IntFillExtra( p->vCutSets, nObjs, 0 );
+    Vec_IntFillExtra( p->vObjKeys, 3 * nObjs, -1 );
+    Vec_IntShrink( p->vCutSets, nObjs );
+    Vec_IntShrink( p->vObjKeys, 3 * nObjs );
+    for ( i = 0; i < nObjs; i++ )
+    {
+        pKey = Vec_IntEntryP( p->vObjKeys, 3*i );
+        Gia_CutDbObjKey( pGia, i, Key );
+        if ( pKey[0] != Key[0] || pKey[1] != Key[1] || pKey[2] != Key[2] )
+        {
+            memcpy( pKey, Key, sizeof(int) * 3 );
+            pChanged[i] = 1;
+        }
+        else if ( Key[0] >= 0 )
+        {
+            for ( k = 0; k < 3; k++ )
+            {
+                if ( Key[k] < 0 )
+                    continue;
+                iFan = k < 2 ? Abc_Lit2Var(Key[k]) : ((Key[k] & 1) ? Key[k] >> 1 : Key[k] >> 2);
+                if ( iFan >= i || pChanged[iFan] )
+                    pChanged[i] = 1;
+            }
+        }
+        if ( pChanged[i] )
+            Gia_CutDbRemoveSet( p, i );
+        else if ( Vec_IntEntry(p->vCutSets, i) )
+            nValid++;
+    }
+    Vec_StrFree( vChanged );
+    return nValid;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the unused cut sets from memory.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CutDbCompact( Gia_CutDb_t * p )
+{
+    Vec_Int_t * vCuts = Vec_IntAlloc( Vec_IntSize(p->vCuts) - p->nDeadInts );
+    int i, iCutSet, * pList;
+    Vec_IntPush( vCuts, 0 );
+    Vec_IntForEachEntry( p->vCutSets, iCutSet, i )
+    {
+        if ( iCutSet == 0 )
+            continue;
+        pList = Vec_IntEntryP( p->vCuts, iCutSet );
+        Vec_IntWriteEntry( p->vCutSets, i, Vec_IntSize(vCuts) );
+        Vec_IntPushArray( vCuts, pList, Gia_CutDbSetSize(pList) );
+    }
+    Vec_IntFree( p->vCuts );
+    p->vCuts = vCuts;
+    p->nDeadInts = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the cut database to be used by the mapper.]
+
+  Description [The databases are attached to pGia. The one with the same
+  cut size and the same cut minimization is reused, if it stores at least
+  as many cuts per node as the mapper computes. Otherwise, a new one is
+  created. The database is validated against p, which is the AIG being
+  mapped (it may differ from pGia, for example, when the mapper coarsens
+  the AIG). The new cut sets are recorded only when the mapper computes
+  the same number of cuts as the database stores.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_CutDb_t * Gia_ManCutDbPrepare( Gia_Man_t * pGia, Gia_Man_t * p, int nLutSize, int nCutNum, int fTruth, int fVerbose )
+{
+    Gia_CutDb_t * pDb = NULL;
+    int i;
+    if ( pGia->vCutDbs == NULL )
+        pGia->vCutDbs = Vec_PtrAlloc( 4 );
+    Vec_PtrForEachEntry( Gia_CutDb_t *, pGia->vCutDbs, pDb, i )
+        if ( pDb->nLutSize == nLutSize && pDb->fTruth == fTruth )
+            break;
+    if ( i == Vec_PtrSize(pGia->vCutDbs) )
+    {
+        pDb = Gia_CutDbAlloc( nLutSize, nCutNum, fTruth );
+        Vec_PtrPush( pGia->vCutDbs, pDb );
+    }
+    else if ( pDb->nCutNum < nCutNum )
+    {
+        Gia_CutDbFree( pDb );
+        pDb = Gia_CutDbAlloc( nLutSize, nCutNum, fTruth );
+        Vec_PtrWriteEntry( pGia->vCutDbs, i, pDb );
+    }
+    pDb->nObjsValid  = Gia_CutDbValidate( pDb, p );
+    pDb->nObjsReused = 0;
+    pDb->nObjsAdded  = 0;
+    pDb->fUpdate     = (int)(pDb->nCutNum == nCutNum);
+    if ( 2 * pDb->nDeadInts > Vec_IntSize(pDb->vCuts) )
+        Gia_CutDbCompact( pDb );
+    Vec_IntClear( pDb->vImport );
+    Vec_IntClear( pDb->vExport );
+    if ( fVerbose )
+    {
+        printf( "Cut database:  K = %d  C = %d  Truth = %s  Valid cut sets = %d (%.2f %%)  Mem = %.2f MB\n",
+            pDb->nLutSize, pDb->nCutNum, pDb->fTruth ? "yes" : "no", pDb->nObjsValid,
+            100.0 * pDb->nObjsValid / Abc_MaxInt(1, Gia_ManAndNum(p)), Gia_CutDbMemory(pDb) / (1<<20) );
+    }
+    return pDb;
+}
+void Gia_CutDbPrintStats( Gia_CutDb_t * p )
+{
+    printf( "Cut database:  Reused cut sets = %d  Added cut sets = %d  Mem = %.2f MB\n",
+        p->nObjsReused, p->nObjsAdded, Gia_CutDbMemory(p) / (1<<20) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers the databases to the new AIG.]
+
+  Description [The transfer is always safe because the database is
+  validated before it is used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManCutDbTransfer( Gia_Man_t * pOld, Gia_Man_t * pNew )
+{
+    if ( pOld == pNew || pOld->vCutDbs == NULL || pNew->vCutDbs != NULL )
+        return;
+    pNew->vCutDbs = pOld->vCutDbs;
+    pOld->vCutDbs = NULL;
+}
+void Gia_ManCutDbStop( Gia_Man_t * p )
+{
+    Gia_CutDb_t * pDb;
+    int i;
+    if ( p->vCutDbs == NULL )
+        return;
+    Vec_PtrForEachEntry( Gia_CutDb_t *, p->vCutDbs, pDb, i )
+        Gia_CutDbFree( pDb );
+    Vec_PtrFreeP( &p->vCutDbs );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Translates the function literals.]
+
+  Description [Gia_CutDbFuncImport() converts the literal of the truth
+  table in the database into the one in the mapper's table vTtMem, while
+  Gia_CutDbFuncExport() performs the reverse conversion. The translated
+  IDs are cached, so each truth table is hashed only once.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_CutDbFuncTranslate( Vec_Int_t * vMap, Vec_Mem_t * vTtFrom, Vec_Mem_t * vTtTo, int iFunc )
+{
+    int iTruth = Abc_Lit2Var( iFunc );
+    assert( vTtFrom->nEntrySize == vTtTo->nEntrySize );
+    Vec_IntFillExtra( vMap, iTruth + 1, -1 );
+    if ( Vec_IntEntry(vMap, iTruth) == -1 )
+        Vec_IntWriteEntry( vMap, iTruth, Vec_MemHashInsert(vTtTo, Vec_MemReadEntry(vTtFrom, iTruth)) );
+    return Abc_Var2Lit( Vec_IntEntry(vMap, iTruth), Abc_LitIsCompl(iFunc) );
+}
+static inline int Gia_CutDbFuncImport( Gia_CutDb_t * p, Vec_Mem_t * vTtMem, int iFunc )
+{
+    assert( p->fTruth );
+    return Gia_CutDbFuncTranslate( p->vImport, p->vTtMem, vTtMem, iFunc );
+}
+static inline int Gia_CutDbFuncExport( Gia_CutDb_t * p, Vec_Mem_t * vTtMem, int iFunc )
+{
+    assert( p->fTruth );
+    return Gia_CutDbFuncTranslate( p->vExport, vTtMem, p->vTtMem, iFunc );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the cut set of the object or NULL if not available.]
+
+  Description [The cut set is returned in the mapper's format. If the 
+  truth tables are used, vTtMem is the mapper's truth table storage, 
+  and the cut set is a translated copy, which remains valid until the 
+  next call.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int * Gia_CutDbObjCuts( Gia_CutDb_t * p, int iObj, Vec_Mem_t * vTtMem )
+{
+    int i, k, * pList, * pCut;
+    int iCutSet = iObj < Vec_IntSize(p->vCutSets) ? Vec_IntEntry(p->vCutSets, iObj) : 0;
+    if ( iCutSet == 0 )
+        return NULL;
+    p->nObjsReused++;
+    pList = Vec_IntEntryP( p->vCuts, iCutSet );
+    if ( !p->fTruth )
+        return pList;
+    Vec_IntClear( p->vTemp );
+    Vec_IntPush( p->vTemp, pList[0] );
+    for ( i = 0, pCut = pList + 1; i < pList[0]; i++, pCut += Gia_CutDbCutSize(pCut) + 1 )
+    {
+        int iFunc = Gia_CutDbFuncImport( p, vTtMem, Gia_CutDbCutFunc(pCut) );
+        Vec_IntPush( p->vTemp, Gia_CutDbCutSize(pCut) | (iFunc << 5) );
+        for ( k = 1; k <= Gia_CutDbCutSize(pCut); k++ )
+            Vec_IntPush( p->vTemp, pCut[k] );
+    }
+    return Vec_IntArray( p->vTemp );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the cut set computed by the mapper.]
+
+  Description [The cut set is given in the mapper's format. If the truth
+  tables are used, vTtMem is the mapper's truth table storage.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CutDbAddCutSet( Gia_CutDb_t * p, int iObj, int * pList, Vec_Mem_t * vTtMem )
+{
+    int i, k, * pCut;
+    if ( !p->fUpdate || iObj >= Vec_IntSize(p->vCutSets) )
+        return;
+    Gia_CutDbRemoveSet( p, iObj );
+    Vec_IntWriteEntry( p->vCutSets, iObj, Vec_IntSize(p->vCuts) );
+    Vec_IntPush( p->vCuts, pList[0] );
+    for ( i = 0, pCut = pList + 1; i < pList[0]; i++, pCut += Gia_CutDbCutSize(pCut) + 1 )
+    {
+        int iFunc = Gia_CutDbCutFunc( pCut );
+        if ( p->fTruth )
+            iFunc = Gia_CutDbFuncExport( p, vTtMem, iFunc );
+        Vec_IntPush( p->vCuts, Gia_CutDbCutSize(pCut) | (iFunc << 5) );
+        for ( k = 1; k <= Gia_CutDbCutSize(pCut); k++ )
+            Vec_IntPush( p->vCuts, pCut[k] );
+    }
+    p->nObjsAdded++;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
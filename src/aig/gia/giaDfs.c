@@ -124,7 +124,7 @@ void Gia_ManCollectAnds_rec( Gia_Man_t * p, int iObj, Vec_Int_t * vNodes )
 ***********************************************************************/
 void Gia_ManCollectAnds( Gia_Man_t * p, int * pNodes, int nNodes, Vec_Int_t * vNodes, Vec_Int_t * vLeaves )
 {
-    int i, iLeaf; 
+    int i, iLeaf, * pLits = Gia_ManSoaFanins( p ); 
 //    Gia_ManIncrementTravId( p );
     Gia_ObjSetTravIdCurrentId( p, 0 );
     if ( vLeaves )
@@ -134,7 +134,11 @@ void Gia_ManCollectAnds( Gia_Man_t * p, int * pNodes, int nNodes, Vec_Int_t * vN
     for ( i = 0; i < nNodes; i++ )
     {
         Gia_Obj_t * pObj = Gia_ManObj( p, pNodes[i] );
-        if ( Gia_ObjIsCo(pObj) )
+        if ( pLits && Gia_ObjIsCo(pObj) )
+            Gia_ManSoaCollectAnds_rec( p, pLits, Gia_ObjFaninId0(pObj, pNodes[i]), vNodes );
+        else if ( pLits && Gia_ObjIsAnd(pObj) )
+            Gia_ManSoaCollectAnds_rec( p, pLits, pNodes[i], vNodes );
+        else if ( Gia_ObjIsCo(pObj) )
             Gia_ManCollectAnds_rec( p, Gia_ObjFaninId0(pObj, pNodes[i]), vNodes );
         else if ( Gia_ObjIsAnd(pObj) )
             Gia_ManCollectAnds_rec( p, pNodes[i], vNodes );
@@ -1849,6 +1849,62 @@ Gia_Man_t * Gia_ManEquivToChoices( Gia_Man_t * p, int nSnapshots )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Converts choices into the representation used by the mappers.]
+
+  Description [Takes the AIG with choices derived by Gia_ManEquivToChoices(),
+  in which the representative has the smallest ID and the other members of
+  the class have no fanouts, and duplicates it in the DFS order, so that the
+  members of the class are created before the representative. The resulting
+  AIG has the same choices recorded as siblings.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManEquivToSibls_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
+{
+    Gia_Obj_t * pNext;
+    if ( ~pObj->Value )
+        return;
+    assert( Gia_ObjIsAnd(pObj) );
+    Gia_ManEquivToSibls_rec( pNew, p, Gia_ObjFanin0(pObj) );
+    Gia_ManEquivToSibls_rec( pNew, p, Gia_ObjFanin1(pObj) );
+    pNext = Gia_ObjNextObj( p, Gia_ObjId(p, pObj) );
+    if ( pNext )
+        Gia_ManEquivToSibls_rec( pNew, p, pNext );
+    pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    if ( pNext )
+    {
+        assert( Abc_Lit2Var(pObj->Value) > Abc_Lit2Var(pNext->Value) );
+        pNew->pSibls[Abc_Lit2Var(pObj->Value)] = Abc_Lit2Var(pNext->Value);
+    }
+}
+Gia_Man_t * Gia_ManEquivToSibls( Gia_Man_t * p )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( p->pReprs && p->pNexts );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    pNew->nConstrs = p->nConstrs;
+    pNew->pSibls = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManEquivToSibls_rec( pNew, p, Gia_ObjFanin0(pObj) );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    return pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Counts the number of choice nodes]
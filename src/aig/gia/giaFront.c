@@ -90,6 +90,7 @@ void Gia_ManFrontTransform( Gia_Man_t * p )
         pObj->Value = 0;
     }
     ABC_FREE( pFrontToId );
+    Gia_ManSoaDrop( p, 0 );
 }
 
 /**Function*************************************************************
@@ -20,6 +20,17 @@
 
 #include "gia.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,6 +38,35 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// open-addressing hash table with linear probing
+struct Gia_HashTab_t_
+{
+    word *         pKeys;         // fanin literal pairs (0 = empty slot)
+    int *          pIds;          // node IDs (0 = the node is being created)
+    int            nSize;         // the number of slots (power of 2)
+    int            nEntries;      // the number of used slots
+    word *         pKeysOld;      // the table being migrated after resizing
+    int *          pIdsOld;       // the table being migrated after resizing
+    int            nSizeOld;      // the number of slots in the old table
+    int            iMoveNext;     // the next slot of the old table to migrate
+    int            fConcurrent;   // the table is shared by several threads
+};
+
+// the number of old slots migrated by each insertion
+#define GIA_HASH_MOVE  8
+// the distance of prefetching in the batch insertion
+#define GIA_HASH_AHEAD 8
+
+#if defined(__GNUC__)
+#define GIA_HASH_ATOMICS
+#define Gia_AtomicCas64( p, o, n )  __sync_bool_compare_and_swap( (p), (o), (n) )
+#define Gia_AtomicAdd( p, n )       __sync_fetch_and_add( (p), (n) )
+#define Gia_AtomicBarrier()         __sync_synchronize()
+#define Gia_Prefetch( p )           __builtin_prefetch( (p) )
+#else
+#define Gia_Prefetch( p )
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -67,6 +107,205 @@ static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iL
     return pPlace;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Procedures of the open-addressing hash table.]
+
+  Description [The key is the pair of fanin literals (iLit0 < iLit1),
+  which is never zero because iLit1 is not a constant.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Gia_HashTabKey( int iLit0, int iLit1 )
+{
+    return ((word)iLit0 << 32) | (word)iLit1;
+}
+static inline int Gia_HashTabStart( word Key, int nSize )
+{
+    return (int)((Key * ABC_CONST(0x9E3779B97F4A7C15)) >> 32) & (nSize - 1);
+}
+static inline int Gia_HashTabSlot( word * pKeys, int nSize, word Key )
+{
+    int i = Gia_HashTabStart( Key, nSize );
+    while ( pKeys[i] && pKeys[i] != Key )
+        i = (i + 1) & (nSize - 1);
+    return i;
+}
+static Gia_HashTab_t * Gia_HashTabAlloc( int nSize )
+{
+    Gia_HashTab_t * pTab = ABC_CALLOC( Gia_HashTab_t, 1 );
+    assert( (nSize & (nSize - 1)) == 0 );
+    pTab->nSize = nSize;
+    pTab->pKeys = ABC_CALLOC( word, nSize );
+    pTab->pIds  = ABC_CALLOC( int, nSize );
+    return pTab;
+}
+static void Gia_HashTabFree( Gia_HashTab_t * pTab )
+{
+    ABC_FREE( pTab->pKeysOld );
+    ABC_FREE( pTab->pIdsOld );
+    ABC_FREE( pTab->pKeys );
+    ABC_FREE( pTab->pIds );
+    ABC_FREE( pTab );
+}
+// moves the given number of slots of the old table into the new one
+static void Gia_HashTabMigrate( Gia_HashTab_t * pTab, int nSlots )
+{
+    int i, iSlot, iStop = Abc_MinInt( pTab->iMoveNext + nSlots, pTab->nSizeOld );
+    for ( i = pTab->iMoveNext; i < iStop; i++ )
+    {
+        if ( pTab->pKeysOld[i] == 0 )
+            continue;
+        iSlot = Gia_HashTabSlot( pTab->pKeys, pTab->nSize, pTab->pKeysOld[i] );
+        assert( pTab->pKeys[iSlot] == 0 );
+        pTab->pKeys[iSlot] = pTab->pKeysOld[i];
+        pTab->pIds[iSlot]  = pTab->pIdsOld[i];
+    }
+    pTab->iMoveNext = iStop;
+    if ( pTab->iMoveNext < pTab->nSizeOld )
+        return;
+    ABC_FREE( pTab->pKeysOld );
+    ABC_FREE( pTab->pIdsOld );
+    pTab->nSizeOld = 0;
+}
+// doubles the table; the entries are moved gradually by the following insertions
+static void Gia_HashTabGrow( Gia_HashTab_t * pTab )
+{
+    assert( !pTab->fConcurrent );
+    if ( pTab->pKeysOld )
+        Gia_HashTabMigrate( pTab, pTab->nSizeOld );
+    pTab->pKeysOld  = pTab->pKeys;
+    pTab->pIdsOld   = pTab->pIds;
+    pTab->nSizeOld  = pTab->nSize;
+    pTab->iMoveNext = 0;
+    pTab->nSize    *= 2;
+    pTab->pKeys     = ABC_CALLOC( word, pTab->nSize );
+    pTab->pIds      = ABC_CALLOC( int, pTab->nSize );
+}
+// returns the node ID if the node is in the table, or 0 otherwise
+static inline int Gia_HashTabLookup( Gia_HashTab_t * pTab, int iLit0, int iLit1 )
+{
+    word Key = Gia_HashTabKey( iLit0, iLit1 );
+    int iSlot;
+    if ( pTab->fConcurrent )
+    {
+        volatile word * pKeys = (volatile word *)pTab->pKeys;
+        volatile int * pIds = (volatile int *)pTab->pIds;
+        for ( iSlot = Gia_HashTabStart( Key, pTab->nSize ); pKeys[iSlot]; iSlot = (iSlot + 1) & (pTab->nSize - 1) )
+            if ( pKeys[iSlot] == Key )
+            {
+                while ( pIds[iSlot] == 0 );
+                return pIds[iSlot];
+            }
+        return 0;
+    }
+    iSlot = Gia_HashTabSlot( pTab->pKeys, pTab->nSize, Key );
+    if ( pTab->pKeys[iSlot] )
+        return pTab->pIds[iSlot];
+    if ( pTab->pKeysOld == NULL )
+        return 0;
+    iSlot = Gia_HashTabSlot( pTab->pKeysOld, pTab->nSizeOld, Key );
+    return pTab->pKeysOld[iSlot] ? pTab->pIdsOld[iSlot] : 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hashes AND gate using the open-addressing table.]
+
+  Description [The literals are ordered (iLit0 < iLit1) and the trivial
+  cases are already handled by the caller.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef GIA_HASH_ATOMICS
+static int Gia_ManHashAndOpenMt( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+    Gia_HashTab_t * pTab = p->pHashTab;
+    volatile word * pKeys = (volatile word *)pTab->pKeys;
+    volatile int * pIds = (volatile int *)pTab->pIds;
+    word KeyThis, Key = Gia_HashTabKey( iLit0, iLit1 );
+    int iSlot = Gia_HashTabStart( Key, pTab->nSize );
+    while ( 1 )
+    {
+        KeyThis = pKeys[iSlot];
+        if ( KeyThis == 0 )
+        {
+            if ( Gia_AtomicCas64( pTab->pKeys + iSlot, (word)0, Key ) )
+            {
+                // the slot is reserved; create the node and publish its ID
+                int iObj = Gia_AtomicAdd( &p->nObjs, 1 );
+                Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+                if ( iObj >= p->nObjsAlloc )
+                    printf( "The object limit (%d) of the concurrent hash table is reached. Quitting...\n", p->nObjsAlloc ), exit(1);
+                pObj->iDiff0  = (unsigned)(iObj - Abc_Lit2Var(iLit0));
+                pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
+                pObj->iDiff1  = (unsigned)(iObj - Abc_Lit2Var(iLit1));
+                pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+                Gia_AtomicBarrier();
+                pIds[iSlot] = iObj;
+                Gia_AtomicAdd( &pTab->nEntries, 1 );
+                Gia_AtomicAdd( &p->nHashMiss, 1 );
+                return Abc_Var2Lit( iObj, 0 );
+            }
+            // another thread has taken this slot
+            KeyThis = pKeys[iSlot];
+        }
+        if ( KeyThis == Key )
+        {
+            while ( pIds[iSlot] == 0 );
+            Gia_AtomicAdd( &p->nHashHit, 1 );
+            return Abc_Var2Lit( pIds[iSlot], 0 );
+        }
+        iSlot = (iSlot + 1) & (pTab->nSize - 1);
+    }
+    assert( 0 );
+    return -1;
+}
+#endif
+static int Gia_ManHashAndOpen( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+    Gia_HashTab_t * pTab = p->pHashTab;
+    word Key = Gia_HashTabKey( iLit0, iLit1 );
+    int iSlot, iObj;
+    assert( iLit0 < iLit1 );
+#ifdef GIA_HASH_ATOMICS
+    if ( pTab->fConcurrent )
+        return Gia_ManHashAndOpenMt( p, iLit0, iLit1 );
+#endif
+    if ( pTab->pKeysOld )
+    {
+        Gia_HashTabMigrate( pTab, GIA_HASH_MOVE );
+        if ( pTab->pKeysOld )
+        {
+            iSlot = Gia_HashTabSlot( pTab->pKeysOld, pTab->nSizeOld, Key );
+            if ( pTab->pKeysOld[iSlot] )
+            {
+                p->nHashHit++;
+                return Abc_Var2Lit( pTab->pIdsOld[iSlot], 0 );
+            }
+        }
+    }
+    iSlot = Gia_HashTabSlot( pTab->pKeys, pTab->nSize, Key );
+    if ( pTab->pKeys[iSlot] )
+    {
+        p->nHashHit++;
+        return Abc_Var2Lit( pTab->pIds[iSlot], 0 );
+    }
+    p->nHashMiss++;
+    iObj = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
+    pTab->pKeys[iSlot] = Key;
+    pTab->pIds[iSlot]  = iObj;
+    if ( 4 * ++pTab->nEntries > 3 * pTab->nSize )
+        Gia_HashTabGrow( pTab );
+    return Abc_Var2Lit( iObj, 0 );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -82,6 +321,8 @@ int Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int iLit1 )
 {
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    if ( p->pHashTab )
+        return Abc_Var2Lit( Gia_HashTabLookup( p->pHashTab, iLit0, iLit1 ), 0 );
     return Abc_Var2Lit( *Gia_ManHashFind( p, iLit0, iLit1, -1 ), 0 );
 }
 int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
@@ -150,6 +391,72 @@ void Gia_ManHashStop( Gia_Man_t * p )
 {
     Vec_IntErase( &p->vHTable );
     Vec_IntErase( &p->vHash );
+    if ( p->pHashTab )
+        Gia_HashTabFree( p->pHashTab );
+    p->pHashTab = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the open-addressing hash table.]
+
+  Description [The table is used by Gia_ManHashAnd() instead of the
+  chained one until Gia_ManHashStop() is called. When nObjsMax is 0,
+  the table is used by one thread and resized incrementally: after the
+  table is doubled, each insertion moves a few entries of the old table,
+  which is searched until it is empty. When nObjsMax is positive, the
+  object storage is allocated for this many objects and the table is
+  sized once, so that Gia_ManHashAnd() can be called by several threads
+  at the same time. In this case, a thread reserves an empty slot using
+  compare-and-swap, creates the node, and publishes its ID; the threads
+  looking for the same node wait till the ID appears. The IDs of the new
+  nodes depend on the thread scheduling. The features updated by
+  Gia_ManAppendAnd() (fanouts, sweeping, simulation) are not supported
+  in the concurrent mode. MUX nodes are not supported in both modes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManHashStartOpen( Gia_Man_t * p, int nObjsMax )
+{
+    Gia_Obj_t * pObj;
+    int i, iSlot, nSize = 1 << 12;
+    assert( p->pHashTab == NULL );
+    assert( Vec_IntSize(&p->vHTable) == 0 );
+    assert( p->pMuxes == NULL );
+    // similar to Gia_ManHashAlloc(), the allocated object storage is a hint for the table size
+    while ( 3 * nSize < 4 * Abc_MaxInt(nObjsMax, Gia_ManAndNum(p) ? Gia_ManAndNum(p) : p->nObjsAlloc) )
+        nSize *= 2;
+    p->pHashTab = Gia_HashTabAlloc( nSize );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( Gia_ObjIsBuf(pObj) )
+            continue;
+        iSlot = Gia_HashTabSlot( p->pHashTab->pKeys, nSize, Gia_HashTabKey(Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i)) );
+        assert( p->pHashTab->pKeys[iSlot] == 0 );
+        p->pHashTab->pKeys[iSlot] = Gia_HashTabKey( Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i) );
+        p->pHashTab->pIds[iSlot]  = i;
+        p->pHashTab->nEntries++;
+    }
+#ifdef GIA_HASH_ATOMICS
+    if ( nObjsMax > 0 )
+    {
+        assert( !p->pFanData && !p->fSweeper && !p->fBuiltInSim && !p->vSuppWords && !p->fAddStrash && !p->fGiaSimple );
+        if ( p->nObjsAlloc < nObjsMax )
+        {
+            p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjsMax );
+            memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjsMax - p->nObjsAlloc) );
+            p->nObjsAlloc = nObjsMax;
+        }
+        p->pHashTab->fConcurrent = 1;
+    }
+#endif
+}
+int Gia_ManHashIsConcurrent( Gia_Man_t * p )
+{
+    return p->pHashTab != NULL && p->pHashTab->fConcurrent;
 }
 
 /**Function*************************************************************
@@ -208,6 +515,12 @@ void Gia_ManHashProfile( Gia_Man_t * p )
 {
     int iEntry;
     int i, Counter, Limit;
+    if ( p->pHashTab )
+    {
+        printf( "Open table size = %d. Entries = %d. ", p->pHashTab->nSize, p->pHashTab->nEntries );
+        printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
+        return;
+    }
     printf( "Table size = %d. Entries = %d. ", Vec_IntSize(&p->vHTable), Gia_ManAndNum(p) );
     printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
     Limit = Abc_MinInt( 1000, Vec_IntSize(&p->vHTable) );
@@ -470,6 +783,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
 { 
     int fCompl = 0;
     assert( p->fAddStrash == 0 );
+    assert( p->pHashTab == NULL );
     if ( iLit0 < 2 )
         return iLit0 ? Abc_LitNot(iLit1) : iLit1;
     if ( iLit1 < 2 )
@@ -522,6 +836,7 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
 {
     int fCompl = 0;
     assert( p->fAddStrash == 0 );
+    assert( p->pHashTab == NULL );
     if ( iLitC < 2 )
         return iLitC ? iLit1 : iLit0;
     if ( iLit0 < 2 )
@@ -588,7 +903,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         assert( Vec_IntSize(&p->vHTable) == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
+    if ( p->pHashTab == NULL && (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
         Gia_ManHashResize( p );
     if ( p->fAddStrash )
     {
@@ -598,6 +913,8 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
     }
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    if ( p->pHashTab )
+        return Gia_ManHashAndOpen( p, iLit0, iLit1 );
     {
         int * pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
         if ( *pPlace )
@@ -623,6 +940,37 @@ int Gia_ManHashOr( Gia_Man_t * p, int iLit0, int iLit1 )
     return Abc_LitNot(Gia_ManHashAnd( p, Abc_LitNot(iLit0), Abc_LitNot(iLit1) ));
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Hashes a batch of AND gates.]
+
+  Description [The fanin literals of the i-th gate are pFans[2*i] and
+  pFans[2*i+1]; they should not refer to the gates of the same batch.
+  The resulting literals are written into pRes. With the open-addressing
+  table, the slots of the following gates are prefetched while the
+  current gate is hashed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManHashAndBatch( Gia_Man_t * p, int * pFans, int nPairs, int * pRes )
+{
+    Gia_HashTab_t * pTab = p->pHashTab;
+    int i, iLit0, iLit1;
+    for ( i = 0; i < nPairs; i++ )
+    {
+        if ( pTab && i + GIA_HASH_AHEAD < nPairs )
+        {
+            iLit0 = Abc_MinInt( pFans[2*(i+GIA_HASH_AHEAD)], pFans[2*(i+GIA_HASH_AHEAD)+1] );
+            iLit1 = Abc_MaxInt( pFans[2*(i+GIA_HASH_AHEAD)], pFans[2*(i+GIA_HASH_AHEAD)+1] );
+            Gia_Prefetch( pTab->pKeys + Gia_HashTabStart(Gia_HashTabKey(iLit0, iLit1), pTab->nSize) );
+        }
+        pRes[i] = Gia_ManHashAnd( p, pFans[2*i], pFans[2*i+1] );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -646,6 +994,11 @@ int Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    if ( p->pHashTab )
+    {
+        int iObj = Gia_HashTabLookup( p->pHashTab, iLit0, iLit1 );
+        return iObj ? Abc_Var2Lit( iObj, 0 ) : -1;
+    }
     {
         int * pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
         if ( *pPlace ) 
@@ -769,6 +1122,171 @@ Gia_Man_t * Gia_ManRehash( Gia_Man_t * p, int fAddStrash )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Rehashes AIG using several threads.]
+
+  Description [The AND nodes are rehashed level by level. The nodes of
+  one level are split into contiguous ranges processed by the threads,
+  which share the concurrent open-addressing table of the new manager.
+  The resulting AIG is structurally the same as the one produced by
+  Gia_ManRehash() but the order of the nodes may differ. When nProcs is 1,
+  the nodes are rehashed by the calling thread using the resizable
+  open-addressing table.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+#define PAR_THR_MAX 100
+
+typedef struct Gia_HashThData_t_
+{
+    Gia_Man_t * p;           // the old manager
+    Gia_Man_t * pNew;        // the new manager
+    Vec_Int_t * vNodes;      // nodes of the current level
+    int         iStart;      // the first node to rehash
+    int         iStop;       // the node after the last one to rehash
+    int         fWorking;    // the thread is busy
+} Gia_HashThData_t;
+
+void * Gia_ManRehashWorkerThread( void * pArg )
+{
+    Gia_HashThData_t * pThData = (Gia_HashThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    Gia_Obj_t * pObj;
+    int i;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->vNodes == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        for ( i = pThData->iStart; i < pThData->iStop; i++ )
+        {
+            pObj = Gia_ManObj( pThData->p, Vec_IntEntry(pThData->vNodes, i) );
+            pObj->Value = Gia_ManHashAnd( pThData->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        }
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+void Gia_ManRehashLevelsPar( Gia_Man_t * p, Gia_Man_t * pNew, int nProcs )
+{
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Gia_HashThData_t ThData[PAR_THR_MAX];
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    Gia_Obj_t * pObj;
+    int i, k, t, status, nPerThread, fRunning;
+    assert( Gia_ManHashIsConcurrent(pNew) );
+    nProcs = Abc_MinInt( nProcs, PAR_THR_MAX );
+    // collect the nodes by level
+    vLevels = Vec_WecStart( Gia_ManLevelNum(p) + 1 );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_WecPush( vLevels, Gia_ObjLevelId(p, i), i );
+    // start the threads
+    for ( t = 0; t < nProcs; t++ )
+    {
+        ThData[t].p        = p;
+        ThData[t].pNew     = pNew;
+        ThData[t].vNodes   = NULL;
+        ThData[t].iStart   = 0;
+        ThData[t].iStop    = 0;
+        ThData[t].fWorking = 0;
+        status = pthread_create( WorkerThread + t, NULL, Gia_ManRehashWorkerThread, (void *)(ThData + t) );  assert( status == 0 );
+    }
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        // small levels are not worth distributing
+        if ( Vec_IntSize(vLevel) < 64 * nProcs )
+        {
+            Gia_ManForEachObjVec( vLevel, p, pObj, k )
+                pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            continue;
+        }
+        nPerThread = (Vec_IntSize(vLevel) + nProcs - 1) / nProcs;
+        for ( t = 0; t < nProcs; t++ )
+        {
+            ThData[t].vNodes = vLevel;
+            ThData[t].iStart = Abc_MinInt( t * nPerThread, Vec_IntSize(vLevel) );
+            ThData[t].iStop  = Abc_MinInt( (t + 1) * nPerThread, Vec_IntSize(vLevel) );
+        }
+        for ( t = 0; t < nProcs; t++ )
+            if ( ThData[t].iStart < ThData[t].iStop )
+                ThData[t].fWorking = 1;
+        // wait till the threads finish
+        for ( fRunning = 1; fRunning; )
+        {
+            fRunning = 0;
+            for ( t = 0; t < nProcs; t++ )
+                if ( ThData[t].fWorking )
+                    fRunning = 1;
+        }
+    }
+    // stop the threads
+    for ( t = 0; t < nProcs; t++ )
+    {
+        assert( !ThData[t].fWorking );
+        ThData[t].vNodes = NULL;
+        ThData[t].fWorking = 1;
+    }
+    for ( t = 0; t < nProcs; t++ )
+    {
+        status = pthread_join( WorkerThread[t], NULL );  assert( status == 0 );
+    }
+    Vec_WecFree( vLevels );
+}
+
+#endif // pthreads are used
+
+Gia_Man_t * Gia_ManRehashPar( Gia_Man_t * p, int nProcs, int fVerbose )
+{
+    Gia_Man_t * pNew, * pTemp;
+    Gia_Obj_t * pObj;
+    int i;
+    abctime clk = Abc_Clock();
+    assert( p->pMuxes == NULL );
+#ifndef ABC_USE_PTHREADS
+    nProcs = 1;
+#endif
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManHashStartOpen( pNew, nProcs > 1 ? Gia_ManObjNum(p) : 0 );
+#ifdef ABC_USE_PTHREADS
+    if ( Gia_ManHashIsConcurrent(pNew) )
+        Gia_ManRehashLevelsPar( p, pNew, nProcs );
+    else
+#endif
+    Gia_ManForEachAnd( p, pObj, i )
+        pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManForEachCo( p, pObj, i )
+        pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    if ( fVerbose )
+    {
+        printf( "Rehashed %d nodes using %d thread(s). ", Gia_ManAndNum(p), Gia_ManHashIsConcurrent(pNew) ? nProcs : 1 );
+        Gia_ManHashProfile( pNew );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Gia_ManHashStop( pNew );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates well-balanced AND gate.]
@@ -63,6 +63,8 @@ Gia_Man_t * Gia_ManStart( int nObjsMax )
     p->nObjs = 1;
     p->vCis  = Vec_IntAlloc( nObjsMax / 20 );
     p->vCos  = Vec_IntAlloc( nObjsMax / 20 );
+    if ( Gia_ManSoaIsDefault() )
+        Gia_ManSoaStart( p );
     return p;
 }
 
@@ -82,6 +84,7 @@ void Gia_ManStop( Gia_Man_t * p )
     if ( p->vSeqModelVec )
         Vec_PtrFreeFree( p->vSeqModelVec );
     Gia_ManStaticFanoutStop( p );
+    Gia_ManCutDbStop( p );
     Tim_ManStopP( (Tim_Man_t **)&p->pManTime );
     assert( p->pManTime == NULL );
     Vec_PtrFreeFree( p->vNamesIn );
@@ -89,6 +92,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Vec_IntFreeP( &p->vSwitching );
     Vec_IntFreeP( &p->vSuper );
     Vec_IntFreeP( &p->vStore );
+    Vec_IntFreeP( &p->vFanLits );
     Vec_IntFreeP( &p->vClassNew );
     Vec_IntFreeP( &p->vClassOld );
     Vec_WrdFreeP( &p->vSims );
@@ -144,8 +148,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Gia_ManStopP( &p->pAigExtra );
     Vec_IntFree( p->vCis );
     Vec_IntFree( p->vCos );
-    Vec_IntErase( &p->vHash );
-    Vec_IntErase( &p->vHTable );
+    Gia_ManHashStop( p );
     Vec_IntErase( &p->vRefs );
     ABC_FREE( p->pData2 );
     ABC_FREE( p->pTravIds );
@@ -72,6 +72,7 @@ struct Mf_Man_t_
     Vec_Int_t       vCnfSizes;      // handles to CNF
     Vec_Int_t       vCnfMem;        // memory for CNF
     Vec_Int_t       vTemp;          // temporary array
+    Gia_CutDb_t *   pCutDb;         // shared cut database
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
@@ -1020,6 +1021,16 @@ static inline void Mf_CutParams( Mf_Man_t * p, Mf_Cut_t * pCut, float FlowRefs )
     pCut->Delay += (int)(nLeaves > 1);
     pCut->Flow = (pCut->Flow + Mf_CutArea(p, nLeaves, pCut->iFunc)) / FlowRefs;
 }
+static inline void Mf_ObjSaveCuts( Mf_Man_t * p, int iObj, Mf_Cut_t ** pCutsR, int nCutsR )
+{
+    Mf_Obj_t * pBest = Mf_ManObj(p, iObj);
+    assert( nCutsR > 0 && nCutsR < p->pPars->nCutNum );
+    pBest->Flow = pCutsR[0]->Flow;
+    pBest->Delay = pCutsR[0]->Delay;
+    pBest->iCutSet = Mf_ManSaveCuts( p, pCutsR, nCutsR );
+    p->nCutCounts[pCutsR[0]->nLeaves]++;
+    p->CutCount[3] += nCutsR;
+}
 void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
 {
     Mf_Cut_t pCuts0[MF_CUT_MAX], pCuts1[MF_CUT_MAX], pCuts[MF_CUT_MAX], * pCutsR[MF_CUT_MAX];
@@ -1108,15 +1119,48 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
             Mf_CutPrint( p, pCutsR[i] );
         printf( "\n" );
     } 
-    // store the cutset
-    pBest->Flow = pCutsR[0]->Flow;
-    pBest->Delay = pCutsR[0]->Delay;
-    pBest->iCutSet = Mf_ManSaveCuts( p, pCutsR, nCutsR );
-    // verify
-    assert( nCutsR > 0 && nCutsR < nCutNum );
 //    assert( Mf_SetCheckArray(pCutsR, nCutsR) );
-    p->nCutCounts[pCutsR[0]->nLeaves]++;
-    p->CutCount[3] += nCutsR;
+    Mf_ObjSaveCuts( p, iObj, pCutsR, nCutsR );
+    if ( p->pCutDb )
+        Gia_CutDbAddCutSet( p->pCutDb, iObj, Mf_ManCutSet(p, pBest->iCutSet), p->vTtMem );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the cut set from the shared cut database.]
+
+  Description [The cuts are re-evaluated and filtered in the same way
+  as the cuts derived by merging. Returns 0 if the cut set is not 
+  available in the database.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Mf_ObjLoadCuts( Mf_Man_t * p, int iObj )
+{
+    Mf_Cut_t pCuts[MF_CUT_MAX], * pCutsR[MF_CUT_MAX];
+    Mf_Obj_t * pBest = Mf_ManObj(p, iObj);
+    int nCutNum  = p->pPars->nCutNum;
+    int i, * pCut, nCutsR = 0;
+    int * pList  = Gia_CutDbObjCuts( p->pCutDb, iObj, p->vTtMem );
+    if ( pList == NULL )
+        return 0;
+    for ( i = 0; i < nCutNum; i++ )
+        pCutsR[i] = pCuts + i;
+    Mf_SetForEachCut( pList, pCut, i )
+    {
+        Mf_Cut_t * pCutR = pCutsR[nCutsR];
+        pCutR->iFunc   = Mf_CutFunc( pCut );
+        pCutR->nLeaves = Mf_CutSize( pCut );
+        pCutR->Sign    = Mf_CutGetSign( pCut+1, Mf_CutSize(pCut) );
+        memcpy( pCutR->pLeaves, pCut+1, sizeof(int) * Mf_CutSize(pCut) );
+        Mf_CutParams( p, pCutR, pBest->nFlowRefs );
+        nCutsR = Mf_SetAddCut( pCutsR, nCutsR, nCutNum );
+    }
+    Mf_ObjSaveCuts( p, iObj, pCutsR, nCutsR );
+    return 1;
 }
  
 
@@ -1525,7 +1569,10 @@ void Mf_ManComputeCuts( Mf_Man_t * p )
 {
     int i;
     Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjMergeOrder( p, i );
+        if ( p->pCutDb == NULL || !Mf_ObjLoadCuts(p, i) )
+            Mf_ObjMergeOrder( p, i );
+    if ( p->pCutDb && p->pPars->fVerbose )
+        Gia_CutDbPrintStats( p->pCutDb );
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
@@ -1663,6 +1710,8 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
     pCls = pPars->fCoarsen ? Gia_ManDupMuxes(pGia, pPars->nCoarseLimit) : pGia;
     p = Mf_ManAlloc( pCls, pPars );
     p->pGia0 = pGia;
+    if ( pPars->fUseCutDb && !pPars->fGenCnf )
+        p->pCutDb = Gia_ManCutDbPrepare( pGia, pCls, pPars->nLutSize, pPars->nCutNum, pPars->fCutMin, pPars->fVerbose );
     if ( pPars->fVerbose && pPars->fCoarsen )
     {
         printf( "Initial " );  Gia_ManPrintMuxStats( pGia );  printf( "\n" );
@@ -1689,6 +1738,8 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
 //        Mf_ManProfileTruths( p );
     Gia_ManMappingVerify( pNew );
     Mf_ManPrintQuit( p, pNew );
+    if ( p->pCutDb )
+        Gia_ManCutDbTransfer( pGia, pNew );
     Mf_ManFree( p );
     if ( pCls != pGia )
         Gia_ManStop( pCls );
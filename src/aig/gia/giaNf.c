@@ -98,6 +98,7 @@ struct Nf_Man_t_
     Vec_Flt_t       vCutFlows;      // temporary cut area
     Vec_Int_t       vCutDelays;     // temporary cut delay
     Vec_Int_t       vBackup;        // backup literals
+    Gia_CutDb_t *   pCutDb;         // shared cut database
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
@@ -852,6 +853,19 @@ static inline void Nf_CutParams( Nf_Man_t * p, Nf_Cut_t * pCut, float FlowRefs )
     pCut->Delay += (int)(nLeaves > 1);
     pCut->Flow = (pCut->Flow + Nf_CutArea(p, nLeaves)) / FlowRefs;
 }
+static inline void Nf_ObjSaveCuts( Nf_Man_t * p, int iObj, Nf_Cut_t ** pCutsR, int nCutsR )
+{
+    int nCutsUse;
+    assert( nCutsR > 0 && nCutsR < p->pPars->nCutNum );
+    Nf_ObjSetCutFlow( p, iObj, pCutsR[0]->Flow );
+    Nf_ObjSetCutDelay( p, iObj, pCutsR[0]->Delay );
+    *Vec_IntEntryP(&p->vCutSets, iObj) = Nf_ManSaveCuts(p, pCutsR, nCutsR, 0);
+    p->CutCount[3] += nCutsR;
+    nCutsUse = Nf_ManCountUseful(pCutsR, nCutsR);
+    p->CutCount[4] += nCutsUse;
+    p->nCutUseAll  += nCutsUse == nCutsR;
+    p->CutCount[5] += Nf_ManCountMatches(p, pCutsR, nCutsR);
+}
 void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
 {
     Nf_Cut_t pCuts0[NF_CUT_MAX], pCuts1[NF_CUT_MAX], pCuts[NF_CUT_MAX], * pCutsR[NF_CUT_MAX];
@@ -866,7 +880,7 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     int fComp1   = Gia_ObjFaninC1(pObj);
     int iSibl    = Gia_ObjSibl(p->pGia, iObj);
     Nf_Cut_t * pCut0, * pCut1, * pCut0Lim = pCuts0 + nCuts0, * pCut1Lim = pCuts1 + nCuts1;
-    int i, nCutsUse, nCutsR = 0;
+    int i, nCutsR = 0;
     assert( !Gia_ObjIsBuf(pObj) );
     for ( i = 0; i < nCutNum; i++ )
         pCutsR[i] = pCuts + i;
@@ -941,18 +955,35 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
             Nf_CutPrint( p, pCutsR[i] );
         printf( "\n" );
     } 
-    // verify
-    assert( nCutsR > 0 && nCutsR < nCutNum );
 //    assert( Nf_SetCheckArray(pCutsR, nCutsR) );
-    // store the cutset
-    Nf_ObjSetCutFlow( p, iObj, pCutsR[0]->Flow );
-    Nf_ObjSetCutDelay( p, iObj, pCutsR[0]->Delay );
-    *Vec_IntEntryP(&p->vCutSets, iObj) = Nf_ManSaveCuts(p, pCutsR, nCutsR, 0);
-    p->CutCount[3] += nCutsR;
-    nCutsUse = Nf_ManCountUseful(pCutsR, nCutsR);
-    p->CutCount[4] += nCutsUse;
-    p->nCutUseAll  += nCutsUse == nCutsR;
-    p->CutCount[5] += Nf_ManCountMatches(p, pCutsR, nCutsR);
+    Nf_ObjSaveCuts( p, iObj, pCutsR, nCutsR );
+    if ( p->pCutDb )
+        Gia_CutDbAddCutSet( p->pCutDb, iObj, Nf_ObjCutSet(p, iObj), p->vTtMem );
+}
+int Nf_ObjLoadCuts( Nf_Man_t * p, int iObj )
+{
+    Nf_Cut_t pCuts[NF_CUT_MAX], * pCutsR[NF_CUT_MAX];
+    float dFlowRefs  = Nf_ObjFlowRefs(p, iObj, 0) + Nf_ObjFlowRefs(p, iObj, 1);
+    int nCutNum  = p->pPars->nCutNum;
+    int i, * pCut, nCutsR = 0;
+    int * pList  = Gia_CutDbObjCuts( p->pCutDb, iObj, p->vTtMem );
+    if ( pList == NULL )
+        return 0;
+    for ( i = 0; i < nCutNum; i++ )
+        pCutsR[i] = pCuts + i;
+    Nf_SetForEachCut( pList, pCut, i )
+    {
+        Nf_Cut_t * pCutR = pCutsR[nCutsR];
+        pCutR->iFunc   = Nf_CutFunc( pCut );
+        pCutR->nLeaves = Nf_CutSize( pCut );
+        pCutR->Sign    = Nf_CutGetSign( pCut+1, Nf_CutSize(pCut) );
+        pCutR->Useless = Nf_ObjCutUseless( p, Abc_Lit2Var(pCutR->iFunc) );
+        memcpy( pCutR->pLeaves, pCut+1, sizeof(int) * Nf_CutSize(pCut) );
+        Nf_CutParams( p, pCutR, dFlowRefs );
+        nCutsR = Nf_SetAddCut( pCutsR, nCutsR, nCutNum );
+    }
+    Nf_ObjSaveCuts( p, iObj, pCutsR, nCutsR );
+    return 1;
 }
 void Nf_ManComputeCuts( Nf_Man_t * p )
 {
@@ -964,8 +995,10 @@ void Nf_ManComputeCuts( Nf_Man_t * p )
             Nf_ObjSetCutFlow( p, i,  Nf_ObjCutFlow(p, iFanin) );
             Nf_ObjSetCutDelay( p, i, Nf_ObjCutDelay(p, iFanin) );
         }
-        else
+        else if ( p->pCutDb == NULL || !Nf_ObjLoadCuts(p, i) )
             Nf_ObjMergeOrder( p, i );
+    if ( p->pCutDb && p->pPars->fVerbose )
+        Gia_CutDbPrintStats( p->pCutDb );
 }
 
 
@@ -2370,6 +2403,8 @@ Gia_Man_t * Nf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p = Nf_StoCreate( pCls, pPars );
     if ( p == NULL )
         return NULL;
+    if ( pPars->fUseCutDb )
+        p->pCutDb = Gia_ManCutDbPrepare( pGia, pCls, pPars->nLutSize, pPars->nCutNum, 1, pPars->fVerbose );
 //    if ( pPars->fVeryVerbose )
 //        Nf_StoPrint( p, pPars->fVeryVerbose );
     if ( pPars->fVerbose && pPars->fCoarsen )
@@ -2414,6 +2449,8 @@ Gia_Man_t * Nf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
         Sbm_ManTestSat( p );
     }
 */
+    if ( p->pCutDb && pNew )
+        Gia_ManCutDbTransfer( pGia, pNew );
     Nf_StoDelete( p );
     return pNew;
 }
@@ -145,14 +145,14 @@ satoko_t * Gia_ManSatokoFromDimacs( char * pFileName, satoko_opts_t * opts )
     Vec_IntFree( vLits );
     return pSat;
 }
-void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts )
+void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts, int nProcs )
 {
     abctime clk = Abc_Clock();  
     int status = SATOKO_UNSAT;
     satoko_t * pSat = Gia_ManSatokoFromDimacs( pFileName, opts );
     if ( pSat )
     {
-        status = satoko_solve( pSat );
+        status = satoko_solve_parallel( pSat, nProcs );
         satoko_destroy( pSat );
     }
     Gia_ManSatokoReport( -1, status, Abc_Clock() - clk );
@@ -196,7 +196,7 @@ satoko_t * Gia_ManSatokoCreate( Gia_Man_t * p, satoko_opts_t * opts )
     satoko_destroy( pSat );
     return NULL;
 }
-int Gia_ManSatokoCallOne( Gia_Man_t * p, satoko_opts_t * opts, int iOutput )
+int Gia_ManSatokoCallOne( Gia_Man_t * p, satoko_opts_t * opts, int iOutput, int nProcs )
 {
     abctime clk = Abc_Clock();
     satoko_t * pSat;
@@ -204,14 +204,14 @@ int Gia_ManSatokoCallOne( Gia_Man_t * p, satoko_opts_t * opts, int iOutput )
     pSat = Gia_ManSatokoCreate( p, opts );
     if ( pSat )
     {
-        status = satoko_solve( pSat );
+        status = satoko_solve_parallel( pSat, nProcs );
         Cost = satoko_stats(pSat)->n_conflicts;
         satoko_destroy( pSat );
     }
     Gia_ManSatokoReport( iOutput, status, Abc_Clock() - clk );
     return Cost;
 }
-void Gia_ManSatokoCall( Gia_Man_t * p, satoko_opts_t * opts, int fSplit, int fIncrem )
+void Gia_ManSatokoCall( Gia_Man_t * p, satoko_opts_t * opts, int fSplit, int fIncrem, int nProcs )
 {
     int fUseCone = 1;
     Gia_Man_t * pOne;
@@ -233,13 +233,13 @@ void Gia_ManSatokoCall( Gia_Man_t * p, satoko_opts_t * opts, int fSplit, int fIn
                 vCone = Gia_ManCollectVars( i+1, pCnf->vMapping, pCnf->nVars );
                 satoko_mark_cone( pSat, Vec_IntArray(vCone), Vec_IntSize(vCone) );
                 printf( "Cone has %6d vars (out of %6d).  ", Vec_IntSize(vCone), pCnf->nVars );
-                status = satoko_solve( pSat );
+                status = satoko_solve_parallel( pSat, nProcs );
                 satoko_unmark_cone( pSat, Vec_IntArray(vCone), Vec_IntSize(vCone) );
                 Vec_IntFree( vCone );
             }
             else
             {
-                status = satoko_solve( pSat );
+                status = satoko_solve_parallel( pSat, nProcs );
             }
             satoko_assump_pop( pSat );
             Gia_ManSatokoReport( i, status, Abc_Clock() - clk );
@@ -255,13 +255,13 @@ void Gia_ManSatokoCall( Gia_Man_t * p, satoko_opts_t * opts, int fSplit, int fIn
         Gia_ManForEachCo( p, pRoot, i )
         {
             pOne = Gia_ManDupDfsCone( p, pRoot );
-            Gia_ManSatokoCallOne( pOne, opts, i );
+            Gia_ManSatokoCallOne( pOne, opts, i, nProcs );
             Gia_ManStop( pOne );
         }
         Abc_PrintTime( 1, "Total time", Abc_Clock() - clk );
         return;
     }
-    Gia_ManSatokoCallOne( p, opts, -1 );
+    Gia_ManSatokoCallOne( p, opts, -1, nProcs );
 }    
 
 
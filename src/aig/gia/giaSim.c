@@ -21,6 +21,17 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -36,6 +47,12 @@ unsigned * Gia_SimDataExt( Gia_ManSim_t * p, int i )    { return Gia_SimData(p,
 unsigned * Gia_SimDataCiExt( Gia_ManSim_t * p, int i )  { return Gia_SimDataCi(p, i);  }
 unsigned * Gia_SimDataCoExt( Gia_ManSim_t * p, int i )  { return Gia_SimDataCo(p, i);  }
 
+// the size of the frontier (in bytes) simulated without splitting the patterns
+#define GIA_SIM_CACHE_SIZE (1 << 18)
+
+static void Gia_ManSimStartThreads( Gia_ManSim_t * p, int nProcs );
+static void Gia_ManSimStopThreads( Gia_ManSim_t * p );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -171,6 +188,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->RandSeed     =   0;    // the seed to generate random numbers
     p->TimeLimit    =  60;    // time limit in seconds
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
+    p->nProcs       =   1;    // the number of threads
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
 }
@@ -188,6 +206,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
 ***********************************************************************/
 void Gia_ManSimDelete( Gia_ManSim_t * p )
 {
+    Gia_ManSimStopThreads( p );
     Vec_IntFreeP( &p->vConsts );
     Vec_IntFreeP( &p->vCis2Ids );
     Gia_ManStopP( &p->pAig );
@@ -234,6 +253,8 @@ Gia_ManSim_t * Gia_ManSimCreate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     p->vCis2Ids = Vec_IntAlloc( Gia_ManCiNum(p->pAig) );
     Vec_IntForEachEntry( pAig->vCis, Entry, i )
         Vec_IntPush( p->vCis2Ids, i );  //  do we need p->vCis2Ids?
+    if ( pPars->nProcs > 1 )
+        Gia_ManSimStartThreads( p, pPars->nProcs );
     if ( pPars->fVerbose )
     Abc_Print( 1, "AIG = %7.2f MB.   Front mem = %7.2f MB.  Other mem = %7.2f MB.\n", 
         12.0*Gia_ManObjNum(p->pAig)/(1<<20), 
@@ -290,10 +311,10 @@ static inline void Gia_ManSimInfoZero( Gia_ManSim_t * p, unsigned * pInfo )
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManSimInfoIsZero( Gia_ManSim_t * p, unsigned * pInfo )
+static inline int Gia_ManSimInfoIsZero( Gia_ManSim_t * p, unsigned * pInfo, int iStart, int nWords )
 {
     int w;
-    for ( w = 0; w < p->nWords; w++ )
+    for ( w = iStart; w < iStart + nWords; w++ )
         if ( pInfo[w] )
             return 32*w + Gia_WordFindFirstBit( pInfo[w] );
     return -1;
@@ -346,15 +367,42 @@ static inline void Gia_ManSimInfoCopy( Gia_ManSim_t * p, unsigned * pInfo, unsig
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi )
+static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi, int iWord, int nWords )
 {
-    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_SimDataCi( p, iCi );
+    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) ) + iWord;
+    unsigned * pInfo0 = Gia_SimDataCi( p, iCi ) + iWord;
     int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
+    for ( w = nWords-1; w >= 0; w-- )
         pInfo[w] = pInfo0[w];
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the AND of two possibly complemented infos.]
+
+  Description [When the info consists of 64-bit words, the vectorized
+  kernel is used. Otherwise, complemented attributes are applied by
+  XOR-ing with masks rather than by branching.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_ManSimulateAnd( Gia_ManSim_t * p, unsigned * pInfo, unsigned * pInfo0, unsigned * pInfo1, int fCompl0, int fCompl1, int nWords )
+{
+    unsigned Mask0 = 0 - (unsigned)fCompl0;
+    unsigned Mask1 = 0 - (unsigned)fCompl1;
+    int w;
+    if ( (p->nWords & 1) == 0 )
+    {
+        Gia_SimdAnd( (word *)pInfo, (word *)pInfo0, (word *)pInfo1, fCompl0, fCompl1, nWords / 2 );
+        return;
+    }
+    for ( w = nWords-1; w >= 0; w-- )
+        pInfo[w] = (pInfo0[w] ^ Mask0) & (pInfo1[w] ^ Mask1);
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -366,17 +414,11 @@ static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iC
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj, int iWord, int nWords )
 {
-    unsigned * pInfo  = Gia_SimDataCo( p, iCo );
-    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = ~pInfo0[w];
-    else 
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = pInfo0[w];
+    unsigned * pInfo  = Gia_SimDataCo( p, iCo ) + iWord;
+    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) ) + iWord;
+    Gia_ManSimulateAnd( p, pInfo, pInfo0, pInfo0, Gia_ObjFaninC0(pObj), Gia_ObjFaninC0(pObj), nWords );
 }
 
 /**Function*************************************************************
@@ -390,30 +432,12 @@ static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pOb
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iWord, int nWords )
 {
-    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
-    unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~pInfo0[w] & pInfo1[w];
-    }
-    else 
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & ~pInfo1[w];
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & pInfo1[w];
-    }
+    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) ) + iWord;
+    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) ) + iWord;
+    unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) ) + iWord;
+    Gia_ManSimulateAnd( p, pInfo, pInfo0, pInfo1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nWords );
 }
 
 /**Function*************************************************************
@@ -473,52 +497,73 @@ void Gia_ManSimInfoTransfer( Gia_ManSim_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManSimulateRound( Gia_ManSim_t * p )
+void Gia_ManSimulateRoundInt( Gia_ManSim_t * p, int iWord, int nWords )
 {
     Gia_Obj_t * pObj;
     int i, iCis = 0, iCos = 0;
-    assert( p->pAig->nFront > 0 );
-    assert( Gia_ManConst0(p->pAig)->Value == 0 );
-    Gia_ManSimInfoZero( p, Gia_SimData(p, 0) );
     Gia_ManForEachObj1( p->pAig, pObj, i )
     {
         if ( Gia_ObjIsAndOrConst0(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateNode( p, pObj );
+            Gia_ManSimulateNode( p, pObj, iWord, nWords );
         }
         else if ( Gia_ObjIsCo(pObj) )
         {
             assert( Gia_ObjValue(pObj) == GIA_NONE );
-            Gia_ManSimulateCo( p, iCos++, pObj );
+            Gia_ManSimulateCo( p, iCos++, pObj, iWord, nWords );
         }
         else // if ( Gia_ObjIsCi(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateCi( p, pObj, iCis++ );
+            Gia_ManSimulateCi( p, pObj, iCis++, iWord, nWords );
         }
     }
     assert( Gia_ManCiNum(p->pAig) == iCis );
     assert( Gia_ManCoNum(p->pAig) == iCos );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates one timeframe for the given range of words.]
+
+  Description [When the frontier does not fit into the L2 cache, the 
+  patterns are split into blocks of words, and the AIG is simulated in 
+  the topological order for each block, so that the fanin info of the 
+  nodes is likely to be in the cache when it is used.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimulateRange( Gia_ManSim_t * p, int iStart, int nWords )
+{
+    int nBlock = (GIA_SIM_CACHE_SIZE / 4) / p->pAig->nFront;
+    int iWord;
+    // the block size is a multiple of 16 words to keep 64-byte alignment
+    nBlock = Abc_MaxInt( 16, nBlock & ~15 );
+    for ( iWord = iStart; iWord < iStart + nWords; iWord += nBlock )
+        Gia_ManSimulateRoundInt( p, iWord, Abc_MinInt(nBlock, iStart + nWords - iWord) );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns index of the PO and pattern that failed it.]
 
-  Description []
+  Description [Only the given range of words is checked.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManCheckPos( Gia_ManSim_t * p, int * piPo, int * piPat )
+static inline int Gia_ManCheckPosRange( Gia_ManSim_t * p, int iStart, int nWords, int * piPo, int * piPat )
 {
     int i, iPat;
     for ( i = 0; i < Gia_ManPoNum(p->pAig); i++ )
     {
-        iPat = Gia_ManSimInfoIsZero( p, Gia_SimDataCo(p, i) );
+        iPat = Gia_ManSimInfoIsZero( p, Gia_SimDataCo(p, i), iStart, nWords );
         if ( iPat >= 0 )
         {
             *piPo = i;
@@ -529,6 +574,227 @@ static inline int Gia_ManCheckPos( Gia_ManSim_t * p, int * piPo, int * piPat )
     return 0;
 }
 
+#ifndef ABC_USE_PTHREADS
+
+static void Gia_ManSimStartThreads( Gia_ManSim_t * p, int nProcs )                {}
+static void Gia_ManSimStopThreads( Gia_ManSim_t * p )                             {}
+static void Gia_ManSimulateRoundPar( Gia_ManSim_t * p )                            {}
+static int  Gia_ManCheckPosPar( Gia_ManSim_t * p, int * piPo, int * piPat )        { return 0; }
+
+#else // pthreads are used
+
+// the max number of threads used by the simulator
+#define GIA_SIM_THR_MAX 64
+
+// information given to the thread
+typedef struct Gia_SimThData_t_ Gia_SimThData_t;
+struct Gia_SimThData_t_
+{
+    Gia_ManSim_t * p;          // the simulation manager (NULL to stop the thread)
+    int            iStart;     // the first word simulated by the thread
+    int            nWords;     // the number of words simulated by the thread
+    int            iPo;        // the first failed PO in this range
+    int            iPat;       // the pattern that failed the PO
+    int            fWorking;   // the thread is busy
+    pthread_t      Thread;     // the thread
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one range of words for each timeframe.]
+
+  Description [After simulating the range, the thread finds the first
+  PO that failed in this range, if the outputs are checked.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_ManSimWorkerThread( void * pArg )
+{
+    Gia_SimThData_t * pThData = (Gia_SimThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->p == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Gia_ManSimulateRange( pThData->p, pThData->iStart, pThData->nWords );
+        pThData->iPo = pThData->iPat = -1;
+        if ( pThData->p->pPars->fCheckMiter )
+            Gia_ManCheckPosRange( pThData->p, pThData->iStart, pThData->nWords, &pThData->iPo, &pThData->iPat );
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the threads of the simulator.]
+
+  Description [The words are split into ranges, which are multiples of 16
+  words, except for the last one. The first range is simulated by the
+  calling thread, the other ranges are simulated by the worker threads.
+  The threads are kept running while the manager is used.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManSimStartThreads( Gia_ManSim_t * p, int nProcs )
+{
+    Gia_SimThData_t * pThData;
+    int i, status, nRange;
+    nProcs = Abc_MinInt( Abc_MinInt(nProcs, GIA_SIM_THR_MAX), (p->nWords + 15) / 16 );
+    if ( nProcs < 2 )
+        return;
+    nRange = ((p->nWords + nProcs - 1) / nProcs + 15) & ~15;
+    nProcs = (p->nWords + nRange - 1) / nRange;
+    if ( nProcs < 2 )
+        return;
+    // make sure the kernel is selected before the threads start
+    Gia_SimdLevel();
+    pThData = ABC_CALLOC( Gia_SimThData_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].p        = p;
+        pThData[i].iStart   = i * nRange;
+        pThData[i].nWords   = Abc_MinInt( nRange, p->nWords - i * nRange );
+        pThData[i].iPo      = -1;
+        pThData[i].iPat     = -1;
+        pThData[i].fWorking = 0;
+        if ( i == 0 )
+            continue;
+        status = pthread_create( &pThData[i].Thread, NULL, Gia_ManSimWorkerThread, (void *)(pThData + i) );  assert( status == 0 );
+    }
+    p->nThreads = nProcs;
+    p->pThData  = pThData;
+}
+static void Gia_ManSimStopThreads( Gia_ManSim_t * p )
+{
+    Gia_SimThData_t * pThData = (Gia_SimThData_t *)p->pThData;
+    int i, status;
+    if ( pThData == NULL )
+        return;
+    for ( i = 1; i < p->nThreads; i++ )
+    {
+        assert( !pThData[i].fWorking );
+        pThData[i].p = NULL;
+        pThData[i].fWorking = 1;
+    }
+    for ( i = 1; i < p->nThreads; i++ )
+    {
+        status = pthread_join( pThData[i].Thread, NULL );  assert( status == 0 );
+    }
+    ABC_FREE( p->pThData );
+    p->nThreads = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one timeframe using several threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManSimulateRoundPar( Gia_ManSim_t * p )
+{
+    Gia_SimThData_t * pThData = (Gia_SimThData_t *)p->pThData;
+    int i;
+    for ( i = 1; i < p->nThreads; i++ )
+    {
+        assert( !pThData[i].fWorking );
+        pThData[i].fWorking = 1;
+    }
+    Gia_ManSimulateRange( p, pThData[0].iStart, pThData[0].nWords );
+    pThData[0].iPo = pThData[0].iPat = -1;
+    if ( p->pPars->fCheckMiter )
+        Gia_ManCheckPosRange( p, pThData[0].iStart, pThData[0].nWords, &pThData[0].iPo, &pThData[0].iPat );
+    for ( i = 1; i < p->nThreads; i++ )
+        while ( *(volatile int *)&pThData[i].fWorking );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns index of the PO and pattern that failed it.]
+
+  Description [The POs have been checked by the threads after simulating
+  the last timeframe. The PO with the smallest index is returned, so that
+  the result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManCheckPosPar( Gia_ManSim_t * p, int * piPo, int * piPat )
+{
+    Gia_SimThData_t * pThData = (Gia_SimThData_t *)p->pThData;
+    int i;
+    *piPo = *piPat = -1;
+    for ( i = 0; i < p->nThreads; i++ )
+        if ( pThData[i].iPo >= 0 && (*piPo == -1 || pThData[i].iPo < *piPo) )
+        {
+            *piPo  = pThData[i].iPo;
+            *piPat = pThData[i].iPat;
+        }
+    return *piPo >= 0;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one timeframe.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimulateRound( Gia_ManSim_t * p )
+{
+    assert( p->pAig->nFront > 0 );
+    assert( Gia_ManConst0(p->pAig)->Value == 0 );
+    Gia_ManSimInfoZero( p, Gia_SimData(p, 0) );
+    if ( p->nThreads > 1 )
+        Gia_ManSimulateRoundPar( p );
+    else
+        Gia_ManSimulateRange( p, 0, p->nWords );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns index of the PO and pattern that failed it.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManCheckPos( Gia_ManSim_t * p, int * piPo, int * piPat )
+{
+    if ( p->nThreads > 1 )
+        return Gia_ManCheckPosPar( p, piPo, piPat );
+    return Gia_ManCheckPosRange( p, 0, p->nWords, piPo, piPat );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns the counter-example.]
@@ -654,6 +920,66 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Measures the throughput of the simulator.]
+
+  Description [Runs the same simulation with each SIMD level supported
+  by the CPU and reports the number of patterns times the number of AND
+  nodes simulated per second. Returns 0 if the results differ.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimBenchmark( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
+{
+    Gia_ParSim_t Pars = *pPars;
+    Gia_ManSim_t * p;
+    abctime clk;
+    word Sign, SignRef = 0;
+    int i, k, Level, LevelOld, RetValue = 1;
+    double Work = 32.0 * pPars->nWords * Gia_ManAndNum(pAig) * pPars->nIters;
+    // the runtime of one thread is measured
+    Pars.nProcs = 1;
+    p = Gia_ManSimCreate( pAig, &Pars );
+    if ( p == NULL )
+        return 0;
+    LevelOld = Gia_SimdLevel();
+    for ( Level = 0; Level <= Gia_SimdLevelMax(); Level++ )
+    {
+        Gia_SimdSetLevel( Level );
+        Gia_ManResetRandom( pPars );
+        Gia_ManSimInfoInit( p );
+        clk = Abc_Clock();
+        for ( i = 0; i < pPars->nIters; i++ )
+        {
+            Gia_ManSimulateRound( p );
+            if ( i < pPars->nIters - 1 )
+                Gia_ManSimInfoTransfer( p );
+        }
+        clk = Abc_Clock() - clk;
+        // compute the signature of the output info
+        Sign = 0;
+        for ( k = 0; k < pPars->nWords * Gia_ManCoNum(p->pAig); k++ )
+            Sign = (Sign << 7) ^ (Sign >> 57) ^ p->pDataSimCos[k];
+        if ( Level == 0 )
+            SignRef = Sign;
+        else if ( Sign != SignRef )
+            RetValue = 0;
+        Abc_Print( 1, "Kernel %-8s : ", Gia_SimdLevelName(Level) );
+        Abc_Print( 1, "Patterns x nodes / sec = %10.2f M  ", clk ? Work * CLOCKS_PER_SEC / clk / 1000000 : 0.0 );
+        Abc_Print( 1, "%s  ", Sign == SignRef ? "   " : "ERR" );
+        Abc_PrintTime( 1, "Time", clk );
+    }
+    Gia_SimdSetLevel( LevelOld );
+    Gia_ManSimDelete( p );
+    if ( !RetValue )
+        Abc_Print( -1, "Simulation results produced by the kernels do not match.\n" );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -800,25 +1126,14 @@ void Gia_ManBuiltInSimPerformInt( Gia_Man_t * p, int iObj )
     word * pInfo  = Gia_ManBuiltInData( p, iObj ); 
     word * pInfo0 = Gia_ManBuiltInData( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pInfo1 = Gia_ManBuiltInData( p, Gia_ObjFaninId1(pObj, iObj) ); 
+    word Mask0 = (word)0 - (word)Gia_ObjFaninC0(pObj);
+    word Mask1 = (word)0 - (word)Gia_ObjFaninC1(pObj);
     assert( p->fBuiltInSim || p->fIncrSim );
-    if ( Gia_ObjFaninC0(pObj) )
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = 0; w < p->nSimWords; w++ )
-                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-        else 
-            for ( w = 0; w < p->nSimWords; w++ )
-                pInfo[w] = ~pInfo0[w] & pInfo1[w];
-    }
-    else 
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = 0; w < p->nSimWords; w++ )
-                pInfo[w] = pInfo0[w] & ~pInfo1[w];
-        else 
-            for ( w = 0; w < p->nSimWords; w++ )
-                pInfo[w] = pInfo0[w] & pInfo1[w];
-    }
+    if ( p->nSimWords >= 4 )
+        Gia_SimdAnd( pInfo, pInfo0, pInfo1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), p->nSimWords );
+    else
+        for ( w = 0; w < p->nSimWords; w++ )
+            pInfo[w] = (pInfo0[w] ^ Mask0) & (pInfo1[w] ^ Mask1);
     assert( Vec_WrdSize(p->vSims) == Gia_ManObjNum(p) * p->nSimWords );
 }
 void Gia_ManBuiltInSimPerform( Gia_Man_t * p, int iObj )
@@ -0,0 +1,191 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Vectorized kernels for bit-parallel simulation.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaSimd.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(ABC_NO_SIMD)
+#define GIA_SIMD_X86
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the kernel computes pOut[w] = (p0[w] ^ Mask0) & (p1[w] ^ Mask1)
+typedef void (*Gia_SimdAnd_t)( word * pOut, word * p0, word * p1, word Mask0, word Mask1, int nWords );
+
+static int           s_SimdLevelMax = -1;  // the best level supported by the CPU
+static int           s_SimdLevel    = -1;  // the level currently used
+static Gia_SimdAnd_t s_SimdAnd      = NULL;
+
+static char *        s_SimdNames[3] = { "scalar", "AVX2", "AVX-512" };
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [AND-gate kernels for different instruction sets.]
+
+  Description [Complemented fanins are handled by XOR-ing with an
+  all-zero or all-one mask, so the loops do not branch on the
+  complemented attributes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_SimdAndScalar( word * pOut, word * p0, word * p1, word Mask0, word Mask1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (p0[w] ^ Mask0) & (p1[w] ^ Mask1);
+}
+
+#ifdef GIA_SIMD_X86
+
+__attribute__((target("avx2")))
+static void Gia_SimdAndAvx2( word * pOut, word * p0, word * p1, word Mask0, word Mask1, int nWords )
+{
+    __m256i m0 = _mm256_set1_epi64x( (long long)Mask0 );
+    __m256i m1 = _mm256_set1_epi64x( (long long)Mask1 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i const *)(p0 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i const *)(p1 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(_mm256_xor_si256(a, m0), _mm256_xor_si256(b, m1)) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (p0[w] ^ Mask0) & (p1[w] ^ Mask1);
+}
+
+__attribute__((target("avx512f")))
+static void Gia_SimdAndAvx512( word * pOut, word * p0, word * p1, word Mask0, word Mask1, int nWords )
+{
+    __m512i m0 = _mm512_set1_epi64( (long long)Mask0 );
+    __m512i m1 = _mm512_set1_epi64( (long long)Mask1 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (void const *)(p0 + w) );
+        __m512i b = _mm512_loadu_si512( (void const *)(p1 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(_mm512_xor_si512(a, m0), _mm512_xor_si512(b, m1)) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (p0[w] ^ Mask0) & (p1[w] ^ Mask1);
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the best SIMD level supported by this CPU.]
+
+  Description [0 = scalar, 1 = AVX2, 2 = AVX-512.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SimdLevelMax()
+{
+    if ( s_SimdLevelMax >= 0 )
+        return s_SimdLevelMax;
+    s_SimdLevelMax = 0;
+#ifdef GIA_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx2") )
+        s_SimdLevelMax = 1;
+    if ( __builtin_cpu_supports("avx512f") )
+        s_SimdLevelMax = 2;
+#endif
+    return s_SimdLevelMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the SIMD level used by the simulation kernels.]
+
+  Description [The level is limited by what the CPU supports. Returns
+  the previously used level.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SimdSetLevel( int Level )
+{
+    int LevelOld = s_SimdLevel >= 0 ? s_SimdLevel : Gia_SimdLevelMax();
+    s_SimdLevel = Abc_MaxInt( 0, Abc_MinInt(Level, Gia_SimdLevelMax()) );
+#ifdef GIA_SIMD_X86
+    if ( s_SimdLevel == 2 )
+        s_SimdAnd = Gia_SimdAndAvx512;
+    else if ( s_SimdLevel == 1 )
+        s_SimdAnd = Gia_SimdAndAvx2;
+    else
+#endif
+        s_SimdAnd = Gia_SimdAndScalar;
+    return LevelOld;
+}
+int Gia_SimdLevel()
+{
+    if ( s_SimdLevel < 0 )
+        Gia_SimdSetLevel( Gia_SimdLevelMax() );
+    return s_SimdLevel;
+}
+char * Gia_SimdLevelName( int Level )
+{
+    return s_SimdNames[Abc_MaxInt(0, Abc_MinInt(Level, 2))];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates an AND gate using the selected kernel.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SimdAnd( word * pOut, word * p0, word * p1, int fCompl0, int fCompl1, int nWords )
+{
+    if ( s_SimdAnd == NULL )
+        Gia_SimdLevel();
+    s_SimdAnd( pOut, p0, p1, (word)0 - (word)fCompl0, (word)0 - (word)fCompl1, nWords );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,312 @@
+/**CFile****************************************************************
+
+  FileName    [giaSoa.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Structure-of-arrays view of the AIG.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaSoa.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the AIG managers created with this flag set maintain the view
+static int s_fSoaDefault = 0;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the structure-of-arrays mode for the new AIG managers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSoaSetDefault( int fEnable )
+{
+    s_fSoaDefault = fEnable;
+}
+int Gia_ManSoaIsDefault()
+{
+    return s_fSoaDefault;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the structure-of-arrays view.]
+
+  Description [In the structure-of-arrays mode, the fanin literals of 
+  the AND nodes are stored contiguously in p->vFanLits using 8 bytes per 
+  object: (Lit0, Lit1) for an AND node and (-1, -1) for other objects. 
+  Together with the traversal IDs, the levels and the references, which 
+  are already stored in separate arrays, this allows Gia_ManLevelNum(), 
+  Gia_ManCreateRefs() and Gia_ManCollectAnds() to run without touching 
+  the objects of the AND nodes. The view is extended on demand to cover 
+  the nodes appended since the last traversal. The code changing fanins 
+  of an existing AND node in place should call Gia_ManSoaDrop(), which 
+  truncates the view at this node. The fanins of the COs are not in the 
+  view and are always read from the objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSoaStart( Gia_Man_t * p )
+{
+    if ( p->vFanLits == NULL )
+        p->vFanLits = Vec_IntAlloc( 0 );
+}
+void Gia_ManSoaStop( Gia_Man_t * p )
+{
+    Vec_IntFreeP( &p->vFanLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Brings the view up to date.]
+
+  Description [Returns the array of fanin literals, or NULL if the view 
+  is not maintained or the AIG has MUX nodes, which are not supported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int * Gia_ManSoaFanins( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    if ( p->vFanLits == NULL || p->pMuxes )
+        return NULL;
+    if ( Vec_IntSize(p->vFanLits) > 2 * p->nObjs )
+        Vec_IntShrink( p->vFanLits, 2 * p->nObjs );
+    if ( Vec_IntSize(p->vFanLits) == 2 * p->nObjs )
+        return Vec_IntArray( p->vFanLits );
+    Vec_IntGrow( p->vFanLits, 2 * p->nObjsAlloc );
+    for ( i = Vec_IntSize(p->vFanLits) / 2; i < p->nObjs; i++ )
+    {
+        pObj = Gia_ManObj( p, i );
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            Vec_IntPush( p->vFanLits, Gia_ObjFaninLit0(pObj, i) );
+            Vec_IntPush( p->vFanLits, Gia_ObjFaninLit1(pObj, i) );
+        }
+        else
+        {
+            Vec_IntPush( p->vFanLits, -1 );
+            Vec_IntPush( p->vFanLits, -1 );
+        }
+    }
+    return Vec_IntArray( p->vFanLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes levels using the view.]
+
+  Description [Produces the same result as Gia_ManLevelNum().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSoaLevelNum( Gia_Man_t * p, int * pLits )
+{
+    Gia_Obj_t * pObj;
+    int i, iVar0, iVar1, * pLevels;
+    Gia_ManCleanLevels( p, Gia_ManObjNum(p) );
+    pLevels = Vec_IntArray( p->vLevels );
+    p->nLevels = 0;
+    for ( i = 0; i < p->nObjs; i++ )
+    {
+        if ( pLits[2*i+1] < 0 )
+            continue;
+        iVar0 = Abc_Lit2Var( pLits[2*i] );
+        iVar1 = Abc_Lit2Var( pLits[2*i+1] );
+        if ( !p->fGiaSimple && iVar0 == iVar1 ) // buffer (see Gia_ObjIsBuf)
+            pLevels[i] = pLevels[iVar0];
+        else if ( iVar0 > iVar1 ) // XOR (see Gia_ObjIsXor)
+            pLevels[i] = 2 + Abc_MaxInt( pLevels[iVar0], pLevels[iVar1] );
+        else
+            pLevels[i] = 1 + Abc_MaxInt( pLevels[iVar0], pLevels[iVar1] );
+        p->nLevels = Abc_MaxInt( p->nLevels, pLevels[i] );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ObjSetCoLevel( p, pObj );
+    return p->nLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes references using the view.]
+
+  Description [Produces the same result as Gia_ManCreateRefs().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSoaCreateRefs( Gia_Man_t * p, int * pLits )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    assert( p->pRefs == NULL );
+    p->pRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    for ( i = 0; i < 2 * p->nObjs; i++ )
+        if ( pLits[i] >= 0 )
+            p->pRefs[Abc_Lit2Var(pLits[i])]++;
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ObjRefFanin0Inc( p, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects AND nodes in the DFS order using the view.]
+
+  Description [Produces the same result as Gia_ManCollectAnds_rec().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSoaCollectAnds_rec( Gia_Man_t * p, int * pLits, int iObj, Vec_Int_t * vNodes )
+{
+    if ( Gia_ObjIsTravIdCurrentId(p, iObj) )
+        return;
+    Gia_ObjSetTravIdCurrentId(p, iObj);
+    if ( pLits[2*iObj+1] < 0 ) // CI
+        return;
+    Gia_ManSoaCollectAnds_rec( p, pLits, Abc_Lit2Var(pLits[2*iObj]), vNodes );
+    Gia_ManSoaCollectAnds_rec( p, pLits, Abc_Lit2Var(pLits[2*iObj+1]), vNodes );
+    Vec_IntPush( vNodes, iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the traversals with and without the view.]
+
+  Description [The levels and the references of the AIG, if present, 
+  are not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSoaTest( Gia_Man_t * p, int nIters, int fVerbose )
+{
+    Vec_Int_t * vLevelsSave = p->vLevels, * vFanLitsSave = p->vFanLits;
+    Vec_Int_t * vLevels[2], * vNodes[2], * vCos;
+    int * pRefsSave = p->pRefs, nLevelsSave = p->nLevels;
+    int * pRefs[2], nLevels[2], i, k, fOkay = 1;
+    abctime clk, clkLev[2] = {0}, clkRef[2] = {0}, clkDfs[2] = {0}, clkStart = 0;
+    assert( nIters > 0 );
+    if ( p->pMuxes )
+    {
+        printf( "The structure-of-arrays view does not support MUX nodes.\n" );
+        return;
+    }
+    vCos = Vec_IntAlloc( Gia_ManCoNum(p) );
+    for ( i = 0; i < Gia_ManCoNum(p); i++ )
+        Vec_IntPush( vCos, Gia_ManCoIdToId(p, i) );
+    // k = 0 uses the objects; k = 1 uses the view derived from scratch
+    for ( k = 0; k < 2; k++ )
+    {
+        p->vFanLits = NULL;
+        p->vLevels  = NULL;
+        p->pRefs    = NULL;
+        if ( k == 1 )
+        {
+            clk = Abc_Clock();
+            Gia_ManSoaStart( p );
+            Gia_ManSoaFanins( p );
+            clkStart = Abc_Clock() - clk;
+        }
+        vNodes[k] = Vec_IntAlloc( Gia_ManAndNum(p) );
+        for ( i = 0; i < nIters; i++ )
+        {
+            clk = Abc_Clock();
+            nLevels[k] = Gia_ManLevelNum( p );
+            clkLev[k] += Abc_Clock() - clk;
+            clk = Abc_Clock();
+            Gia_ManCreateRefs( p );
+            clkRef[k] += Abc_Clock() - clk;
+            if ( i < nIters - 1 )
+                ABC_FREE( p->pRefs );
+            clk = Abc_Clock();
+            Gia_ManIncrementTravId( p );
+            Gia_ManCollectAnds( p, Vec_IntArray(vCos), Vec_IntSize(vCos), vNodes[k], NULL );
+            clkDfs[k] += Abc_Clock() - clk;
+        }
+        vLevels[k] = p->vLevels;
+        pRefs[k]   = p->pRefs;
+        Gia_ManSoaStop( p );
+    }
+    // compare the results
+    if ( nLevels[0] != nLevels[1] || !Vec_IntEqual(vLevels[0], vLevels[1]) )
+        printf( "Levels do not match.\n" ), fOkay = 0;
+    if ( memcmp(pRefs[0], pRefs[1], sizeof(int) * Gia_ManObjNum(p)) )
+        printf( "References do not match.\n" ), fOkay = 0;
+    if ( !Vec_IntEqual(vNodes[0], vNodes[1]) )
+        printf( "DFS orders do not match.\n" ), fOkay = 0;
+    printf( "Objects = %d.  Memory: objects = %.2f MB.  Fanin array = %.2f MB.  Iterations = %d.  Results %s.\n",
+        Gia_ManObjNum(p), 1.0*sizeof(Gia_Obj_t)*Gia_ManObjNum(p)/(1<<20), 8.0*Gia_ManObjNum(p)/(1<<20), nIters, fOkay ? "match" : "DO NOT match" );
+    if ( fVerbose )
+    {
+        Abc_PrintTime( 1, "Building view     ", clkStart  );
+        Abc_PrintTime( 1, "Levels  (objects) ", clkLev[0] );
+        Abc_PrintTime( 1, "Levels  (view)    ", clkLev[1] );
+        Abc_PrintTime( 1, "Refs    (objects) ", clkRef[0] );
+        Abc_PrintTime( 1, "Refs    (view)    ", clkRef[1] );
+        Abc_PrintTime( 1, "DFS     (objects) ", clkDfs[0] );
+        Abc_PrintTime( 1, "DFS     (view)    ", clkDfs[1] );
+    }
+    // restore the view, the levels and the references
+    p->vFanLits = vFanLitsSave;
+    p->vLevels  = vLevelsSave;
+    p->pRefs    = pRefsSave;
+    p->nLevels  = nLevelsSave;
+    for ( k = 0; k < 2; k++ )
+    {
+        Vec_IntFree( vLevels[k] );
+        Vec_IntFree( vNodes[k] );
+        ABC_FREE( pRefs[k] );
+    }
+    Vec_IntFree( vCos );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -505,7 +505,9 @@ void Gia_ManCleanTruth( Gia_Man_t * p )
 int Gia_ManLevelNum( Gia_Man_t * p )  
 {
     Gia_Obj_t * pObj;
-    int i;
+    int i, * pLits = Gia_ManSoaFanins( p );
+    if ( pLits )
+        return Gia_ManSoaLevelNum( p, pLits );
     Gia_ManCleanLevels( p, Gia_ManObjNum(p) );
     p->nLevels = 0;
     Gia_ManForEachObj( p, pObj, i )
@@ -715,7 +717,12 @@ void Gia_ManCreateValueRefs( Gia_Man_t * p )
 void Gia_ManCreateRefs( Gia_Man_t * p )  
 {
     Gia_Obj_t * pObj;
-    int i;
+    int i, * pLits = Gia_ManSoaFanins( p );
+    if ( pLits )
+    {
+        Gia_ManSoaCreateRefs( p, pLits );
+        return;
+    }
     assert( p->pRefs == NULL );
     p->pRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
     Gia_ManForEachObj( p, pObj, i )
@@ -276,6 +276,7 @@ static inline void Gia_ManPatchBufDriver( Gia_Man_t * p, int iBuf, int iLit0 )
     assert( Gia_ObjId(p, pObjBuf) > Abc_Lit2Var(iLit0) );
     pObjBuf->iDiff1  = pObjBuf->iDiff0  = Gia_ObjId(p, pObjBuf) - Abc_Lit2Var(iLit0);
     pObjBuf->fCompl1 = pObjBuf->fCompl0 = Abc_LitIsCompl(iLit0);
+    Gia_ManSoaDrop( p, iBuf );
 }
 
 /**Function*************************************************************
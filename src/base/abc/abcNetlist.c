@@ -64,6 +64,7 @@ Abc_Ntk_t * Abc_NtkToLogic( Abc_Ntk_t * pNtk )
     assert( Abc_NtkBlackboxNum(pNtk) == 0 );
     // start the network
     pNtkNew = Abc_NtkStartFrom( pNtk, ABC_NTK_LOGIC, pNtk->ntkFunc );
+    Nm_ManReserve( pNtkNew->pManName, Nm_ManNumEntries(pNtkNew->pManName) + Abc_NtkNodeNum(pNtk) );
     // duplicate the nodes 
     Abc_NtkForEachNode( pNtk, pObj, i )
     {
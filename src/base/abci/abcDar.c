@@ -1527,13 +1527,12 @@ Abc_Ntk_t * Abc_NtkDRewrite( Abc_Ntk_t * pNtk, Dar_RwrPar_t * pPars )
         Vec_VecFree( vParts );
     }
 */
-    Dar_ManRewrite( pMan, pPars );
+    pMan = Dar_ManRewritePar( pTemp = pMan, pPars );
+    Aig_ManStop( pTemp );
 //    pMan = Dar_ManBalance( pTemp = pMan, pPars->fUpdateLevel );
 //    Aig_ManStop( pTemp );
 
 clk = Abc_Clock();
-    pMan = Aig_ManDupDfs( pTemp = pMan ); 
-    Aig_ManStop( pTemp );
 //ABC_PRT( "time", Abc_Clock() - clk );
 
 //    Aig_ManPrintStats( pMan );
@@ -1590,7 +1589,7 @@ clk = Abc_Clock();
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nThreads, int fVerbose )
 {
     Aig_Man_t * pMan, * pTemp;
     Abc_Ntk_t * pNtkAig;
@@ -1602,7 +1601,7 @@ Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fF
 //    Aig_ManPrintStats( pMan );
 
 clk = Abc_Clock();
-    pMan = Dar_ManCompress2( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, fVerbose ); 
+    pMan = Dar_ManCompress2Par( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, nThreads, fVerbose ); 
     Aig_ManStop( pTemp );
 //ABC_PRT( "time", Abc_Clock() - clk );
 
@@ -1801,7 +1800,7 @@ Abc_Ntk_t * Abc_NtkConstructFromCnf( Abc_Ntk_t * pNtk, Cnf_Man_t * p, Vec_Ptr_t
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose )
+Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int nThreads, int fStream, int fVerbose )
 {
 //    Vec_Ptr_t * vMapped = NULL;
     Aig_Man_t * pMan;
@@ -1825,8 +1824,36 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     if ( fVerbose )
     Aig_ManPrintStats( pMan );
 
+    // write CNF without storing it (gzipped files are written by Cnf_DataWriteIntoFile())
+    if ( fFastAlgo && fStream && strlen(pFileName) >= 3 && !strcmp(pFileName + strlen(pFileName) - 3, ".gz") )
+        Abc_Print( 0, "Writing without storing CNF (-s) is not supported for gzipped file \"%s\". CNF is derived in memory.\n", pFileName );
+    else if ( fFastAlgo && fStream )
+    {
+        FILE * pFile = strcmp(pFileName, "-") ? fopen( pFileName, "w" ) : stdout;
+        if ( pFile == NULL )
+            Abc_Print( 1, "Abc_NtkDarToCnf(): Output file \"%s\" cannot be opened.\n", pFileName );
+        else
+        {
+            int nClauses = Cnf_DeriveFastWriteStream( pMan, 0, pFile, fChangePol, nThreads, fVerbose );
+            int fError = (nClauses < 0);
+            if ( pFile != stdout )
+                fError |= (fclose( pFile ) != 0);
+            if ( fError )
+                Abc_Print( -1, "Abc_NtkDarToCnf(): Writing into the output file \"%s\" has failed.\n", pFileName );
+            else if ( pFile != stdout )
+            {
+                Abc_Print( 1, "CNF stats: Clauses = %7d.   ", nClauses );
+                Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+            }
+        }
+        Aig_ManStop( pMan );
+        return NULL;
+    }
+
     // derive CNF
-    if ( fFastAlgo )
+    if ( fFastAlgo && nThreads > 1 )
+        pCnf = Cnf_DeriveFastPar( pMan, 0, nThreads, fVerbose );
+    else if ( fFastAlgo )
         pCnf = Cnf_DeriveFast( pMan, 0 );
     else
         pCnf = Cnf_Derive( pMan, 0 );
@@ -1989,7 +1989,7 @@ Gia_Man_t * Acb_NtkEcoSynthesize( Gia_Man_t * p )
 
     for ( Iter = 0; Iter < 2; Iter++ )
     {
-        pNew = Gia_ManCompress2( p = pNew, 1, 0 );
+        pNew = Gia_ManCompress2( p = pNew, 1, 1, 0 );
         Gia_ManStop( p );
 
         if ( fVerbose ) printf( "M_dc2: " );
@@ -2004,7 +2004,7 @@ Gia_Man_t * Acb_NtkEcoSynthesize( Gia_Man_t * p )
 
     for ( Iter = 0; Iter < 2; Iter++ )
     {
-        pNew = Gia_ManCompress2( p = pNew, 1, 0 );
+        pNew = Gia_ManCompress2( p = pNew, 1, 1, 0 );
         Gia_ManStop( p );
 
         if ( fVerbose ) printf( "M_dc2: " );
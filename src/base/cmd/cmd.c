@@ -28,6 +28,7 @@
 #include "base/main/mainInt.h"
 #include "cmdInt.h"
 #include "misc/util/utilSignal.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -36,6 +37,7 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 static int CmdCommandTime          ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int CmdCommandProfile       ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandEcho          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandQuit          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandAbcrc         ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -86,6 +88,7 @@ void Cmd_Init( Abc_Frame_t * pAbc )
     Cmd_HistoryRead( pAbc );
 
     Cmd_CommandAdd( pAbc, "Basic", "time",          CmdCommandTime,            0 );
+    Cmd_CommandAdd( pAbc, "Basic", "profile",       CmdCommandProfile,         0 );
     Cmd_CommandAdd( pAbc, "Basic", "echo",          CmdCommandEcho,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "quit",          CmdCommandQuit,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "abcrc",         CmdCommandAbcrc,           0 );
@@ -221,6 +224,65 @@ int CmdCommandTime( Abc_Frame_t * pAbc, int argc, char **argv )
     return 1;
 }
 
+/**Function********************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+int CmdCommandProfile( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    char * pFileName = NULL;
+    int c;
+
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Fh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'F':
+            if ( globalUtilOptind >= argc )
+            {
+                fprintf( pAbc->Err, "Command line switch \"-F\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pFileName = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind )
+        goto usage;
+
+    if ( Util_ProfIsEnabled() && pFileName == NULL )
+    {
+        Util_ProfStop();
+        fprintf( pAbc->Out, "Profiling is disabled.\n" );
+        return 0;
+    }
+    Util_ProfStart( pFileName );
+    fprintf( pAbc->Out, "Profiling is enabled. The reports are written into %s.\n", pFileName ? pFileName : "the standard output" );
+    return 0;
+
+  usage:
+    fprintf( pAbc->Err, "usage: profile [-F file] [-h]\n" );
+    fprintf( pAbc->Err, "      \t\ttoggles profiling of the commands\n" );
+    fprintf( pAbc->Err, "      \t\twhen enabled, each command produces one line in JSON format with\n" );
+    fprintf( pAbc->Err, "      \t\tthe runtime, the peak memory, and the timers and counters of the engines\n" );
+    fprintf( pAbc->Err, "   -F file\tthe file to append the reports to [default = stdout]\n" );
+    fprintf( pAbc->Err, "   -h \t\tprint the command usage\n" );
+    return 1;
+}
+
 /**Function********************************************************************
 
   Synopsis    []
@@ -21,6 +21,7 @@
 #include "base/abc/abc.h"
 #include "base/main/mainInt.h"
 #include "cmdInt.h"
+#include "misc/util/utilProf.h"
 #include <ctype.h>
 
 ABC_NAMESPACE_IMPL_START
@@ -100,7 +101,7 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
     int (*pFunc) ( Abc_Frame_t *, int, char ** );
     Abc_Command * pCommand;
     char * value;
-    int fError;
+    int fError, fProfile;
     double clk;
 
     if ( argc == 0 )
@@ -148,10 +149,13 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
     }
 
     // execute the command
+    fProfile = strcmp( argv[0], "profile" ) && Util_ProfCommandStart( argc, argv );
     clk = Extra_CpuTimeDouble();
     pFunc = (int (*)(Abc_Frame_t *, int, char **))pCommand->pFunc;
     fError = (*pFunc)( pAbc, argc, argv );
     pAbc->TimeCommand += Extra_CpuTimeDouble() - clk;
+    if ( fProfile )
+        Util_ProfCommandStop( fError );
 
     // automatic execution of arbitrary command after each command 
     // usually this is a passive command ... 
@@ -29,6 +29,7 @@
 #include "misc/bzlib/bzlib.h"
 #include "misc/zlib/zlib.h"
 #include "ioAbc.h"
+#include "aig/gia/gia.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -244,12 +245,18 @@ Abc_Ntk_t * Io_ReadAiger( char * pFileName, int fCheck )
     int nFileSize = -1, iTerm, nDigits, i;
     char * pContents, * pDrivers = NULL, * pSymbols, * pCur, * pName, * pType;
     unsigned uLit0, uLit1, uLit;
-    int RetValue;
+    int RetValue, Type;
 
-    // read the file into the buffer
-    if ( !strncmp(pFileName+strlen(pFileName)-4,".bz2",4) )
+    // read the file into the buffer (the compression is detected using magic bytes)
+    Type = Gia_AigerFileCompression( pFileName );
+    if ( Type == GIA_AIGER_ZST )
+    {
+        fprintf( stdout, "Reading zstd-compressed files is not supported in this build.\n" );
+        return NULL;
+    }
+    if ( Type == GIA_AIGER_BZ2 )
         pContents = Ioa_ReadLoadFileBz2Aig( pFileName, &nFileSize );
-    else if ( !strncmp(pFileName+strlen(pFileName)-3,".gz",3) )
+    else if ( Type == GIA_AIGER_GZ )
         pContents = Ioa_ReadLoadFileGzAig( pFileName, &nFileSize );
     else
     {
@@ -24,6 +24,17 @@
 #include "misc/vec/vecPtr.h"
 #include "ioAbc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -31,11 +42,14 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 #define IO_BLIFMV_MAXVALUES 256
+#define IO_BLIFMV_TOK_MIN   1000   // the smallest number of lines to pre-tokenize
+#define IO_BLIFMV_THR_MAX   64     // the largest number of threads
 //#define IO_VERBOSE_OUTPUT
 
 typedef struct Io_MvVar_t_ Io_MvVar_t; // parsing var
 typedef struct Io_MvMod_t_ Io_MvMod_t; // parsing model
 typedef struct Io_MvMan_t_ Io_MvMan_t; // parsing manager
+typedef struct Io_MvTok_t_ Io_MvTok_t; // pre-tokenized lines
 
 Vec_Ptr_t *vGlobalLtlArray;
 
@@ -69,6 +83,25 @@ struct Io_MvMod_t_
     Io_MvMan_t *         pMan;         
 };
 
+struct Io_MvTok_t_
+{
+    // lines
+    int                  nLines;       // the number of .names/.gate lines
+    int *                pLineBeg;     // the first token of each line (nLines+1 entries)
+    int *                pLineTab;     // the first table token of each line
+    int *                pLineSop;     // the cover of each .names line in pSops (or -1)
+    // tokens
+    int                  nToks;        // the number of tokens
+    char **              ppToks;       // the tokens
+    char **              ppNames;      // the signal names in the tokens (or NULL)
+    unsigned *           pHashes;      // the hash values of the names
+    int *                pReps;        // the first token with the same name (or -1)
+    int *                pNets;        // the net IDs of the first tokens (or -1)
+    // covers
+    int                  nSops;        // the size of the covers
+    char *               pSops;        // the covers of .names lines
+};
+
 struct Io_MvMan_t_
 {
     // general info about file
@@ -87,6 +120,8 @@ struct Io_MvMan_t_
     Vec_Ptr_t *          vTokens;      // the current tokens
     Vec_Ptr_t *          vTokens2;     // the current tokens
     Vec_Str_t *          vFunc;        // the local function
+    Io_MvTok_t *         pTok;         // pre-tokenized lines of the current model
+    int                  iLine;        // the current line in pTok
     // error reporting
     char                 sError[512];  // the error string generated during parsing
     // statistics 
@@ -118,6 +153,11 @@ static int               Io_MvParseLineShortBlif( Io_MvMod_t * p, char * pLine )
 static int                 Io_MvParseLineLtlProperty( Io_MvMod_t * p, char * pLine );
 static int               Io_MvParseLineGateBlif( Io_MvMod_t * p, Vec_Ptr_t * vTokens );
 static Io_MvVar_t *      Abc_NtkMvVarDup( Abc_Ntk_t * pNtk, Io_MvVar_t * pVar );
+static Io_MvTok_t *      Io_MvTokStart( Io_MvMod_t * p );
+static void              Io_MvTokStop( Io_MvTok_t * p );
+static void              Io_MvTokCollect( Io_MvMan_t * p, Vec_Ptr_t * vTokens, int fTable );
+static Abc_Obj_t *       Io_MvFindOrCreateNet( Io_MvMod_t * p, char * pName );
+static Abc_Obj_t *       Io_MvCreateNode( Io_MvMod_t * p, char * pNameOut, char * pNamesIn[], int nInputs );
 
 static int               Io_MvCharIsSpace( char s )  { return s == ' ' || s == '\t' || s == '\r' || s == '\n';  }
 static int               Io_MvCharIsMvSymb( char s ) { return s == '(' || s == ')' || s == '{' || s == '}' || s == '-' || s == ',' || s == '!';  }
@@ -306,6 +346,8 @@ static void Io_MvFree( Io_MvMan_t * p )
             Io_MvModFree( pMod );
         Vec_PtrFree( p->vModels );
     }
+    if ( p->pTok )
+        Io_MvTokStop( p->pTok );
     Vec_PtrFree( p->vTokens );
     Vec_PtrFree( p->vTokens2 );
     Vec_StrFree( p->vFunc );
@@ -914,6 +956,9 @@ static Abc_Des_t * Io_MvParse( Io_MvMan_t * p )
             printf( "Parsing model %s...\n", pMod->pNtk->pName );
 #endif
 
+        // make room for the names of the nets
+        Nm_ManReserve( pMod->pNtk->pManName, Nm_ManNumEntries(pMod->pNtk->pManName) + 
+            Vec_PtrSize(pMod->vNames) + Vec_PtrSize(pMod->vLatches) + Vec_PtrSize(pMod->vFlops) );
         // check if there any MV lines
         if ( Vec_PtrSize(pMod->vMvs) > 0 )
             Abc_NtkStartMvVars( pMod->pNtk );
@@ -956,9 +1001,18 @@ static Abc_Des_t * Io_MvParse( Io_MvMan_t * p )
         }
         else
         {
+            // pre-tokenize the lines of large models
+            if ( Vec_PtrSize(pMod->vNames) >= IO_BLIFMV_TOK_MIN )
+                p->pTok = Io_MvTokStart( pMod );
             Vec_PtrForEachEntry( char *, pMod->vNames, pLine, k )
+            {
+                p->iLine = k;
                 if ( !Io_MvParseLineNamesBlif( pMod, pLine ) )
                     return NULL;
+            }
+            if ( p->pTok )
+                Io_MvTokStop( p->pTok );
+            p->pTok = NULL;
             Vec_PtrForEachEntry( char *, pMod->vShorts, pLine, k )
                 if ( !Io_MvParseLineShortBlif( pMod, pLine ) )
                     return NULL;
@@ -1987,67 +2041,71 @@ static int Io_MvParseLineNamesMv( Io_MvMod_t * p, char * pLine, int fReset )
 
 /**Function*************************************************************
 
-  Synopsis    [Constructs the SOP cover from the file parsing info.]
+  Synopsis    [Constructs the SOP cover from the tokens of the table.]
 
-  Description []
+  Description [Returns 1 if the table is correct. The cover is returned in
+  vFunc. Otherwise, returns 0 and writes the error message into pError.
+  Does not change the parsing manager, so it can be called by several
+  threads at the same time.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
+static int Io_MvParseTableBlifInt( Io_MvMan_t * p, Vec_Ptr_t * vTokens, int nFanins, Vec_Str_t * vFunc, char * pError )
 {
-    Vec_Ptr_t * vTokens = p->pMan->vTokens;
-    Vec_Str_t * vFunc = p->pMan->vFunc;
     char * pProduct, * pOutput, c;
     int i, Polarity = -1;
 
-    p->pMan->nTablesRead++;
-    // get the tokens
-    Io_MvSplitIntoTokens( vTokens, pTable, '.' );
+    Vec_StrClear( vFunc );
     if ( Vec_PtrSize(vTokens) == 0 )
-        return Abc_SopCreateConst0( (Mem_Flex_t *)p->pNtk->pManFunc );
+    {
+        Vec_StrPrintStr( vFunc, " 0\n" );
+        Vec_StrPush( vFunc, '\0' );
+        return 1;
+    }
     if ( Vec_PtrSize(vTokens) == 1 )
     {
         pOutput = (char *)Vec_PtrEntry( vTokens, 0 );
         c = pOutput[0];
         if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
         {
-            sprintf( p->pMan->sError, "Line %d: Constant table has wrong output value \"%s\".", Io_MvGetLine(p->pMan, pOutput), pOutput );
-            return NULL;
+            sprintf( pError, "Line %d: Constant table has wrong output value \"%s\".", Io_MvGetLine(p, pOutput), pOutput );
+            return 0;
         }
-        return pOutput[0] == '0' ? Abc_SopCreateConst0((Mem_Flex_t *)p->pNtk->pManFunc) : Abc_SopCreateConst1((Mem_Flex_t *)p->pNtk->pManFunc);
+        Vec_StrPrintStr( vFunc, pOutput[0] == '0' ? " 0\n" : " 1\n" );
+        Vec_StrPush( vFunc, '\0' );
+        return 1;
     }
     pProduct = (char *)Vec_PtrEntry( vTokens, 0 );
     if ( Vec_PtrSize(vTokens) % 2 == 1 )
     {
-        sprintf( p->pMan->sError, "Line %d: Table has odd number of tokens (%d).", Io_MvGetLine(p->pMan, pProduct), Vec_PtrSize(vTokens) );
-        return NULL;
+        sprintf( pError, "Line %d: Table has odd number of tokens (%d).", Io_MvGetLine(p, pProduct), Vec_PtrSize(vTokens) );
+        return 0;
     }
     // parse the table
-    Vec_StrClear( vFunc );
     for ( i = 0; i < Vec_PtrSize(vTokens)/2; i++ )
     {
         pProduct = (char *)Vec_PtrEntry( vTokens, 2*i + 0 );
         pOutput  = (char *)Vec_PtrEntry( vTokens, 2*i + 1 );
         if ( strlen(pProduct) != (unsigned)nFanins )
         {
-            sprintf( p->pMan->sError, "Line %d: Cube \"%s\" has size different from the fanin count (%d).", Io_MvGetLine(p->pMan, pProduct), pProduct, nFanins );
-            return NULL;
+            sprintf( pError, "Line %d: Cube \"%s\" has size different from the fanin count (%d).", Io_MvGetLine(p, pProduct), pProduct, nFanins );
+            return 0;
         }
         c = pOutput[0];
         if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
         {
-            sprintf( p->pMan->sError, "Line %d: Output value \"%s\" is incorrect.", Io_MvGetLine(p->pMan, pProduct), pOutput );
-            return NULL;
+            sprintf( pError, "Line %d: Output value \"%s\" is incorrect.", Io_MvGetLine(p, pProduct), pOutput );
+            return 0;
         }
         if ( Polarity == -1 )
             Polarity = (c=='1' || c=='x');
         else if ( Polarity != (c=='1' || c=='x') )
         {
-            sprintf( p->pMan->sError, "Line %d: Output value \"%s\" differs from the value in the first line of the table (%d).", Io_MvGetLine(p->pMan, pProduct), pOutput, Polarity );
-            return NULL;
+            sprintf( pError, "Line %d: Output value \"%s\" differs from the value in the first line of the table (%d).", Io_MvGetLine(p, pProduct), pOutput, Polarity );
+            return 0;
         }
         // parse one product 
         Vec_StrPrintStr( vFunc, pProduct );
@@ -2056,6 +2114,36 @@ static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
         Vec_StrPush( vFunc, '\n' );
     }
     Vec_StrPush( vFunc, '\0' );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Constructs the SOP cover from the file parsing info.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
+{
+    Vec_Ptr_t * vTokens = p->pMan->vTokens;
+    Vec_Str_t * vFunc = p->pMan->vFunc;
+    Io_MvTok_t * pTok = p->pMan->pTok;
+
+    p->pMan->nTablesRead++;
+    // get the tokens
+    if ( pTok && pTok->pLineSop[p->pMan->iLine] >= 0 )
+        return pTok->pSops + pTok->pLineSop[p->pMan->iLine];
+    if ( pTok )
+        Io_MvTokCollect( p->pMan, vTokens, 1 );
+    else
+        Io_MvSplitIntoTokens( vTokens, pTable, '.' );
+    if ( !Io_MvParseTableBlifInt( p->pMan, vTokens, nFanins, vFunc, p->pMan->sError ) )
+        return NULL;
     return Vec_StrArray( vFunc );
 }
 
@@ -2076,21 +2164,24 @@ static int Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine )
     Abc_Obj_t * pNet, * pNode;
     char * pName;
     assert( !p->pMan->fBlifMv );
-    Io_MvSplitIntoTokens( vTokens, pLine, '\0' );
+    if ( p->pMan->pTok )
+        Io_MvTokCollect( p->pMan, vTokens, 0 );
+    else
+        Io_MvSplitIntoTokens( vTokens, pLine, '\0' );
     // parse the mapped node
     if ( !strcmp((char *)Vec_PtrEntry(vTokens,0), "gate") )
         return Io_MvParseLineGateBlif( p, vTokens );
     // parse the regular name line
     assert( !strcmp((char *)Vec_PtrEntry(vTokens,0), "names") );
     pName = (char *)Vec_PtrEntryLast( vTokens );
-    pNet = Abc_NtkFindOrCreateNet( p->pNtk, pName );
+    pNet = Io_MvFindOrCreateNet( p, pName );
     if ( Abc_ObjFaninNum(pNet) > 0 )
     {
         sprintf( p->pMan->sError, "Line %d: Signal \"%s\" is defined more than once.", Io_MvGetLine(p->pMan, pName), pName );
         return 0;
     }
     // create fanins
-    pNode = Io_ReadCreateNode( p->pNtk, pName, (char **)(vTokens->pArray + 1), Vec_PtrSize(vTokens) - 2 );
+    pNode = Io_MvCreateNode( p, pName, (char **)(vTokens->pArray + 1), Vec_PtrSize(vTokens) - 2 );
     // parse the table of this node
     pNode->pData = Io_MvParseTableBlif( p, pName + strlen(pName), Abc_ObjFaninNum(pNode) );
     if ( pNode->pData == NULL )
@@ -2301,7 +2392,7 @@ static int Io_MvParseLineGateBlif( Io_MvMod_t * p, Vec_Ptr_t * vTokens )
     {
         nNames  = vTokens->nSize - 3;
         ppNames = (char **)vTokens->pArray + 2;
-        pNode   = Io_ReadCreateNode( p->pNtk, ppNames[nNames], ppNames, nNames );
+        pNode   = Io_MvCreateNode( p, ppNames[nNames], ppNames, nNames );
         Abc_ObjSetData( pNode, pGate );
     }
     else
@@ -2311,12 +2402,12 @@ static int Io_MvParseLineGateBlif( Io_MvMod_t * p, Vec_Ptr_t * vTokens )
         assert( ppNames[nNames] != NULL || ppNames[nNames+1] != NULL );
         if ( ppNames[nNames] )
         {
-            pNode   = Io_ReadCreateNode( p->pNtk, ppNames[nNames], ppNames, nNames );
+            pNode   = Io_MvCreateNode( p, ppNames[nNames], ppNames, nNames );
             Abc_ObjSetData( pNode, pGate );
         }
         if ( ppNames[nNames+1] )
         {
-            pNode   = Io_ReadCreateNode( p->pNtk, ppNames[nNames+1], ppNames, nNames );
+            pNode   = Io_MvCreateNode( p, ppNames[nNames+1], ppNames, nNames );
             Abc_ObjSetData( pNode, Mio_GateReadTwin(pGate) );
         }
     }
@@ -2324,6 +2415,424 @@ static int Io_MvParseLineGateBlif( Io_MvMod_t * p, Vec_Ptr_t * vTokens )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Data structure used to pre-tokenize lines.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Io_MvThData_t_ Io_MvThData_t;
+struct Io_MvThData_t_
+{
+    Io_MvTok_t *         p;            // the tokens
+    Io_MvMan_t *         pMan;         // the parsing manager (read-only)
+    Vec_Ptr_t *          vLines;       // the lines
+    int                  fIntern;      // the task (0 = splitting lines; 1 = interning names)
+    int                  iStart;       // the first line
+    int                  iStop;        // the last line plus one
+    int                  iShard;       // the shard of names
+    int                  nShards;      // the number of shards
+    Vec_Ptr_t *          vToks;        // the tokens of the lines
+    Vec_Ptr_t *          vNames;       // the names in the tokens
+    Vec_Int_t *          vHashes;      // the hash values of the names
+    Vec_Str_t *          vSops;        // the covers of the lines
+    Vec_Str_t *          vFunc;        // the cover of the current line
+    char                 sError[512];  // the error message (not used)
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the hash value of the name.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Io_MvTokHash( char * pName )
+{
+    unsigned Key = 2166136261u;
+    for ( ; *pName; pName++ )
+        Key = (Key ^ (unsigned char)*pName) * 16777619u;
+    return Key;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the range of .names/.gate lines into tokens.]
+
+  Description [The lines and the tables following the .names lines are
+  split in place, in the same way as it is done by Io_MvSplitIntoTokens().
+  Each range of lines is followed by a directive, which bounds the last 
+  table, so the ranges can be split in parallel. For each token, the
+  signal name is recorded along with its hash value. For .gate lines,
+  the name is the actual part of the formal/actual pair. For .names 
+  lines, the SOP covers are derived. If the table of a line has errors,
+  its cover is not derived and the error is reported when the line is
+  parsed again while the network is constructed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvTokSplitLines( Io_MvThData_t * pThData )
+{
+    Io_MvTok_t * p = pThData->p;
+    Vec_Ptr_t vTable;
+    char * pLine, * pCur, * pStop, * pName;
+    int i, k, fGate;
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+    {
+        pLine = (char *)Vec_PtrEntry( pThData->vLines, i );
+        // split the line
+        for ( pStop = pLine; *pStop; pStop++ )
+            if ( Io_MvCharIsSpace(*pStop) )
+                *pStop = 0;
+        p->pLineBeg[i] = Vec_PtrSize(pThData->vToks);
+        for ( pCur = pLine; pCur < pStop; pCur++ )
+        {
+            if ( *pCur == 0 )
+                continue;
+            Vec_PtrPush( pThData->vToks, pCur );
+            while ( *++pCur );
+        }
+        p->pLineTab[i] = Vec_PtrSize(pThData->vToks);
+        p->pLineSop[i] = -1;
+        // record the names
+        fGate = !strcmp( pLine, "gate" );
+        for ( k = p->pLineBeg[i]; k < p->pLineTab[i]; k++ )
+        {
+            pName = (char *)Vec_PtrEntry( pThData->vToks, k );
+            if ( k == p->pLineBeg[i] || (fGate && k == p->pLineBeg[i] + 1) )
+                pName = NULL;
+            else if ( fGate && (pName = strchr(pName, '=')) )
+                pName++;
+            Vec_PtrPush( pThData->vNames, pName );
+            Vec_IntPush( pThData->vHashes, pName ? (int)Io_MvTokHash(pName) : 0 );
+        }
+        if ( fGate )
+            continue;
+        // split the table
+        for ( pCur = pStop; *pStop != '.'; pStop++ )
+            if ( Io_MvCharIsSpace(*pStop) )
+                *pStop = 0;
+        for ( ; pCur < pStop; pCur++ )
+        {
+            if ( *pCur == 0 )
+                continue;
+            Vec_PtrPush( pThData->vToks, pCur );
+            Vec_PtrPush( pThData->vNames, NULL );
+            Vec_IntPush( pThData->vHashes, 0 );
+            while ( *++pCur );
+        }
+        // derive the cover
+        vTable.nCap   = 0;
+        vTable.nSize  = Vec_PtrSize(pThData->vToks) - p->pLineTab[i];
+        vTable.pArray = Vec_PtrArray(pThData->vToks) + p->pLineTab[i];
+        if ( !Io_MvParseTableBlifInt( pThData->pMan, &vTable, p->pLineTab[i] - p->pLineBeg[i] - 2, pThData->vFunc, pThData->sError ) )
+            continue;
+        p->pLineSop[i] = Vec_StrSize(pThData->vSops);
+        Vec_StrAppend( pThData->vSops, Vec_StrArray(pThData->vFunc) );
+        Vec_StrPush( pThData->vSops, '\0' );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Interns the names belonging to one shard.]
+
+  Description [The shard is determined by the hash value of the name.
+  For each name, finds the first token with the same name. The shards
+  are disjoint, so they can be processed in parallel.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvTokInternNames( Io_MvThData_t * pThData )
+{
+    Io_MvTok_t * p = pThData->p;
+    unsigned Key, nShards = (unsigned)pThData->nShards;
+    int i, k, * pTable, nTable = 0, nMask;
+    for ( i = 0; i < p->nToks; i++ )
+        if ( p->ppNames[i] && p->pHashes[i] % nShards == (unsigned)pThData->iShard )
+            nTable++;
+    nMask  = (1 << Abc_Base2Log(2 * nTable + 16)) - 1;
+    pTable = ABC_FALLOC( int, nMask + 1 );
+    for ( i = 0; i < p->nToks; i++ )
+    {
+        Key = p->pHashes[i];
+        if ( p->ppNames[i] == NULL || Key % nShards != (unsigned)pThData->iShard )
+            continue;
+        for ( k = (Key / nShards) & nMask; pTable[k] >= 0; k = (k + 1) & nMask )
+            if ( p->pHashes[pTable[k]] == Key && !strcmp(p->ppNames[pTable[k]], p->ppNames[i]) )
+                break;
+        if ( pTable[k] < 0 )
+            pTable[k] = i;
+        p->pReps[i] = pTable[k];
+    }
+    ABC_FREE( pTable );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the tasks assigned to the threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvTokPerform( Io_MvThData_t * pThData )
+{
+    if ( pThData->fIntern )
+        Io_MvTokInternNames( pThData );
+    else
+        Io_MvTokSplitLines( pThData );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+static void * Io_MvTokWorkerThread( void * pArg )
+{
+    Io_MvTokPerform( (Io_MvThData_t *)pArg );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+static void Io_MvTokPerformAll( Io_MvThData_t * pThData, int nThreads )
+{
+    pthread_t WorkerThread[IO_BLIFMV_THR_MAX];
+    int i, status;
+    if ( nThreads == 1 )
+    {
+        Io_MvTokPerform( pThData );
+        return;
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Io_MvTokWorkerThread, (void *)(pThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+}
+
+#else // pthreads are not used
+
+static void Io_MvTokPerformAll( Io_MvThData_t * pThData, int nThreads )
+{
+    int i;
+    for ( i = 0; i < nThreads; i++ )
+        Io_MvTokPerform( pThData + i );
+}
+
+#endif // pthreads are not used
+
+/**Function*************************************************************
+
+  Synopsis    [Pre-tokenizes the .names/.gate lines of the model.]
+
+  Description [The lines are split into tokens, the covers are derived, 
+  and the names are interned, so that the network can be built in one 
+  pass with only one look-up in the name manager for each distinct name.
+  Both steps are performed by several threads, whose number is given by
+  "set readthreads <num>". Returns NULL if only one thread is used; in
+  this case, the lines are parsed one by one.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Io_MvTok_t * Io_MvTokStart( Io_MvMod_t * pMod )
+{
+    Io_MvThData_t ThData[IO_BLIFMV_THR_MAX];
+    Io_MvTok_t * p;
+    int i, k, nToks, nSops, nThreads = 1;
+    if ( Abc_FrameReadFlag("readthreads") )
+        nThreads = Abc_MaxInt( 1, Abc_MinInt(atoi(Abc_FrameReadFlag("readthreads")), IO_BLIFMV_THR_MAX) );
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, Vec_PtrSize(pMod->vNames) / IO_BLIFMV_TOK_MIN) );
+    if ( nThreads == 1 )
+        return NULL;
+    p = ABC_CALLOC( Io_MvTok_t, 1 );
+    p->nLines   = Vec_PtrSize(pMod->vNames);
+    p->pLineBeg = ABC_ALLOC( int, p->nLines + 1 );
+    p->pLineTab = ABC_ALLOC( int, p->nLines );
+    p->pLineSop = ABC_ALLOC( int, p->nLines );
+    // split the lines
+    memset( ThData, 0, sizeof(Io_MvThData_t) * nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].pMan    = pMod->pMan;
+        ThData[i].vLines  = pMod->vNames;
+        ThData[i].iStart  = (int)((word)p->nLines * i / nThreads);
+        ThData[i].iStop   = (int)((word)p->nLines * (i+1) / nThreads);
+        ThData[i].iShard  = i;
+        ThData[i].nShards = nThreads;
+        ThData[i].vToks   = Vec_PtrAlloc( 8 * (ThData[i].iStop - ThData[i].iStart) );
+        ThData[i].vNames  = Vec_PtrAlloc( 8 * (ThData[i].iStop - ThData[i].iStart) );
+        ThData[i].vHashes = Vec_IntAlloc( 8 * (ThData[i].iStop - ThData[i].iStart) );
+        ThData[i].vSops   = Vec_StrAlloc( 8 * (ThData[i].iStop - ThData[i].iStart) );
+        ThData[i].vFunc   = Vec_StrAlloc( 100 );
+    }
+    Io_MvTokPerformAll( ThData, nThreads );
+    // merge the tokens
+    for ( i = 0; i < nThreads; i++ )
+    {
+        p->nToks += Vec_PtrSize(ThData[i].vToks);
+        p->nSops += Vec_StrSize(ThData[i].vSops);
+    }
+    p->pSops   = ABC_ALLOC( char, p->nSops );
+    p->ppToks  = ABC_ALLOC( char *, p->nToks );
+    p->ppNames = ABC_ALLOC( char *, p->nToks );
+    p->pHashes = ABC_ALLOC( unsigned, p->nToks );
+    for ( nToks = nSops = i = 0; i < nThreads; i++ )
+    {
+        memcpy( p->pSops + nSops, Vec_StrArray(ThData[i].vSops), sizeof(char) * Vec_StrSize(ThData[i].vSops) );
+        memcpy( p->ppToks  + nToks, Vec_PtrArray(ThData[i].vToks),   sizeof(char *) * Vec_PtrSize(ThData[i].vToks) );
+        memcpy( p->ppNames + nToks, Vec_PtrArray(ThData[i].vNames),  sizeof(char *) * Vec_PtrSize(ThData[i].vNames) );
+        memcpy( p->pHashes + nToks, Vec_IntArray(ThData[i].vHashes), sizeof(int) * Vec_IntSize(ThData[i].vHashes) );
+        for ( k = ThData[i].iStart; k < ThData[i].iStop; k++ )
+        {
+            p->pLineBeg[k] += nToks;
+            p->pLineTab[k] += nToks;
+            if ( p->pLineSop[k] >= 0 )
+                p->pLineSop[k] += nSops;
+        }
+        nToks += Vec_PtrSize(ThData[i].vToks);
+        nSops += Vec_StrSize(ThData[i].vSops);
+        Vec_PtrFree( ThData[i].vToks );
+        Vec_PtrFree( ThData[i].vNames );
+        Vec_IntFree( ThData[i].vHashes );
+        Vec_StrFree( ThData[i].vSops );
+        Vec_StrFree( ThData[i].vFunc );
+    }
+    assert( nToks == p->nToks );
+    assert( nSops == p->nSops );
+    p->pLineBeg[p->nLines] = p->nToks;
+    // intern the names
+    p->pReps = ABC_FALLOC( int, p->nToks );
+    for ( i = 0; i < nThreads; i++ )
+        ThData[i].fIntern = 1;
+    Io_MvTokPerformAll( ThData, nThreads );
+    ABC_FREE( p->pHashes );
+    p->pNets = ABC_FALLOC( int, p->nToks );
+    return p;
+}
+static void Io_MvTokStop( Io_MvTok_t * p )
+{
+    ABC_FREE( p->pLineBeg );
+    ABC_FREE( p->pLineTab );
+    ABC_FREE( p->pLineSop );
+    ABC_FREE( p->pSops );
+    ABC_FREE( p->ppToks );
+    ABC_FREE( p->ppNames );
+    ABC_FREE( p->pHashes );
+    ABC_FREE( p->pReps );
+    ABC_FREE( p->pNets );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the tokens of the current line.]
+
+  Description [Collects the tokens of the .names/.gate line if fTable is 0,
+  or the tokens of the table following the .names line if fTable is 1.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvTokCollect( Io_MvMan_t * p, Vec_Ptr_t * vTokens, int fTable )
+{
+    Io_MvTok_t * pTok = p->pTok;
+    int iBeg = fTable ? pTok->pLineTab[p->iLine]   : pTok->pLineBeg[p->iLine];
+    int iEnd = fTable ? pTok->pLineBeg[p->iLine+1] : pTok->pLineTab[p->iLine];
+    Vec_PtrClear( vTokens );
+    Vec_PtrGrow( vTokens, iEnd - iBeg );
+    memcpy( Vec_PtrArray(vTokens), pTok->ppToks + iBeg, sizeof(char *) * (iEnd - iBeg) );
+    vTokens->nSize = iEnd - iBeg;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or creates the net with the given name.]
+
+  Description [If the current line is pre-tokenized and the name is one
+  of its tokens, the net is looked up in the name manager only once for
+  all tokens with the same name.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Obj_t * Io_MvFindOrCreateNet( Io_MvMod_t * p, char * pName )
+{
+    Io_MvTok_t * pTok = p->pMan->pTok;
+    Abc_Obj_t * pNet;
+    int i;
+    if ( pTok == NULL )
+        return Abc_NtkFindOrCreateNet( p->pNtk, pName );
+    for ( i = pTok->pLineBeg[p->pMan->iLine]; i < pTok->pLineTab[p->pMan->iLine]; i++ )
+        if ( pTok->ppNames[i] == pName )
+            break;
+    if ( i == pTok->pLineTab[p->pMan->iLine] )
+        return Abc_NtkFindOrCreateNet( p->pNtk, pName );
+    i = pTok->pReps[i];
+    if ( pTok->pNets[i] >= 0 )
+        return Abc_NtkObj( p->pNtk, pTok->pNets[i] );
+    pNet = Abc_NtkFindOrCreateNet( p->pNtk, pName );
+    pTok->pNets[i] = Abc_ObjId( pNet );
+    return pNet;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the node with the given fanin/fanout names.]
+
+  Description [Similar to Io_ReadCreateNode() but uses the interned names.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Obj_t * Io_MvCreateNode( Io_MvMod_t * p, char * pNameOut, char * pNamesIn[], int nInputs )
+{
+    Abc_Obj_t * pNet, * pNode;
+    int i;
+    // create a new node 
+    pNode = Abc_NtkCreateNode( p->pNtk );
+    // add the fanin nets
+    for ( i = 0; i < nInputs; i++ )
+    {
+        pNet = Io_MvFindOrCreateNet( p, pNamesIn[i] );
+        Abc_ObjAddFanin( pNode, pNet );
+    }
+    // add the fanout net
+    pNet = Io_MvFindOrCreateNet( p, pNameOut );
+    Abc_ObjAddFanin( pNet, pNode );
+    return pNode;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Box mapping procedures.]
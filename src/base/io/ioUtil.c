@@ -53,6 +53,10 @@ Io_FileType_t Io_ReadFileType( char * pFileName )
         return IO_FILE_NONE;
     if ( !strcmp( pExt, "aig" ) )
         return IO_FILE_AIGER;
+    // compressed AIGER files (the compression is detected by the reader)
+    if ( (!strcmp( pExt, "gz" ) || !strcmp( pExt, "bz2" ) || !strcmp( pExt, "zst" )) && 
+         pExt - pFileName > 4 && !strncmp( pExt - 5, ".aig.", 5 ) )
+        return IO_FILE_AIGER;
     if ( !strcmp( pExt, "baf" ) )
         return IO_FILE_BAF;
     if ( !strcmp( pExt, "bblif" ) )
@@ -665,6 +665,13 @@ void Io_WriteAiger( Abc_Ntk_t * pNtk, char * pFileName, int fWriteSymbols, int f
             return;
         }
 
+    // zstd is not available
+    if (!strncmp(pFileName+strlen(pFileName)-4,".zst",4)) 
+    {
+        fprintf( stdout, "Io_WriteAiger(): Writing zstd-compressed files is not supported in this build.\n" );
+        return;
+    }
+
     // write the GZ file
     if (!strncmp(pFileName+strlen(pFileName)-3,".gz",3)) 
     {
@@ -22,6 +22,17 @@
 #include "map/mio/mio.h"
 #include "base/main/main.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -51,11 +62,28 @@ typedef enum {
     VER_GATE_NOT
 } Ver_GateType_t;
 
+#define VER_TOK_MIN    65536   // the smallest number of bytes to pre-tokenize by one thread
+#define VER_THR_MAX    64      // the largest number of threads
+
+// types of pre-tokenized statements
+typedef enum { 
+    VER_TOK_MODULE = 0,
+    VER_TOK_END,
+    VER_TOK_INPUT,
+    VER_TOK_OUTPUT,
+    VER_TOK_INOUT,
+    VER_TOK_REG,
+    VER_TOK_WIRE,
+    VER_TOK_GATE
+} Ver_TokType_t;
+
 static Ver_Man_t * Ver_ParseStart( char * pFileName, Abc_Des_t * pGateLib );
 static void Ver_ParseStop( Ver_Man_t * p );
 static void Ver_ParseFreeData( Ver_Man_t * p );
 static void Ver_ParseInternal( Ver_Man_t * p );
 static int  Ver_ParseModule( Ver_Man_t * p );
+static int  Ver_ParseModuleFinish( Ver_Man_t * pMan, Abc_Ntk_t * pNtk );
+static int  Ver_TokParse( Ver_Man_t * p );
 static int  Ver_ParseSignal( Ver_Man_t * p, Abc_Ntk_t * pNtk, Ver_SignalType_t SigType );
 static int  Ver_ParseAlways( Ver_Man_t * p, Abc_Ntk_t * pNtk );
 static int  Ver_ParseInitial( Ver_Man_t * p, Abc_Ntk_t * pNtk );
@@ -203,26 +231,29 @@ void Ver_ParseInternal( Ver_Man_t * pMan )
     char * pToken;
     int i;
 
-    // preparse the modeles
-    pMan->pProgress = Extra_ProgressBarStart( stdout, Ver_StreamGetFileSize(pMan->pReader) );
-    while ( 1 )
+    // preparse the modeles (pre-tokenize the file if several threads are used)
+    if ( !Ver_TokParse( pMan ) )
     {
-        // get the next token
-        pToken = Ver_ParseGetName( pMan );
-        if ( pToken == NULL )
-            break;
-        if ( strcmp( pToken, "module" ) )
+        pMan->pProgress = Extra_ProgressBarStart( stdout, Ver_StreamGetFileSize(pMan->pReader) );
+        while ( 1 )
         {
-            sprintf( pMan->sError, "Cannot read \"module\" directive." );
-            Ver_ParsePrintErrorMessage( pMan );
-            return;
+            // get the next token
+            pToken = Ver_ParseGetName( pMan );
+            if ( pToken == NULL )
+                break;
+            if ( strcmp( pToken, "module" ) )
+            {
+                sprintf( pMan->sError, "Cannot read \"module\" directive." );
+                Ver_ParsePrintErrorMessage( pMan );
+                return;
+            }
+            // parse the module
+            if ( !Ver_ParseModule(pMan) )
+                return;
         }
-        // parse the module
-        if ( !Ver_ParseModule(pMan) )
-            return;
+        Extra_ProgressBarStop( pMan->pProgress );
+        pMan->pProgress = NULL;
     }
-    Extra_ProgressBarStop( pMan->pProgress );
-    pMan->pProgress = NULL;
 
     // process defined and undefined boxes
     if ( !Ver_ParseAttachBoxes( pMan ) )
@@ -514,7 +545,22 @@ int Ver_ParseModule( Ver_Man_t * pMan )
         if ( pWord == NULL )
             return 0;
     }
+    return Ver_ParseModuleFinish( pMan, pNtk );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finalizes the Verilog module after "endmodule".]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
 
+***********************************************************************/
+int Ver_ParseModuleFinish( Ver_Man_t * pMan, Abc_Ntk_t * pNtk )
+{
     // convert from the blackbox into the network with local functions representated by AIGs
     if ( pNtk->ntkFunc == ABC_FUNC_BLACKBOX )
     {
@@ -3028,6 +3074,749 @@ Abc_Obj_t * Ver_ParseCreateInv( Abc_Ntk_t * pNtk, Abc_Obj_t * pNet )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Data structures used to pre-tokenize the file.]
+
+  Description [The pre-tokenized file is a sequence of statements. For
+  each statement, the type, the gate (for the gate instances), and the 
+  range of names are recorded. The names are the module name, the names 
+  of the declared signals, and the actual nets of the gate instances.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Ver_Tok_t_ Ver_Tok_t;
+struct Ver_Tok_t_
+{
+    int                  nStmts;       // the number of statements
+    int *                pStmtBeg;     // the first name of each statement
+    int *                pStmtType;    // the type of each statement
+    Mio_Gate_t **        ppStmtGate;   // the gate of each statement (or NULL)
+    int                  nNames;       // the number of names
+    char **              ppNames;      // the names
+    int *                pPins;        // the gate pin of each name (-1 if the name is not an actual net)
+    unsigned *           pHashes;      // the hash values of the actual nets
+    int *                pReps;        // the first actual net with the same name in the module
+    Abc_Obj_t **         ppNets;       // the nets of the first actual nets
+};
+
+typedef struct Ver_ThData_t_ Ver_ThData_t;
+struct Ver_ThData_t_
+{
+    Ver_Tok_t *          p;            // the tokens
+    Mio_Library_t *      pLib;         // the gate library (read-only)
+    int                  fIntern;      // the task (0 = splitting text; 1 = interning names)
+    char *               pBeg;         // the first char of the text
+    char *               pEnd;         // the last char of the text plus one
+    int                  iStart;       // the first name
+    int                  iStop;        // the last name plus one
+    int                  iShard;       // the shard of names
+    int                  nShards;      // the number of shards
+    Vec_Ptr_t *          vToks;        // the tokens of the current statement (NULL for punctuation)
+    Vec_Str_t *          vKinds;       // the punctuation of the current statement (0 for names)
+    Vec_Ptr_t *          vNames;       // the names
+    Vec_Int_t *          vPins;        // the gate pins of the names
+    Vec_Int_t *          vHashes;      // the hash values of the names
+    Vec_Int_t *          vStmts;       // the first names of the statements
+    Vec_Int_t *          vTypes;       // the types of the statements
+    Vec_Ptr_t *          vGates;       // the gates of the statements
+    int                  fFail;        // set to 1 if an unsupported construct is found
+};
+
+static char * s_VerTokSigs[] = { "input", "output", "inout", "reg", "wire" };
+static char * s_VerTokKeys[] = { "and", "or", "xor", "buf", "nand", "nor", "xnor", "not", "dff", "assign", "always", "initial", NULL };
+
+static inline int Ver_TokIsStop( char c ) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '(' || c == ')' || c == ',' || c == ';' || c == 0; }
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the hash value of the name.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Ver_TokHash( char * pName )
+{
+    unsigned Key = 2166136261u;
+    for ( ; *pName; pName++ )
+        Key = (Key ^ (unsigned char)*pName) * 16777619u;
+    return Key;
+}
+static inline void Ver_TokPushName( Ver_ThData_t * pThData, char * pName, int Pin )
+{
+    Vec_PtrPush( pThData->vNames, pName );
+    Vec_IntPush( pThData->vPins, Pin );
+    Vec_IntPush( pThData->vHashes, Pin >= 0 ? (int)Ver_TokHash(pName) : 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the tokens of one statement and records its names.]
+
+  Description [The following statements are supported: the module header
+  with the list of ports, the declarations of signals without ranges, 
+  the instances of gates from the current genlib library with the named 
+  connections of scalar nets, and "endmodule". Returns the type of the
+  statement, or -1 if the statement is not supported.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ver_TokCheckStatement( Ver_ThData_t * pThData, Mio_Gate_t ** ppGate )
+{
+    char ** ppToks = (char **)Vec_PtrArray( pThData->vToks );
+    char * pKinds  = Vec_StrArray( pThData->vKinds );
+    int i, Type, Pin, nToks = Vec_PtrSize( pThData->vToks );
+    *ppGate = NULL;
+    if ( pKinds[0] )
+        return -1;
+    if ( !strcmp(ppToks[0], "endmodule") )
+        return nToks == 1 ? VER_TOK_END : -1;
+    // module NAME ( NAME {, NAME} ) ;
+    if ( !strcmp(ppToks[0], "module") )
+    {
+        if ( nToks < 6 || (nToks & 1) || pKinds[1] || pKinds[2] != '(' || pKinds[nToks-2] != ')' || pKinds[nToks-1] != ';' )
+            return -1;
+        for ( i = 3; i < nToks - 2; i++ )
+            if ( pKinds[i] != ((i & 1) ? 0 : ',') )
+                return -1;
+        Ver_TokPushName( pThData, ppToks[1], -1 );
+        return VER_TOK_MODULE;
+    }
+    // TYPE [wire] NAME {, NAME} ;
+    for ( Type = VER_TOK_INPUT; Type <= VER_TOK_WIRE; Type++ )
+        if ( !strcmp(ppToks[0], s_VerTokSigs[Type - VER_TOK_INPUT]) )
+            break;
+    if ( Type <= VER_TOK_WIRE )
+    {
+        if ( Mio_LibraryReadGateByName(pThData->pLib, ppToks[0], NULL) )
+            return -1;
+        i = (nToks > 1 && !pKinds[1] && !strcmp(ppToks[1], "wire")) ? 2 : 1;
+        if ( nToks - i < 2 || ((nToks - i) & 1) || pKinds[nToks-1] != ';' )
+            return -1;
+        for ( ; i < nToks - 1; i += 2 )
+        {
+            if ( pKinds[i] || !strcmp(ppToks[i], "wire") || (i + 1 < nToks - 1 && pKinds[i+1] != ',') )
+                return -1;
+            Ver_TokPushName( pThData, ppToks[i], -1 );
+        }
+        return Type;
+    }
+    for ( i = 0; s_VerTokKeys[i]; i++ )
+        if ( !strcmp(ppToks[0], s_VerTokKeys[i]) )
+            return -1;
+    // GATE NAME ( .PIN ( NET ) {, .PIN ( NET )} ) ;
+    *ppGate = Mio_LibraryReadGateByName( pThData->pLib, ppToks[0], NULL );
+    if ( *ppGate == NULL )
+        return -1;
+    if ( nToks < 10 || (nToks - 4) % 6 || pKinds[1] || pKinds[2] != '(' || pKinds[nToks-2] != ')' || pKinds[nToks-1] != ';' )
+        return -1;
+    for ( i = 3; i < nToks - 2; i += 6 )
+    {
+        if ( pKinds[i] != '.' || pKinds[i+1] || pKinds[i+2] != '(' || pKinds[i+3] || pKinds[i+4] != ')' )
+            return -1;
+        if ( i + 5 < nToks - 2 && pKinds[i+5] != ',' )
+            return -1;
+        Pin = Ver_FindGateInput( *ppGate, ppToks[i+1] );
+        if ( Pin == -1 || ppToks[i+3][0] == '~' )
+            return -1;
+        Ver_TokPushName( pThData, ppToks[i+3], Pin );
+    }
+    return VER_TOK_GATE;
+}
+static void Ver_TokFinishStatement( Ver_ThData_t * pThData )
+{
+    Mio_Gate_t * pGate;
+    int iName = Vec_PtrSize( pThData->vNames );
+    int Type  = Ver_TokCheckStatement( pThData, &pGate );
+    if ( Type == -1 )
+        pThData->fFail = 1;
+    Vec_IntPush( pThData->vStmts, iName );
+    Vec_IntPush( pThData->vTypes, Type );
+    Vec_PtrPush( pThData->vGates, pGate );
+    Vec_PtrClear( pThData->vToks );
+    Vec_StrClear( pThData->vKinds );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the range of text into statements.]
+
+  Description [The text is split into tokens in place, skipping the spaces
+  and comments in the same way as it is done by Ver_ParseGetName(). The 
+  range ends after a semicolon, so the ranges can be split in parallel.
+  The names containing a backslash or a comment, the escaped names followed 
+  by a range, and the signal ranges are not supported.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ver_TokSplitText( Ver_ThData_t * pThData )
+{
+    char * pCur = pThData->pBeg, * pEnd = pThData->pEnd, * pName, * pTemp, Delim;
+    while ( pCur < pEnd && !pThData->fFail )
+    {
+        // skip spaces and comments
+        if ( *pCur == ' ' || *pCur == '\t' || *pCur == '\n' || *pCur == '\r' )
+        {
+            pCur++;
+            continue;
+        }
+        if ( *pCur == '/' && pCur[1] == '/' )
+        {
+            while ( pCur < pEnd && *pCur != '\n' )
+                pCur++;
+            continue;
+        }
+        if ( *pCur == '/' && pCur[1] == '*' )
+        {
+            pTemp = strstr( pCur + 2, "*/" );
+            if ( pTemp == NULL || pTemp >= pEnd )
+                break;
+            pCur = pTemp + 2;
+            continue;
+        }
+        if ( *pCur == '/' || *pCur == '[' || *pCur == 0 )
+            break;
+        // get the punctuation
+        if ( *pCur == '(' || *pCur == ')' || *pCur == ',' || *pCur == '.' || *pCur == ';' )
+        {
+            Vec_PtrPush( pThData->vToks, NULL );
+            Vec_StrPush( pThData->vKinds, *pCur );
+            if ( *pCur++ == ';' )
+                Ver_TokFinishStatement( pThData );
+            continue;
+        }
+        // get the name
+        if ( *pCur == '\\' )
+        {
+            for ( pName = ++pCur; pCur < pEnd && *pCur != ' ' && *pCur != '\r' && *pCur != '\n'; pCur++ );
+            for ( pTemp = pCur; pTemp < pEnd && (*pTemp == ' ' || *pTemp == '\r' || *pTemp == '\n'); pTemp++ );
+            if ( pCur == pEnd || pName == pCur || (pTemp < pEnd && *pTemp == '[') )
+            {
+                pCur = pName;
+                break;
+            }
+        }
+        else
+        {
+            for ( pName = pCur; !Ver_TokIsStop(*pCur); pCur++ )
+                if ( *pCur == '\\' || (*pCur == '/' && (pCur[1] == '/' || pCur[1] == '*')) )
+                    break;
+            if ( !Ver_TokIsStop(*pCur) || (*pCur == 0 && pCur < pEnd) )
+                break;
+        }
+        if ( pCur - pName >= 65536 ) // the largest name read by Ver_StreamGetWord()
+        {
+            pCur = pName;
+            break;
+        }
+        // the delimiter is either space or punctuation
+        Delim = pCur < pEnd ? *pCur : 0;
+        if ( pCur < pEnd )
+            *pCur++ = 0;
+        Vec_PtrPush( pThData->vToks, pName );
+        Vec_StrPush( pThData->vKinds, 0 );
+        if ( Vec_PtrSize(pThData->vToks) == 1 && !strcmp(pName, "endmodule") )
+            Ver_TokFinishStatement( pThData );
+        if ( Delim == '(' || Delim == ')' || Delim == ',' || Delim == ';' )
+        {
+            Vec_PtrPush( pThData->vToks, NULL );
+            Vec_StrPush( pThData->vKinds, Delim );
+            if ( Delim == ';' )
+                Ver_TokFinishStatement( pThData );
+        }
+    }
+    // the range should end with a complete statement
+    if ( pCur < pEnd || Vec_PtrSize(pThData->vToks) > 0 )
+        pThData->fFail = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Interns the actual nets belonging to one shard.]
+
+  Description [The shard is determined by the hash value of the name.
+  For each actual net, finds the first actual net with the same name 
+  in the given range. The shards are disjoint, so they can be processed 
+  in parallel.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ver_TokInternNames( Ver_ThData_t * pThData )
+{
+    Ver_Tok_t * p = pThData->p;
+    unsigned Key, nShards = (unsigned)pThData->nShards;
+    int i, k, * pTable, nTable = 0, nMask;
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+        if ( p->pPins[i] >= 0 && p->pHashes[i] % nShards == (unsigned)pThData->iShard )
+            nTable++;
+    nMask  = (1 << Abc_Base2Log(2 * nTable + 16)) - 1;
+    pTable = ABC_FALLOC( int, nMask + 1 );
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+    {
+        Key = p->pHashes[i];
+        if ( p->pPins[i] < 0 || Key % nShards != (unsigned)pThData->iShard )
+            continue;
+        for ( k = (Key / nShards) & nMask; pTable[k] >= 0; k = (k + 1) & nMask )
+            if ( p->pHashes[pTable[k]] == Key && !strcmp(p->ppNames[pTable[k]], p->ppNames[i]) )
+                break;
+        if ( pTable[k] < 0 )
+            pTable[k] = i;
+        p->pReps[i] = pTable[k];
+    }
+    ABC_FREE( pTable );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the tasks assigned to the threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ver_TokPerform( Ver_ThData_t * pThData )
+{
+    if ( pThData->fIntern )
+        Ver_TokInternNames( pThData );
+    else
+        Ver_TokSplitText( pThData );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+static void * Ver_TokWorkerThread( void * pArg )
+{
+    Ver_TokPerform( (Ver_ThData_t *)pArg );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+static void Ver_TokPerformAll( Ver_ThData_t * pThData, int nThreads )
+{
+    pthread_t WorkerThread[VER_THR_MAX];
+    int i, status;
+    if ( nThreads == 1 )
+    {
+        Ver_TokPerform( pThData );
+        return;
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Ver_TokWorkerThread, (void *)(pThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+}
+
+#else // pthreads are not used
+
+static void Ver_TokPerformAll( Ver_ThData_t * pThData, int nThreads )
+{
+    int i;
+    for ( i = 0; i < nThreads; i++ )
+        Ver_TokPerform( pThData + i );
+}
+
+#endif // pthreads are not used
+
+/**Function*************************************************************
+
+  Synopsis    [Divides the file into the ranges processed by the threads.]
+
+  Description [Each range, except the last one, ends after a semicolon,
+  which does not belong to a comment or an escaped name. Returns 0 if the
+  file contains a zero byte or an unterminated comment.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ver_TokDivideFile( char * pBuffer, iword nSize, char ** ppBegs, int nThreads )
+{
+    char * pCur = pBuffer, * pEnd = pBuffer + nSize;
+    int i = 1;
+    ppBegs[0] = pBuffer;
+    while ( i < nThreads )
+    {
+        pCur += strcspn( pCur, ";/\\" );
+        if ( pCur == pEnd )
+            break;
+        if ( *pCur == 0 )
+            return 0;
+        if ( *pCur == ';' )
+        {
+            if ( ++pCur - pBuffer >= nSize * i / nThreads )
+                ppBegs[i++] = pCur;
+        }
+        else if ( *pCur == '\\' )
+            pCur += strcspn( pCur, " \r\n" );
+        else if ( pCur[1] == '/' )
+            pCur += strcspn( pCur, "\n" );
+        else if ( pCur[1] == '*' )
+        {
+            if ( (pCur = strstr( pCur + 2, "*/" )) == NULL )
+                return 0;
+            pCur += 2;
+        }
+        else
+            pCur++;
+    }
+    for ( ; i <= nThreads; i++ )
+        ppBegs[i] = pEnd;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the pre-tokenized file.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ver_TokStop( Ver_Tok_t * p )
+{
+    ABC_FREE( p->pStmtBeg );
+    ABC_FREE( p->pStmtType );
+    ABC_FREE( p->ppStmtGate );
+    ABC_FREE( p->ppNames );
+    ABC_FREE( p->pPins );
+    ABC_FREE( p->pHashes );
+    ABC_FREE( p->pReps );
+    ABC_FREE( p->ppNets );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Pre-tokenizes the file.]
+
+  Description [The file is read into memory, divided into ranges, which 
+  are split into statements, and the actual nets of the gate instances 
+  are interned in each module. Both steps are performed by several threads.
+  Returns NULL if the file contains an unsupported construct.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Ver_Tok_t * Ver_TokStart( Mio_Library_t * pLib, char * pBuffer, iword nSize, int nThreads )
+{
+    Ver_ThData_t ThData[VER_THR_MAX];
+    char * ppBegs[VER_THR_MAX+1];
+    Ver_Tok_t * p;
+    int i, k, nNames, nStmts, fFail = 0, iModule = -1;
+    if ( !Ver_TokDivideFile( pBuffer, nSize, ppBegs, nThreads ) )
+        return NULL;
+    // split the text
+    memset( ThData, 0, sizeof(Ver_ThData_t) * nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pLib    = pLib;
+        ThData[i].pBeg    = ppBegs[i];
+        ThData[i].pEnd    = ppBegs[i+1];
+        ThData[i].vToks   = Vec_PtrAlloc( 100 );
+        ThData[i].vKinds  = Vec_StrAlloc( 100 );
+        ThData[i].vNames  = Vec_PtrAlloc( (ppBegs[i+1] - ppBegs[i]) / 16 + 16 );
+        ThData[i].vPins   = Vec_IntAlloc( (ppBegs[i+1] - ppBegs[i]) / 16 + 16 );
+        ThData[i].vHashes = Vec_IntAlloc( (ppBegs[i+1] - ppBegs[i]) / 16 + 16 );
+        ThData[i].vStmts  = Vec_IntAlloc( (ppBegs[i+1] - ppBegs[i]) / 64 + 16 );
+        ThData[i].vTypes  = Vec_IntAlloc( (ppBegs[i+1] - ppBegs[i]) / 64 + 16 );
+        ThData[i].vGates  = Vec_PtrAlloc( (ppBegs[i+1] - ppBegs[i]) / 64 + 16 );
+    }
+    Ver_TokPerformAll( ThData, nThreads );
+    // merge the statements
+    p = ABC_CALLOC( Ver_Tok_t, 1 );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        fFail    |= ThData[i].fFail;
+        p->nNames += Vec_PtrSize(ThData[i].vNames);
+        p->nStmts += Vec_IntSize(ThData[i].vStmts);
+    }
+    p->pStmtBeg   = ABC_ALLOC( int, p->nStmts + 1 );
+    p->pStmtType  = ABC_ALLOC( int, p->nStmts );
+    p->ppStmtGate = ABC_ALLOC( Mio_Gate_t *, p->nStmts );
+    p->ppNames    = ABC_ALLOC( char *, p->nNames );
+    p->pPins      = ABC_ALLOC( int, p->nNames );
+    p->pHashes    = ABC_ALLOC( unsigned, p->nNames );
+    for ( nNames = nStmts = i = 0; i < nThreads; i++ )
+    {
+        memcpy( p->pStmtType  + nStmts, Vec_IntArray(ThData[i].vTypes),  sizeof(int) * Vec_IntSize(ThData[i].vTypes) );
+        memcpy( p->ppStmtGate + nStmts, Vec_PtrArray(ThData[i].vGates),  sizeof(Mio_Gate_t *) * Vec_PtrSize(ThData[i].vGates) );
+        memcpy( p->ppNames    + nNames, Vec_PtrArray(ThData[i].vNames),  sizeof(char *) * Vec_PtrSize(ThData[i].vNames) );
+        memcpy( p->pPins      + nNames, Vec_IntArray(ThData[i].vPins),   sizeof(int) * Vec_IntSize(ThData[i].vPins) );
+        memcpy( p->pHashes    + nNames, Vec_IntArray(ThData[i].vHashes), sizeof(int) * Vec_IntSize(ThData[i].vHashes) );
+        for ( k = 0; k < Vec_IntSize(ThData[i].vStmts); k++ )
+            p->pStmtBeg[nStmts + k] = nNames + Vec_IntEntry(ThData[i].vStmts, k);
+        nNames += Vec_PtrSize(ThData[i].vNames);
+        nStmts += Vec_IntSize(ThData[i].vStmts);
+        Vec_PtrFree( ThData[i].vToks );
+        Vec_StrFree( ThData[i].vKinds );
+        Vec_PtrFree( ThData[i].vNames );
+        Vec_IntFree( ThData[i].vPins );
+        Vec_IntFree( ThData[i].vHashes );
+        Vec_IntFree( ThData[i].vStmts );
+        Vec_IntFree( ThData[i].vTypes );
+        Vec_PtrFree( ThData[i].vGates );
+    }
+    assert( nNames == p->nNames );
+    assert( nStmts == p->nStmts );
+    p->pStmtBeg[p->nStmts] = p->nNames;
+    p->pReps  = ABC_FALLOC( int, p->nNames );
+    p->ppNets = ABC_CALLOC( Abc_Obj_t *, p->nNames );
+    // intern the names in each module
+    for ( k = 0; k < p->nStmts && !fFail; k++ )
+    {
+        if ( p->pStmtType[k] == VER_TOK_MODULE )
+            iModule = p->pStmtBeg[k];
+        if ( p->pStmtType[k] != VER_TOK_END || iModule == -1 )
+            continue;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            ThData[i].p       = p;
+            ThData[i].fIntern = 1;
+            ThData[i].iStart  = iModule;
+            ThData[i].iStop   = p->pStmtBeg[k];
+            ThData[i].iShard  = i;
+            ThData[i].nShards = nThreads;
+        }
+        Ver_TokPerformAll( ThData, nThreads );
+        iModule = -1;
+    }
+    ABC_FREE( p->pHashes );
+    if ( fFail )
+    {
+        Ver_TokStop( p );
+        return NULL;
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the gate instance from the pre-tokenized statement.]
+
+  Description [Performs the same steps as Ver_ParseGate(). The actual net
+  is looked up once for each distinct name in the module.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ver_TokBuildGate( Ver_Man_t * pMan, Ver_Tok_t * p, Abc_Ntk_t * pNtk, int iStmt )
+{
+    Mio_Gate_t * pGate = p->ppStmtGate[iStmt];
+    Abc_Obj_t * pNetActual, * pNode, * pNode2 = NULL;
+    int Input, i, k, nFanins = Mio_GateReadPinNum(pGate);
+    if ( !Ver_ParseConvertNetwork( pMan, pNtk, 1 ) )
+        return 0;
+    // start the node
+    pNode = Abc_NtkCreateNode( pNtk );
+    pNode->pData = pGate;
+    if ( Mio_GateReadTwin(pGate) )
+    {
+        pNode2 = Abc_NtkCreateNode( pNtk );
+        pNode2->pData = Mio_GateReadTwin(pGate);
+    }
+    // add pairs of formal/actual inputs
+    Vec_IntClear( pMan->vPerm );
+    for ( k = p->pStmtBeg[iStmt]; k < p->pStmtBeg[iStmt+1]; k++ )
+    {
+        if ( p->ppNets[p->pReps[k]] == NULL )
+            p->ppNets[p->pReps[k]] = Ver_ParseFindNet( pNtk, p->ppNames[k] );
+        pNetActual = p->ppNets[p->pReps[k]];
+        if ( pNetActual == NULL )
+            return 0;
+        Input = p->pPins[k];
+        if ( Input < nFanins )
+        {
+            Vec_IntPush( pMan->vPerm, Input );
+            Abc_ObjAddFanin( pNode, pNetActual ); // fanin
+            if ( pNode2 )
+                Abc_ObjAddFanin( pNode2, pNetActual ); // fanin
+        }
+        else if ( Input == nFanins )
+            Abc_ObjAddFanin( pNetActual, pNode ); // fanout
+        else if ( Input == nFanins + 1 )
+            Abc_ObjAddFanin( pNetActual, pNode2 ); // fanout
+        else
+            assert( 0 );
+    }
+    // check that the gate as the same number of input
+    if ( !(Abc_ObjFaninNum(pNode) == nFanins && Abc_ObjFanoutNum(pNode) == 1) )
+        return 0;
+    // check if we need to permute the inputs
+    Vec_IntForEachEntry( pMan->vPerm, Input, i )
+        if ( Input != i )
+            break;
+    if ( i < Vec_IntSize(pMan->vPerm) )
+    {
+        // add the fanin numnbers to the end of the permuation array
+        for ( i = 0; i < nFanins; i++ )
+            Vec_IntPush( pMan->vPerm, Abc_ObjFaninId(pNode, i) );
+        // write the fanin numbers into their corresponding places (according to the gate) 
+        for ( i = 0; i < nFanins; i++ )
+            Vec_IntWriteEntry( &pNode->vFanins, Vec_IntEntry(pMan->vPerm, i), Vec_IntEntry(pMan->vPerm, i+nFanins) );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the modules from the pre-tokenized statements.]
+
+  Description [Performs the same steps as Ver_ParseModule(). Returns 0
+  if the statements do not form a sequence of flat modules, in which the 
+  declarations of inputs, outputs, and registers precede the gates, or 
+  if a gate cannot be created.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ver_TokBuild( Ver_Man_t * pMan, Ver_Tok_t * p )
+{
+    Abc_Ntk_t * pNtk = NULL;
+    int i, k, Type, fDecls = 0;
+    for ( i = 0; i < p->nStmts; i++ )
+    {
+        Type = p->pStmtType[i];
+        if ( (Type == VER_TOK_MODULE) != (pNtk == NULL) )
+            return 0;
+        if ( Type == VER_TOK_MODULE )
+        {
+            pNtk = Ver_ParseFindOrCreateNetwork( pMan, p->ppNames[p->pStmtBeg[i]] );
+            fDecls = 1;
+            // reserve the name manager for the declared signals
+            for ( k = i + 1; k < p->nStmts && p->pStmtType[k] >= VER_TOK_INPUT && p->pStmtType[k] <= VER_TOK_WIRE; k++ );
+            Nm_ManReserve( pNtk->pManName, p->pStmtBeg[k] - p->pStmtBeg[i+1] );
+        }
+        else if ( Type == VER_TOK_END )
+        {
+            if ( !Ver_ParseModuleFinish( pMan, pNtk ) )
+                return 0;
+            pNtk = NULL;
+        }
+        else if ( Type == VER_TOK_GATE )
+        {
+            if ( !Ver_TokBuildGate( pMan, p, pNtk, i ) )
+                return 0;
+            fDecls = 0;
+        }
+        else
+        {
+            // only wires can be declared after the gates
+            if ( Type != VER_TOK_WIRE && !fDecls )
+                return 0;
+            for ( k = p->pStmtBeg[i]; k < p->pStmtBeg[i+1]; k++ )
+            {
+                if ( Type == VER_TOK_INPUT || Type == VER_TOK_INOUT )
+                    Ver_ParseCreatePi( pNtk, p->ppNames[k] );
+                if ( Type == VER_TOK_OUTPUT || Type == VER_TOK_INOUT )
+                    Ver_ParseCreatePo( pNtk, p->ppNames[k] );
+                if ( Type == VER_TOK_WIRE || Type == VER_TOK_REG )
+                    Abc_NtkFindOrCreateNet( pNtk, p->ppNames[k] );
+            }
+        }
+    }
+    return pNtk == NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the mapped Verilog file using several threads.]
+
+  Description [This fast path is used for the large gate-level netlists
+  when the number of threads is given by "set readthreads <num>". The file
+  is pre-tokenized in parallel and the modules are built in one pass with
+  only one look-up in the name manager for each distinct actual net. 
+  Returns 0 if the fast path is not used or the file contains constructs 
+  not supported by it; in this case, the file is parsed by the stream 
+  parser, which also reports the errors.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ver_TokParse( Ver_Man_t * pMan )
+{
+    Mio_Library_t * pLib = (Mio_Library_t *)pMan->pDesign->pGenlib;
+    Abc_Des_t * pLibrary = pMan->pDesign->pLibrary;
+    Ver_Tok_t * p;
+    FILE * pFile;
+    char * pBuffer;
+    iword nSize;
+    int RetValue, nThreads = 1;
+    if ( !pMan->fMapped || pLib == NULL )
+        return 0;
+    if ( Abc_FrameReadFlag("readthreads") )
+        nThreads = Abc_MaxInt( 1, Abc_MinInt(atoi(Abc_FrameReadFlag("readthreads")), VER_THR_MAX) );
+    if ( nThreads == 1 || (pFile = fopen( pMan->pFileName, "rb" )) == NULL )
+        return 0;
+    fseek( pFile, 0, SEEK_END );
+    nSize = (iword)ftell( pFile );
+    if ( nSize / VER_TOK_MIN < nThreads )
+        nThreads = (int)(nSize / VER_TOK_MIN);
+    if ( nThreads <= 1 )
+    {
+        fclose( pFile );
+        return 0;
+    }
+    // read the file
+    rewind( pFile );
+    pBuffer = ABC_ALLOC( char, nSize + 1 );
+    RetValue = (fread( pBuffer, 1, nSize, pFile ) == (size_t)nSize);
+    fclose( pFile );
+    pBuffer[nSize] = 0;
+    // pre-tokenize the file and build the modules
+    p = RetValue ? Ver_TokStart( pLib, pBuffer, nSize, nThreads ) : NULL;
+    RetValue = p ? Ver_TokBuild( pMan, p ) : 0;
+    if ( p )
+        Ver_TokStop( p );
+    ABC_FREE( pBuffer );
+    if ( RetValue )
+        return 1;
+    // restore the empty design
+    Abc_DesFree( pMan->pDesign, NULL );
+    pMan->pDesign = Abc_DesCreate( pMan->pFileName );
+    pMan->pDesign->pLibrary = pLibrary;
+    pMan->pDesign->pGenlib  = pLib;
+    Hop_ManStop( (Hop_Man_t *)pMan->pDesign->pManFunc );
+    pMan->pDesign->pManFunc = NULL;
+    return 0;
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
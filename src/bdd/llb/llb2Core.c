@@ -333,9 +333,14 @@ int Llb_CoreReachability_int( Llb_Img_t * p, Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQ
         }
 
         // compute the next states
-        bNext = Llb_ImgComputeImage( p->pAig, p->vDdMans, p->dd, bCurrent, 
-            vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 
-            p->pPars->fBackward, p->pPars->fReorder, p->pPars->fVeryVerbose );
+        if ( p->pPars->nProcs > 1 )
+            bNext = Llb_ImgComputeImagePth( p->pAig, p->vDdMans, p->dd, bCurrent, 
+                vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 
+                p->pPars->fBackward, p->pPars->fReorder, p->pPars->nProcs, p->pPars->fVeryVerbose );
+        else
+            bNext = Llb_ImgComputeImage( p->pAig, p->vDdMans, p->dd, bCurrent, 
+                vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 
+                p->pPars->fBackward, p->pPars->fReorder, p->pPars->fVeryVerbose );
         if ( bNext == NULL )
         {
             if ( !p->pPars->fSilent )
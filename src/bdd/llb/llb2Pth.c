@@ -0,0 +1,288 @@
+/**CFile****************************************************************
+
+  FileName    [llb2Pth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [BDD based reachability.]
+
+  Synopsis    [Multi-threaded image computation using partitioned structure.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: llb2Pth.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "llbInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+DdNode * Llb_ImgComputeImagePth( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager * dd, DdNode * bInit,
+    Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQuant1, Vec_Int_t * vDriRefs,
+    abctime TimeTarget, int fBackward, int fReorder, int nProcs, int fVerbose )
+{
+    return Llb_ImgComputeImage( pAig, vDdMans, dd, bInit, vQuant0, vQuant1, vDriRefs, TimeTarget, fBackward, fReorder, fVerbose );
+}
+
+#else // pthreads are used
+
+#define PAR_THR_MAX 64
+
+// information given to the thread
+typedef struct Llb_ThData_t_
+{
+    Aig_Man_t *   pAig;       // the AIG (read-only)
+    Vec_Ptr_t *   vDdMans;    // partition managers (read-only)
+    Vec_Ptr_t *   vQuant0;    // quantification schedule
+    Vec_Ptr_t *   vQuant1;    // quantification schedule
+    Vec_Int_t *   vDriRefs;   // driver references
+    DdManager *   dd;         // the manager holding the states (read-only)
+    DdNode *      bStates;    // the part of the states in dd
+    DdManager *   ddThr;      // the private manager of the thread
+    DdNode *      bImage;     // the image of the part in ddThr
+    abctime       TimeTarget; // the time left
+    int           fBackward;  // backward reachability
+} Llb_ThData_t;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the image of one part of the states.]
+
+  Description [The states are transferred into the private manager of the
+  thread, which has the same variable order as the main manager. Dynamic
+  variable reordering is not used in the private managers because the
+  reordering code of CUDD relies on static variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Llb_ImgWorkerThread( void * pArg )
+{
+    Llb_ThData_t * pThData = (Llb_ThData_t *)pArg;
+    DdNode * bStates;
+    abctime TimeTarget = 0;
+    // the runtime is measured separately for each thread
+    if ( pThData->TimeTarget )
+        TimeTarget = Abc_Clock() + pThData->TimeTarget;
+    pThData->ddThr->TimeStop = TimeTarget;
+    pThData->bImage = NULL;
+    bStates = Cudd_bddTransfer( pThData->dd, pThData->ddThr, pThData->bStates );
+    if ( bStates != NULL )
+    {
+        Cudd_Ref( bStates );
+        pThData->bImage = Llb_ImgComputeImage( pThData->pAig, pThData->vDdMans, pThData->ddThr, bStates,
+            pThData->vQuant0, pThData->vQuant1, pThData->vDriRefs, TimeTarget, pThData->fBackward, 0, 0 );
+        if ( pThData->bImage )
+            Cudd_Ref( pThData->bImage );
+        Cudd_RecursiveDeref( pThData->ddThr, bStates );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the states into disjoint parts.]
+
+  Description [Uses the topmost variables in the support of the states.
+  The image of the states is the disjunction of the images of the parts.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Llb_ImgSplitStates( DdManager * dd, DdNode * bStates, int nParts )
+{
+    Vec_Ptr_t * vParts, * vVars;
+    DdNode * bSupp, * bCube, * bPart, * bTemp, * bVar;
+    int i, k, nVars = Abc_Base2Log( nParts + 1 ) - 1;
+    abctime TimeStop;
+    TimeStop = dd->TimeStop; dd->TimeStop = 0;
+    // collect the topmost support variables
+    vVars = Vec_PtrAlloc( nVars );
+    bSupp = Cudd_Support( dd, bStates );  Cudd_Ref( bSupp );
+    for ( bCube = bSupp; !Cudd_IsConstant(bCube) && Vec_PtrSize(vVars) < nVars; bCube = cuddT(bCube) )
+        Vec_PtrPush( vVars, Cudd_bddIthVar(dd, Cudd_NodeReadIndex(bCube)) );
+    Cudd_RecursiveDeref( dd, bSupp );
+    // derive the parts
+    vParts = Vec_PtrAlloc( 1 << Vec_PtrSize(vVars) );
+    for ( i = 0; i < (1 << Vec_PtrSize(vVars)); i++ )
+    {
+        bPart = bStates;  Cudd_Ref( bPart );
+        Vec_PtrForEachEntry( DdNode *, vVars, bVar, k )
+        {
+            bPart = Cudd_bddAnd( dd, bTemp = bPart, Cudd_NotCond(bVar, !((i >> k) & 1)) );  Cudd_Ref( bPart );
+            Cudd_RecursiveDeref( dd, bTemp );
+        }
+        if ( bPart == Cudd_ReadLogicZero(dd) )
+            Cudd_RecursiveDeref( dd, bPart );
+        else
+            Vec_PtrPush( vParts, bPart );
+    }
+    Vec_PtrFree( vVars );
+    dd->TimeStop = TimeStop;
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes image of the set of states using several threads.]
+
+  Description [The states are split into disjoint parts by cofactoring
+  with respect to the topmost variables. The image of each part is computed
+  by a separate thread in its own BDD manager, using the partitions of the
+  transition relation, which are kept in their own managers and only read
+  by the threads. The images of the parts are transferred back into the
+  main manager and added together.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_ImgComputeImagePth( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager * dd, DdNode * bInit,
+    Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQuant1, Vec_Int_t * vDriRefs,
+    abctime TimeTarget, int fBackward, int fReorder, int nProcs, int fVerbose )
+{
+    Llb_ThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Vec_Ptr_t * vParts;
+    DdNode * bPart, * bImage, * bTemp;
+    int i, status, fFailed = 0;
+    abctime clk = Abc_Clock();
+    // split the states
+    vParts = Llb_ImgSplitStates( dd, bInit, Abc_MinInt(nProcs, PAR_THR_MAX) );
+    if ( Vec_PtrSize(vParts) < 2 )
+    {
+        Vec_PtrForEachEntry( DdNode *, vParts, bPart, i )
+            Cudd_RecursiveDeref( dd, bPart );
+        Vec_PtrFree( vParts );
+        return Llb_ImgComputeImage( pAig, vDdMans, dd, bInit, vQuant0, vQuant1, vDriRefs, TimeTarget, fBackward, fReorder, fVerbose );
+    }
+    // start the threads
+    Vec_PtrForEachEntry( DdNode *, vParts, bPart, i )
+    {
+        ThData[i].pAig       = pAig;
+        ThData[i].vDdMans    = vDdMans;
+        ThData[i].vQuant0    = vQuant0;
+        ThData[i].vQuant1    = vQuant1;
+        ThData[i].vDriRefs   = vDriRefs;
+        ThData[i].dd         = dd;
+        ThData[i].bStates    = bPart;
+        ThData[i].ddThr      = Cudd_Init( Cudd_ReadSize(dd), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+        ThData[i].bImage     = NULL;
+        ThData[i].TimeTarget = TimeTarget ? Abc_MaxInt( (int)((TimeTarget - Abc_Clock()) / CLOCKS_PER_SEC), 1 ) * CLOCKS_PER_SEC : 0;
+        ThData[i].fBackward  = fBackward;
+        // use the variable order of the main manager
+        Cudd_ShuffleHeap( ThData[i].ddThr, dd->invperm );
+    }
+    Vec_PtrForEachEntry( DdNode *, vParts, bPart, i )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Llb_ImgWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    Vec_PtrForEachEntry( DdNode *, vParts, bPart, i )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    // add the images together
+    bImage = Cudd_ReadLogicZero( dd );  Cudd_Ref( bImage );
+    Vec_PtrForEachEntry( DdNode *, vParts, bPart, i )
+    {
+        Cudd_RecursiveDeref( dd, bPart );
+        if ( ThData[i].bImage == NULL )
+            fFailed = 1;
+        if ( !fFailed )
+        {
+            bPart = Cudd_bddTransfer( ThData[i].ddThr, dd, ThData[i].bImage );
+            if ( bPart == NULL )
+                fFailed = 1;
+            else
+            {
+                Cudd_Ref( bPart );
+                bImage = Cudd_bddOr( dd, bTemp = bImage, bPart );
+                if ( bImage == NULL )
+                {
+                    bImage = bTemp;
+                    fFailed = 1;
+                }
+                else
+                {
+                    Cudd_Ref( bImage );
+                    Cudd_RecursiveDeref( dd, bTemp );
+                }
+                Cudd_RecursiveDeref( dd, bPart );
+            }
+        }
+        if ( ThData[i].bImage == NULL ) // the image computation was interrupted
+        {
+            Cudd_Quit( ThData[i].ddThr );
+            continue;
+        }
+        Cudd_RecursiveDeref( ThData[i].ddThr, ThData[i].bImage );
+        Extra_StopManager( ThData[i].ddThr );
+    }
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "        Image of %d parts using %d threads =%6d. ", Vec_PtrSize(vParts), Vec_PtrSize(vParts), fFailed ? 0 : Cudd_DagSize(bImage) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrFree( vParts );
+    if ( fFailed )
+    {
+        Cudd_RecursiveDeref( dd, bImage );
+        return NULL;
+    }
+    if ( fReorder )
+    {
+        if ( fVerbose )
+            Abc_Print( 1, "        Reordering... Before =%5d. ", Cudd_DagSize(bImage) );
+        Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 100 );
+        if ( fVerbose )
+            Abc_Print( 1, "After =%5d. ", Cudd_DagSize(bImage) );
+        if ( fVerbose )
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Cudd_Deref( bImage );
+    return bImage;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
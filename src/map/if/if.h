@@ -112,6 +112,7 @@ struct If_Par_t_
     int                nStructType;   // type of the structure
     int                nAndDelay;     // delay of AND-gate in LUT library units
     int                nAndArea;      // area of AND-gate in LUT library units
+    int                nProcs;        // the number of threads mapping level by level (0 = node by node)
     int                fPreprocess;   // preprossing
     int                fArea;         // area-oriented mapping
     int                fFancy;        // a fancy feature
@@ -218,6 +219,7 @@ struct If_Man_t_
     unsigned           uSharedMask;   // mask of shared variables
     int                nShared;       // the number of shared variables
     int                fReqTimeWarn;  // warning about exceeding required times was printed
+    int                fThreadCopy;   // thread-private copy of the manager (refs are updated by the caller)
     // SOP balancing
     Vec_Int_t *        vCover;        // used to compute ISOP
     Vec_Int_t *        vArray;        // intermediate storage
@@ -632,6 +634,10 @@ extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, int fFirst, char * pLabel );
+/*=== ifPth.c =============================================================*/
+extern int             If_ManPerformMappingCheckPar( If_Man_t * p, int Mode );
+extern void            If_ManPerformMappingRoundLevel( If_Man_t * p, int Mode, int fPreprocess, int fFirst );
+extern void            If_ManPerformMappingRoundPar( If_Man_t * p, int Mode, int fPreprocess, int fFirst );
 /*=== ifReduce.c ==========================================================*/
 extern void            If_ManImproveMapping( If_Man_t * p );
 /*=== ifSat.c ==========================================================*/
@@ -671,6 +677,8 @@ extern float           If_ManScanMappingDirect( If_Man_t * p );
 extern float           If_ManScanMappingSeq( If_Man_t * p );
 extern void            If_ManResetOriginalRefs( If_Man_t * p );
 extern int             If_ManCrossCut( If_Man_t * p );
+extern Vec_Wec_t *     If_ManCollectLevels( If_Man_t * p );
+extern int             If_ManCrossCutLevel( If_Man_t * p );
 
 extern Vec_Ptr_t *     If_ManReverseOrder( If_Man_t * p );
 extern void            If_ManMarkMapping( If_Man_t * p );
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "if.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -62,6 +63,7 @@ void If_ManSetDefaultPars( If_Par_t * pPars )
     pPars->fPower      =  0;
     pPars->fCutMin     =  0;
     pPars->fBidec      =  0;
+    pPars->nProcs      =  0;
     pPars->fVerbose    =  0;
 }
 
@@ -82,8 +84,11 @@ int If_ManPerformMapping( If_Man_t * p )
     p->pPars->fAreaOnly = p->pPars->fArea; // temporary
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
-    // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    // allocate memory for other cutsets (the multi-threaded mapper goes level by level)
+    if ( p->pPars->nProcs > 0 )
+        If_ManSetupSetAll( p, Abc_MaxInt(If_ManCrossCut(p), If_ManCrossCutLevel(p)) );
+    else
+        If_ManSetupSetAll( p, If_ManCrossCut(p) );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
     return If_ManPerformMappingComb( p );
@@ -162,6 +167,7 @@ int If_ManPerformMappingComb( If_Man_t * p )
     }
 //    Abc_Print( 1, "Cross cut memory = %d.\n", Mem_FixedReadMaxEntriesUsed(p->pMemSet) );
     s_MappingTime = Abc_Clock() - clkTotal;
+    Util_ProfTimeAdd( "if.total", s_MappingTime );
 //    Abc_Print( 1, "Special POs = %d.\n", If_ManCountSpecialPos(p) );
 
 /*
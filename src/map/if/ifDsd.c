@@ -2070,7 +2070,12 @@ int If_DsdManCompute( If_DsdMan_t * p, word * pTruth, int nLeaves, unsigned char
     assert( nLeaves <= DAU_MAX_VAR );
     Abc_TtCopy( pCopy, pTruth, nWords, 0 );
 //clk = Abc_Clock();
-    nSizeNonDec = Dau_DsdDecompose( pCopy, nLeaves, 0, 1, pDsd );
+    nSizeNonDec = Dau_NpnCacheLookupDsd( pTruth, nLeaves, pDsd, pCopy );
+    if ( nSizeNonDec == -1 )
+    {
+        nSizeNonDec = Dau_DsdDecompose( pCopy, nLeaves, 0, 1, pDsd );
+        Dau_NpnCacheInsertDsd( pTruth, nLeaves, pDsd, pCopy, nSizeNonDec );
+    }
 //p->timeDsd += Abc_Clock() - clk;
     if ( nSizeNonDec > 0 )
         Abc_TtStretch6( pCopy, nSizeNonDec, p->nVars );
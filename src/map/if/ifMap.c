@@ -20,6 +20,7 @@
 
 #include "if.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -178,7 +179,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     else if ( Mode == 1 )
         pObj->EstRefs = (float)((2.0 * pObj->EstRefs + pObj->nRefs) / 3.0);
     // deref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
+    if ( Mode && pObj->nRefs > 0 && !p->fThreadCopy )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
     // prepare the cutset
@@ -477,7 +478,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
 //        p->nBestCutSmall[1]++;
 
     // ref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
+    if ( Mode && pObj->nRefs > 0 && !p->fThreadCopy )
         If_CutAreaRef( p, If_ObjCutBest(pObj) );
     if ( If_ObjCutBest(pObj)->fUseless )
         Abc_Print( 1, "The best cut is useless.\n" );
@@ -485,8 +486,9 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( p->pPars->pFuncUser )
         If_ObjForEachCut( pObj, pCut, i )
             p->pPars->pFuncUser( p, pObj, pCut );
-    // free the cuts
-    If_ManDerefNodeCutSet( p, pObj );
+    // free the cuts (the thread-private copy leaves it to the caller)
+    if ( !p->fThreadCopy )
+        If_ManDerefNodeCutSet( p, pObj );
 }
 
 /**Function*************************************************************
@@ -637,6 +639,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( p->pPars->nProcs > 0 && If_ManPerformMappingCheckPar(p, Mode) )
+        If_ManPerformMappingRoundPar( p, Mode, fPreprocess, fFirst );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
@@ -667,6 +671,11 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
 //    Abc_Print( 1, "Max number of cuts = %d. Average number of cuts = %5.2f.\n", 
 //        p->nCutsMax, 1.0 * p->nCutsMerged / If_ManAndNum(p) );
     }
+    if ( Util_ProfIsEnabled() )
+    {
+        Util_ProfTimeAdd( fPreprocess ? "if.preprocess" : (Mode == 0 ? "if.delay" : (Mode == 1 ? "if.flow" : "if.area")), Abc_Clock() - clk );
+        Util_ProfCountAdd( "if.cuts", p->nCutsMerged );
+    }
     return 1;
 }
 
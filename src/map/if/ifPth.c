@@ -0,0 +1,324 @@
+/**CFile****************************************************************
+
+  FileName    [ifPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [FPGA mapping based on priority cuts.]
+
+  Synopsis    [Multi-threaded cut enumeration.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 21, 2006.]
+
+  Revision    [$Id: ifPth.c,v 1.00 2006/11/21 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "if.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef ABC_USE_PTHREADS
+
+#define PAR_THR_MAX 100
+
+typedef struct If_ThData_t_
+{
+    If_Man_t *  pMan;        // thread-private copy of the manager
+    Vec_Int_t * vNodes;      // nodes of the current level
+    int         iStart;      // the first node to map
+    int         iStop;       // the node after the last one to map
+    int         Mode;        // mapping mode
+    int         fPreprocess; // preprocessing round
+    int         fFirst;      // the first round
+    int         fWorking;    // the thread is busy
+    abctime     clkUsed;     // runtime of the thread
+} If_ThData_t;
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the mapping round can be done level by level.]
+
+  Description [Truth tables, choices, boxes, user callbacks and the
+  features relying on the shared storage are only supported by the
+  node-by-node mapper. Exact area recovery is inherently sequential.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingCheckPar( If_Man_t * p, int Mode )
+{
+    If_Par_t * pPars = p->pPars;
+    if ( Mode == 2 )
+        return 0;
+    if ( p->pManTim || p->nChoices > 0 )
+        return 0;
+    if ( pPars->fTruth || pPars->fUserRecLib || pPars->fUserSesLib || pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->nGateSize > 0 )
+        return 0;
+    if ( pPars->pFuncCost || pPars->pFuncUser || pPars->fLiftLeaves )
+        return 0;
+    // pin-to-pin delay computation uses static storage
+    if ( pPars->pLutLib && pPars->pLutLib->fVarPinDelays )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass over all nodes level by level.]
+
+  Description [The selected cuts of the nodes on one level are dereferenced 
+  before the level is mapped, and referenced again in the topological order 
+  after all nodes of the level are mapped. The cutsets of the fanins are 
+  recycled at the same time. This is the single-threaded counterpart of 
+  the multi-threaded mapper, which gives the same result.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManPerformMappingRoundLevel( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj;
+    int i, k, iObj;
+    assert( Mode == 0 || Mode == 1 );
+    assert( !p->fThreadCopy );
+    vLevels = If_ManCollectLevels( p );
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        // deref the selected cuts
+        if ( Mode )
+            Vec_IntForEachEntry( vLevel, iObj, k )
+                if ( (pObj = If_ManObj(p, iObj))->nRefs > 0 )
+                    If_CutAreaDeref( p, If_ObjCutBest(pObj) );
+        // map the nodes leaving the refs and the cutsets to this procedure
+        p->fThreadCopy = 1;
+        Vec_IntForEachEntry( vLevel, iObj, k )
+            If_ObjPerformMappingAnd( p, If_ManObj(p, iObj), Mode, fPreprocess, fFirst );
+        p->fThreadCopy = 0;
+        // ref the selected cuts and recycle the cutsets
+        Vec_IntForEachEntry( vLevel, iObj, k )
+        {
+            pObj = If_ManObj( p, iObj );
+            if ( Mode && pObj->nRefs > 0 )
+                If_CutAreaRef( p, If_ObjCutBest(pObj) );
+            If_ManDerefNodeCutSet( p, pObj );
+        }
+    }
+    Vec_WecFree( vLevels );
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void If_ManPerformMappingRoundPar( If_Man_t * p, int Mode, int fPreprocess, int fFirst ) 
+{
+    If_ManPerformMappingRoundLevel( p, Mode, fPreprocess, fFirst );
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Maps a range of nodes belonging to the same level.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * If_ManWorkerThread( void * pArg )
+{
+    If_ThData_t * pThData = (If_ThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    abctime clk;
+    int i;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->vNodes == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        clk = Abc_Clock();
+        for ( i = pThData->iStart; i < pThData->iStop; i++ )
+            If_ObjPerformMappingAnd( pThData->pMan, If_ManObj(pThData->pMan, Vec_IntEntry(pThData->vNodes, i)), pThData->Mode, pThData->fPreprocess, pThData->fFirst );
+        pThData->clkUsed += Abc_Clock() - clk;
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass over all nodes using several threads.]
+
+  Description [Nodes are mapped level by level. The nodes on one level
+  depend only on the lower levels, so they are split into contiguous
+  ranges mapped concurrently by the threads. Each thread works on its own
+  copy of the manager, which provides private scratch storage and a private
+  list of free cutsets. Cutset recycling and reference counting for area
+  flow are done by the main thread in the topological order before and
+  after the level is mapped, so the result is the same for any number of
+  threads, including one. It may differ from the result of the default 
+  mapper, which updates the references after each node.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManPerformMappingRoundPar( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    pthread_t WorkerThread[PAR_THR_MAX];
+    If_ThData_t ThData[PAR_THR_MAX];
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj;
+    If_Set_t * pCutSet;
+    int nProcs = Abc_MinInt( p->pPars->nProcs, PAR_THR_MAX );
+    int i, k, t, iObj, status, nPerThread, fRunning;
+    assert( Mode == 0 || Mode == 1 );
+    if ( nProcs == 1 )
+    {
+        If_ManPerformMappingRoundLevel( p, Mode, fPreprocess, fFirst );
+        return;
+    }
+    vLevels = If_ManCollectLevels( p );
+    // start the threads
+    for ( t = 0; t < nProcs; t++ )
+    {
+        ThData[t].pMan = ABC_ALLOC( If_Man_t, 1 );
+        memcpy( ThData[t].pMan, p, sizeof(If_Man_t) );
+        ThData[t].pMan->fThreadCopy = 1;
+        ThData[t].pMan->pFreeList   = NULL;
+        ThData[t].pMan->nCutsMerged = 0;
+        ThData[t].pMan->nCutsTotal  = 0;
+        ThData[t].vNodes      = NULL;
+        ThData[t].iStart      = 0;
+        ThData[t].iStop       = 0;
+        ThData[t].Mode        = Mode;
+        ThData[t].fPreprocess = fPreprocess;
+        ThData[t].fFirst      = fFirst;
+        ThData[t].fWorking    = 0;
+        ThData[t].clkUsed     = 0;
+        status = pthread_create( WorkerThread + t, NULL, If_ManWorkerThread, (void *)(ThData + t) );  assert( status == 0 );
+    }
+    // map the nodes level by level
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        // deref the selected cuts
+        if ( Mode )
+            Vec_IntForEachEntry( vLevel, iObj, k )
+                if ( (pObj = If_ManObj(p, iObj))->nRefs > 0 )
+                    If_CutAreaDeref( p, If_ObjCutBest(pObj) );
+        // distribute the nodes and the free cutsets among the threads
+        nPerThread = (Vec_IntSize(vLevel) + nProcs - 1) / nProcs;
+        for ( t = 0; t < nProcs; t++ )
+        {
+            assert( ThData[t].pMan->pFreeList == NULL );
+            ThData[t].vNodes = vLevel;
+            ThData[t].iStart = Abc_MinInt( t * nPerThread, Vec_IntSize(vLevel) );
+            ThData[t].iStop  = Abc_MinInt( (t + 1) * nPerThread, Vec_IntSize(vLevel) );
+            for ( k = ThData[t].iStart; k < ThData[t].iStop; k++ )
+            {
+                assert( p->pFreeList != NULL );
+                pCutSet = p->pFreeList;
+                p->pFreeList = pCutSet->pNext;
+                pCutSet->pNext = ThData[t].pMan->pFreeList;
+                ThData[t].pMan->pFreeList = pCutSet;
+            }
+        }
+        for ( t = 0; t < nProcs; t++ )
+            if ( ThData[t].iStart < ThData[t].iStop )
+                ThData[t].fWorking = 1;
+        // wait till the threads finish
+        for ( fRunning = 1; fRunning; )
+        {
+            fRunning = 0;
+            for ( t = 0; t < nProcs; t++ )
+                if ( ThData[t].fWorking )
+                    fRunning = 1;
+        }
+        // ref the selected cuts and recycle the cutsets
+        Vec_IntForEachEntry( vLevel, iObj, k )
+        {
+            pObj = If_ManObj( p, iObj );
+            if ( Mode && pObj->nRefs > 0 )
+                If_CutAreaRef( p, If_ObjCutBest(pObj) );
+            If_ManDerefNodeCutSet( p, pObj );
+        }
+    }
+    // stop the threads
+    for ( t = 0; t < nProcs; t++ )
+    {
+        assert( !ThData[t].fWorking );
+        ThData[t].vNodes = NULL;
+        ThData[t].fWorking = 1;
+    }
+    for ( t = 0; t < nProcs; t++ )
+    {
+        status = pthread_join( WorkerThread[t], NULL );  assert( status == 0 );
+        assert( ThData[t].pMan->pFreeList == NULL );
+        p->nCutsMerged += ThData[t].pMan->nCutsMerged;
+        p->nCutsTotal  += ThData[t].pMan->nCutsTotal;
+        ABC_FREE( ThData[t].pMan );
+    }
+    Vec_WecFree( vLevels );
+    if ( p->pPars->fVerbose )
+    {
+        for ( t = 0; t < nProcs; t++ )
+        {
+            Abc_Print( 1, "Thread %2d : ", t );
+            Abc_PrintTime( 1, "Time", ThData[t].clkUsed );
+        }
+    }
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
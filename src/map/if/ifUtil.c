@@ -349,6 +349,79 @@ int If_ManCrossCut( If_Man_t * p )
     return nCutSizeMax;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects AND nodes by logic level.]
+
+  Description [Each level lists the node IDs in the increasing order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * If_ManCollectLevels( If_Man_t * p )
+{
+    Vec_Wec_t * vLevels;
+    If_Obj_t * pObj;
+    int i;
+    vLevels = Vec_WecStart( p->nLevelMax + 1 );
+    If_ManForEachNode( p, pObj, i )
+        Vec_WecPush( vLevels, pObj->Level, pObj->Id );
+    return vLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cross-cut of the circuit traversed level by level.]
+
+  Description [Assumes that the cutsets of all nodes on one level are
+  allocated at the same time and recycled after the level is processed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCrossCutLevel( If_Man_t * p )
+{
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj, * pFanin;
+    int i, k, iObj, nCutSize = 0, nCutSizeMax = 0;
+    vLevels = If_ManCollectLevels( p );
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        // consider the nodes
+        nCutSize += Vec_IntSize(vLevel);
+        if ( nCutSizeMax < nCutSize )
+            nCutSizeMax = nCutSize;
+        Vec_IntForEachEntry( vLevel, iObj, k )
+        {
+            pObj = If_ManObj( p, iObj );
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            // consider the fanins
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            // consider the choice class
+            if ( pObj->fRepr )
+                for ( pFanin = pObj; pFanin; pFanin = pFanin->pEquiv )
+                    if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                        nCutSize--;
+        }
+    }
+    If_ManForEachObj( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    Vec_WecFree( vLevels );
+    assert( nCutSize == 0 );
+    return nCutSizeMax;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the reverse topological order of nodes.]
@@ -187,6 +187,64 @@ void Abc_SclComputeLoad( SC_Man * p )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Recomputes load of one object.]
+
+  Description [The capacitances are added in the same order as in
+  Abc_SclComputeLoad(), that is, the fanout nodes are visited in the
+  order of their IDs, followed by the COs, followed by the wire load.
+  As a result, the load is bit-identical to the one computed for the
+  whole network, which is not the case for the loads updated using
+  the difference of pin capacitances.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclComputeLoadObj( SC_Man * p, Abc_Obj_t * pObj )
+{
+    SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
+    Abc_Obj_t * pFanout, * pFanin;
+    int i, k, iCo;
+    assert( !Abc_ObjIsPo(pObj) );
+    pLoad->rise = pLoad->fall = 0.0;
+    // add cell load
+    Vec_IntClear( p->vFanouts );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+        if ( Abc_ObjIsNode(pFanout) )
+            Vec_IntPush( p->vFanouts, Abc_ObjId(pFanout) );
+    Vec_IntSort( p->vFanouts, 0 );
+    Vec_IntUniqify( p->vFanouts );
+    Abc_NtkForEachObjVec( p->vFanouts, p->pNtk, pFanout, i )
+    {
+        SC_Cell * pCell = Abc_SclObjCell( pFanout );
+        Abc_ObjForEachFanin( pFanout, pFanin, k )
+            if ( pFanin == pObj )
+            {
+                SC_Pin * pPin = SC_CellPin( pCell, k );
+                pLoad->rise += pPin->rise_cap;
+                pLoad->fall += pPin->fall_cap;
+            }
+    }
+    // add PO load
+    Vec_IntClear( p->vFanouts );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+        if ( Abc_ObjIsCo(pFanout) )
+            Vec_IntPush( p->vFanouts, pFanout->iData );
+    Vec_IntSort( p->vFanouts, 0 );
+    Vec_IntForEachEntry( p->vFanouts, iCo, i )
+    {
+        SC_Pair * pLoadPo = Abc_SclObjLoad( p, Abc_NtkCo(p->pNtk, iCo) );
+        pLoad->rise += pLoadPo->rise;
+        pLoad->fall += pLoadPo->fall;
+    }
+    // add wire load
+    if ( p->pWLoadUsed != NULL && (Abc_ObjIsPi(pObj) || (Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) > 0)) )
+        Abc_SclAddWireLoad( p, pObj, 0 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Updates load of the node's fanins.]
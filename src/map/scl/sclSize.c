@@ -276,25 +276,48 @@ static inline void Abc_SclDeptFanin( SC_Man * p, SC_Timing * pTime, Abc_Obj_t *
     SC_Pair * pDepOut  = Abc_SclObjDept( p, pObj );
     Scl_LibPinDeparture( pTime, pDepIn, pSlewIn, pLoad, pDepOut );
 }
+static inline float Abc_SclObjLoadValue( SC_Man * p, Abc_Obj_t * pObj )
+{
+//    float Value = Abc_MaxFloat(pLoad->fall, pLoad->rise) / (p->EstLoadAve * p->EstLoadMax);
+    return (0.5 * Abc_SclObjLoad(p, pObj)->fall + 0.5 * Abc_SclObjLoad(p, pObj)->rise) / (p->EstLoadAve * p->EstLoadMax);
+}
 static inline void Abc_SclDeptObj( SC_Man * p, Abc_Obj_t * pObj )
 {
-    SC_Timing * pTime;
-    Abc_Obj_t * pFanout;
-    int i;
+    SC_Pair * pLoad, * pDepOut, Load, Dept;
+    Abc_Obj_t * pFanout, * pFanin;
+    int i, k, fEst;
+    float Value;
     SC_PairClean( Abc_SclObjDept(p, pObj) );
     Abc_ObjForEachFanout( pObj, pFanout, i )
     {
         if ( Abc_ObjIsCo(pFanout) || Abc_ObjIsLatch(pFanout) )
             continue;
-        pTime = Scl_CellPinTime( Abc_SclObjCell(pFanout), Abc_NodeFindFanin(pFanout, pObj) );
-        Abc_SclDeptFanin( p, pTime, pFanout, pObj );
+        // use the same buffer-tree estimation as Abc_SclTimeNode()
+        pLoad   = Abc_SclObjLoad( p, pFanout );
+        pDepOut = Abc_SclObjDept( p, pFanout );
+        Value   = p->EstLoadMax ? Abc_SclObjLoadValue( p, pFanout ) : 0;
+        fEst    = p->EstLoadMax && Value > 1;
+        if ( fEst )
+        {
+            float EstDelta = p->EstLinear * log( Value );
+            Load = *pLoad;
+            Dept = *pDepOut;
+            pLoad->rise = p->EstLoadAve * p->EstLoadMax;
+            pLoad->fall = p->EstLoadAve * p->EstLoadMax;
+            pDepOut->rise += EstDelta;
+            pDepOut->fall += EstDelta;
+        }
+        // the node may be connected to several pins of the fanout
+        Abc_ObjForEachFanin( pFanout, pFanin, k )
+            if ( pFanin == pObj )
+                Abc_SclDeptFanin( p, Scl_CellPinTime(Abc_SclObjCell(pFanout), k), pFanout, pObj );
+        if ( fEst )
+        {
+            *pLoad   = Load;
+            *pDepOut = Dept;
+        }
     }
 }
-static inline float Abc_SclObjLoadValue( SC_Man * p, Abc_Obj_t * pObj )
-{
-//    float Value = Abc_MaxFloat(pLoad->fall, pLoad->rise) / (p->EstLoadAve * p->EstLoadMax);
-    return (0.5 * Abc_SclObjLoad(p, pObj)->fall + 0.5 * Abc_SclObjLoad(p, pObj)->rise) / (p->EstLoadAve * p->EstLoadMax);
-}
 static inline void Abc_SclTimeCi( SC_Man * p, Abc_Obj_t * pObj )
 {
     if ( p->pPiDrive != NULL )
@@ -402,6 +425,8 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     Abc_Obj_t * pObj;
     float D;
     int i;
+    // the pending incremental updates are subsumed
+    Vec_IntClear( p->vChanged );
     Abc_SclComputeLoad( p );
     Abc_SclManCleanTime( p );
     p->nEstNodes = 0;
@@ -430,7 +455,14 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
 
   Synopsis    [Incremental timing update.]
 
-  Description []
+  Description [The objects whose timing may change are kept in the
+  levelized queue (p->vLevels) and marked with fMarkC. The arrival times
+  are propagated forward, and the departure times are propagated backward,
+  through the objects whose values changed. The values are compared
+  exactly, so the result is identical to the full timing recomputation,
+  as long as the buffer-tree estimation is not used. (The estimation
+  depends on the average load, which is only updated by the full
+  recomputation.)]
                
   SideEffects []
 
@@ -483,7 +515,6 @@ static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
     SC_Pair ArrOut, SlewOut;
     SC_Pair * pArrOut, *pSlewOut;
     Abc_Obj_t * pObj;
-    float E = (float)0.1;
     int i, k;
     Vec_WecForEachLevel( p->vLevels, vLevel, i )
     {
@@ -496,13 +527,15 @@ static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
                 Vec_QueUpdate( p->vQue, pObj->iData );
                 continue;
             }
+            // constant nodes are not timed by Abc_SclTimeNtkRecompute()
+            if ( Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) == 0 )
+                continue;
             pArrOut  = Abc_SclObjTime( p, pObj );
             pSlewOut = Abc_SclObjSlew( p, pObj );
             SC_PairMove( &ArrOut,  pArrOut  );
             SC_PairMove( &SlewOut, pSlewOut );
             Abc_SclTimeNode( p, pObj, 0 );
-//            if ( !SC_PairEqual(&ArrOut, pArrOut) || !SC_PairEqual(&SlewOut, pSlewOut) )
-            if ( !SC_PairEqualE(&ArrOut, pArrOut, E) || !SC_PairEqualE(&SlewOut, pSlewOut, E) )
+            if ( !SC_PairEqual(&ArrOut, pArrOut) || !SC_PairEqual(&SlewOut, pSlewOut) )
                 Abc_SclTimeIncAddFanouts( p, pObj );
         }
     }
@@ -513,7 +546,6 @@ static inline void Abc_SclTimeIncUpdateDeparture( SC_Man * p )
     Vec_Int_t * vLevel;
     SC_Pair DepOut, * pDepOut;
     Abc_Obj_t * pObj;
-    float E = (float)0.1;
     int i, k;
     Vec_WecForEachLevelReverse( p->vLevels, vLevel, i )
     {
@@ -522,8 +554,7 @@ static inline void Abc_SclTimeIncUpdateDeparture( SC_Man * p )
             pDepOut = Abc_SclObjDept( p, pObj );
             SC_PairMove( &DepOut, pDepOut );
             Abc_SclDeptObj( p, pObj );
-//            if ( !SC_PairEqual(&DepOut, pDepOut) )
-            if ( !SC_PairEqualE(&DepOut, pDepOut, E) )
+            if ( !SC_PairEqual(&DepOut, pDepOut) )
                 Abc_SclTimeIncAddFanins( p, pObj );
         }
     } 
@@ -539,26 +570,69 @@ void Abc_SclTimeIncCheckLevel( Abc_Ntk_t * pNtk )
 }
 int Abc_SclTimeIncUpdate( SC_Man * p )
 {
-    Abc_Obj_t * pObj;
-    int i, RetValue;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, RetValue;
     if ( Vec_IntSize(p->vChanged) == 0 )
         return 0;
 //    Abc_SclTimeIncCheckLevel( p->pNtk );
+    // the loads of the fanins changed with the pin capacitances of the new cells
+    Abc_NtkForEachObjVec( p->vChanged, p->pNtk, pObj, i )
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            if ( !Abc_ObjIsLatch(pFanin) )
+                Abc_SclComputeLoadObj( p, pFanin );
     Abc_NtkForEachObjVec( p->vChanged, p->pNtk, pObj, i )
     {
         Abc_SclTimeIncAddFanins( p, pObj );
+        // the departure times of the fanins' fanins depend on the loads of the fanins
+        if ( p->fUseDept )
+            Abc_ObjForEachFanin( pObj, pFanin, k )
+                if ( !Abc_ObjIsLatch(pFanin) )
+                    Abc_SclTimeIncAddFanins( p, pFanin );
         if ( pObj->fMarkC )
             continue;
         Abc_SclTimeIncAddNode( p, pObj );
     }
     Vec_IntClear( p->vChanged );
     Abc_SclTimeIncUpdateArrival( p );
-    Abc_SclTimeIncUpdateDeparture( p );
+    if ( p->fUseDept )
+        Abc_SclTimeIncUpdateDeparture( p );
     Abc_SclTimeIncUpdateClean( p );
     RetValue = p->nIncUpdates;
     p->nIncUpdates = 0;
     return RetValue;
 }
+int Abc_SclTimeIncCheck( SC_Man * p )
+{
+    SC_Pair * pLoads = ABC_ALLOC( SC_Pair, p->nObjs );
+    SC_Pair * pTimes = ABC_ALLOC( SC_Pair, p->nObjs );
+    SC_Pair * pSlews = ABC_ALLOC( SC_Pair, p->nObjs );
+    SC_Pair * pDepts = ABC_ALLOC( SC_Pair, p->nObjs );
+    int i, nDiffs = 0;
+    memcpy( pLoads, p->pLoads, sizeof(SC_Pair) * p->nObjs );
+    memcpy( pTimes, p->pTimes, sizeof(SC_Pair) * p->nObjs );
+    memcpy( pSlews, p->pSlews, sizeof(SC_Pair) * p->nObjs );
+    memcpy( pDepts, p->pDepts, sizeof(SC_Pair) * p->nObjs );
+    Abc_SclTimeNtkRecompute( p, NULL, NULL, p->fUseDept, 0 );
+    for ( i = 0; i < p->nObjs; i++ )
+    {
+        if ( !memcmp(pLoads + i, p->pLoads + i, sizeof(SC_Pair)) && !memcmp(pTimes + i, p->pTimes + i, sizeof(SC_Pair)) &&
+             !memcmp(pSlews + i, p->pSlews + i, sizeof(SC_Pair)) && !memcmp(pDepts + i, p->pDepts + i, sizeof(SC_Pair)) )
+            continue;
+        if ( nDiffs++ < 10 )
+            printf( "Object %6d : Load %f %f  Time %f %f  Slew %f %f  Dept %f %f\n", i, 
+                pLoads[i].rise - p->pLoads[i].rise, pLoads[i].fall - p->pLoads[i].fall, 
+                pTimes[i].rise - p->pTimes[i].rise, pTimes[i].fall - p->pTimes[i].fall, 
+                pSlews[i].rise - p->pSlews[i].rise, pSlews[i].fall - p->pSlews[i].fall, 
+                pDepts[i].rise - p->pDepts[i].rise, pDepts[i].fall - p->pDepts[i].fall );
+    }
+    if ( nDiffs )
+        printf( "Incremental timing differs from full timing for %d objects.\n", nDiffs );
+    ABC_FREE( pLoads );
+    ABC_FREE( pTimes );
+    ABC_FREE( pSlews );
+    ABC_FREE( pDepts );
+    return nDiffs == 0;
+}
 void Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj )
 {
     Vec_IntPush( p->vChanged, Abc_ObjId(pObj) );
@@ -633,6 +707,7 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
 SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+    p->fUseDept = fDept;
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
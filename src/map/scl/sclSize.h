@@ -81,7 +81,9 @@ struct SC_Man_
     // incremental timing update
     Vec_Wec_t *    vLevels;
     Vec_Int_t *    vChanged; 
+    Vec_Int_t *    vFanouts;      // temporary fanout IDs
     int            nIncUpdates;
+    int            fUseDept;      // departure times are maintained
     // optimization parameters
     float          SumArea;       // total area
     float          MaxDelay;      // max delay
@@ -180,6 +182,7 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
     p->vNodeIter   = Vec_IntStartFull( p->nObjs );
     p->vLevels     = Vec_WecStart( 2 * Abc_NtkLevel(pNtk) + 1 );
     p->vChanged    = Vec_IntAlloc( 100 );
+    p->vFanouts    = Vec_IntAlloc( 100 );
     Abc_NtkForEachCo( pNtk, pObj, i )
         pObj->Level = Abc_ObjFanin0(pObj)->Level + 1;
     // set CI/CO ids
@@ -215,6 +218,7 @@ static inline void Abc_SclManFree( SC_Man * p )
     Vec_IntFreeP( &p->vGatesBest );
     Vec_WecFreeP( &p->vLevels );
     Vec_IntFreeP( &p->vChanged );
+    Vec_IntFreeP( &p->vFanouts );
 //    Vec_QuePrint( p->vQue );
     Vec_QueCheck( p->vQue );
     Vec_QueFreeP( &p->vQue );
@@ -557,6 +561,7 @@ extern Vec_Flt_t *   Abc_SclFindWireCaps( SC_WireLoad * pWL, int nFanoutMax );
 extern float         Abc_SclFindWireLoad( Vec_Flt_t * vWireCaps, int nFans );
 extern void          Abc_SclAddWireLoad( SC_Man * p, Abc_Obj_t * pObj, int fSubtr );
 extern void          Abc_SclComputeLoad( SC_Man * p );
+extern void          Abc_SclComputeLoadObj( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell * pNew );
 extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanout );
 /*=== sclSize.c ===============================================================*/
@@ -567,6 +572,7 @@ extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseW
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
 extern int           Abc_SclTimeIncUpdate( SC_Man * p );
+extern int           Abc_SclTimeIncCheck( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
 extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats );
@@ -933,22 +933,12 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 
         // update timing information
         clk = Abc_Clock();
-        if ( pPars->fUseDept )
-        {
-            if ( Vec_IntSize(p->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
-                nConeSize = Abc_SclTimeIncUpdate( p );
-            else
-                Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
-        }
+        if ( Vec_IntSize(p->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
+            nConeSize = Abc_SclTimeIncUpdate( p );
         else
-        {
-            Vec_Int_t * vTFO = Abc_SclFindTFO( p->pNtk, vPathNodes );
-            Abc_SclTimeCone( p, vTFO );
-            nConeSize = Vec_IntSize( vTFO );
-            Vec_IntFree( vTFO );
-        }
+            Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
         p->timeTime += Abc_Clock() - clk;
-//        Abc_SclUpsizePrintDiffs( p, pLib, pNtk );
+//        Abc_SclTimeIncCheck( p );
 
         // save the best network
         p->MaxDelay = Abc_SclReadMaxDelay( p );
@@ -97,6 +97,25 @@ int Nm_ManNumEntries( Nm_Man_t * p )
     return p->nEntries;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Makes room for the given number of entries.]
+
+  Description [Resizes the hash tables at once, instead of resizing them
+  several times while the entries are added. Useful when the number of
+  names is known in advance, for example, when reading large netlists.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nm_ManReserve( Nm_Man_t * p, int nEntries )
+{
+    if ( nEntries > p->nBins * p->nSizeFactor )
+        Nm_ManResize( p, Abc_PrimeCudd(nEntries) );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates a new entry in the name manager.]
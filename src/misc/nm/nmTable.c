@@ -51,7 +51,6 @@ static unsigned Nm_HashString( char * pName, int TableSize )
     return Key % TableSize;
 }
 
-static void Nm_ManResize( Nm_Man_t * p );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -73,7 +72,7 @@ int Nm_ManTableAdd( Nm_Man_t * p, Nm_Entry_t * pEntry )
     Nm_Entry_t ** ppSpot, * pOther;
     // resize the tables if needed
     if ( p->nEntries > p->nBins * p->nSizeFactor )
-        Nm_ManResize( p );
+        Nm_ManResize( p, Abc_PrimeCudd(p->nGrowthFactor * p->nBins) );
     // add the entry to the table Id->Name
     assert( Nm_ManTableLookupId(p, pEntry->ObjId) == NULL );
     ppSpot = p->pBinsI2N + Nm_HashNumber(pEntry->ObjId, p->nBins);
@@ -246,22 +245,20 @@ void Nm_ManProfile( Nm_Man_t * p )
 
   Synopsis    [Resizes the table.]
 
-  Description []
+  Description [Rehashes the entries into the given number of bins.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Nm_ManResize( Nm_Man_t * p )
+void Nm_ManResize( Nm_Man_t * p, int nBinsNew )
 {
     Nm_Entry_t ** pBinsNewI2N, ** pBinsNewN2I, * pEntry, * pEntry2, ** ppSpot;
-    int nBinsNew, Counter, e;
+    int Counter, e;
     abctime clk;
 
 clk = Abc_Clock();
-    // get the new table size
-    nBinsNew = Abc_PrimeCudd( p->nGrowthFactor * p->nBins ); 
     // allocate a new array
     pBinsNewI2N = ABC_ALLOC( Nm_Entry_t *, nBinsNew );
     pBinsNewN2I = ABC_ALLOC( Nm_Entry_t *, nBinsNew );
@@ -0,0 +1,344 @@
+/**CFile****************************************************************
+
+  FileName    [utilProf.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Profiling utilities.]
+
+  Synopsis    [Registry of per-command timers and counters.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilProf.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "abc_global.h"
+#include "utilProf.h"
+
+#if defined(_WIN32)
+#else
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define UTIL_PROF_MAX 256
+
+typedef struct Util_ProfEntry_t_ Util_ProfEntry_t;
+struct Util_ProfEntry_t_
+{
+    char *        pName;       // the name of the timer or counter
+    int           fTimer;      // set to 1 for timers and 0 for counters
+    int           nCalls;      // the number of updates
+    word          Value;       // the runtime (for timers) or the count
+};
+
+typedef struct Util_Prof_t_ Util_Prof_t;
+struct Util_Prof_t_
+{
+    int              fEnabled;     // profiling is enabled
+    int              fActive;      // a command is being profiled
+    char *           pFileName;    // the output file (NULL for stdout)
+    char *           pCommand;     // the command being profiled
+    abctime          clkStart;     // the start of the command
+    int              nEntries;     // the number of entries
+    Util_ProfEntry_t pEntries[UTIL_PROF_MAX]; // timers and counters
+};
+
+static Util_Prof_t s_Prof = { 0 };
+
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_ProfMutex = PTHREAD_MUTEX_INITIALIZER;
+#define UTIL_PROF_LOCK()     pthread_mutex_lock( &s_ProfMutex )
+#define UTIL_PROF_UNLOCK()   pthread_mutex_unlock( &s_ProfMutex )
+#else
+#define UTIL_PROF_LOCK()
+#define UTIL_PROF_UNLOCK()
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Enables and disables profiling.]
+
+  Description [When profiling is enabled, each command executed in the
+  shell produces one line in JSON format, which is appended to the given
+  file or printed to the standard output if the file name is NULL.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_ProfStart( char * pFileName )
+{
+    ABC_FREE( s_Prof.pFileName );
+    s_Prof.pFileName = pFileName ? Abc_UtilStrsav( pFileName ) : NULL;
+    s_Prof.fEnabled = 1;
+}
+void Util_ProfStop()
+{
+    ABC_FREE( s_Prof.pFileName );
+    s_Prof.fEnabled = 0;
+}
+int Util_ProfIsEnabled()
+{
+    return s_Prof.fEnabled;
+}
+char * Util_ProfFileName()
+{
+    return s_Prof.pFileName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or adds the entry with the given name.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Util_ProfEntry_t * Util_ProfEntry( const char * pName, int fTimer )
+{
+    Util_ProfEntry_t * pEntry;
+    int i;
+    for ( i = 0; i < s_Prof.nEntries; i++ )
+        if ( s_Prof.pEntries[i].fTimer == fTimer && !strcmp(s_Prof.pEntries[i].pName, pName) )
+            return s_Prof.pEntries + i;
+    if ( s_Prof.nEntries == UTIL_PROF_MAX )
+        return NULL;
+    pEntry = s_Prof.pEntries + s_Prof.nEntries++;
+    pEntry->pName  = Abc_UtilStrsav( (char *)pName );
+    pEntry->fTimer = fTimer;
+    pEntry->nCalls = 0;
+    pEntry->Value  = 0;
+    return pEntry;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the runtime of one phase of the current command.]
+
+  Description [The names are composed of the engine name and the phase
+  name, for example, "pdr.sat". Repeated calls with the same name add up.
+  The calls are ignored unless a command is being profiled.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_ProfTimeAdd( const char * pName, abctime Time )
+{
+    Util_ProfEntry_t * pEntry;
+    if ( !s_Prof.fActive )
+        return;
+    UTIL_PROF_LOCK();
+    pEntry = Util_ProfEntry( pName, 1 );
+    if ( pEntry )
+    {
+        pEntry->Value += (word)(Time > 0 ? Time : 0);
+        pEntry->nCalls++;
+    }
+    UTIL_PROF_UNLOCK();
+}
+void Util_ProfCountAdd( const char * pName, word Count )
+{
+    Util_ProfEntry_t * pEntry;
+    if ( !s_Prof.fActive )
+        return;
+    UTIL_PROF_LOCK();
+    pEntry = Util_ProfEntry( pName, 0 );
+    if ( pEntry )
+    {
+        pEntry->Value += Count;
+        pEntry->nCalls++;
+    }
+    UTIL_PROF_UNLOCK();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the peak memory usage of the process in MB.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+double Util_ProfPeakMemory()
+{
+#if defined(_WIN32)
+    return 0.0;
+#else
+    struct rusage ru;
+    if ( getrusage( RUSAGE_SELF, &ru ) < 0 )
+        return 0.0;
+#if defined(__APPLE__) && defined(__MACH__)
+    return 1.0 * ru.ru_maxrss / (1<<20);
+#else
+    return 1.0 * ru.ru_maxrss / (1<<10);
+#endif
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts profiling of one command.]
+
+  Description [Returns 1 if profiling has started. When commands are nested
+  (for example, the commands called by "source"), only the outermost one
+  is profiled.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_ProfCommandStart( int argc, char ** argv )
+{
+    int i, nSize = 1;
+    if ( !s_Prof.fEnabled || s_Prof.fActive )
+        return 0;
+    for ( i = 0; i < argc; i++ )
+        nSize += strlen(argv[i]) + 1;
+    ABC_FREE( s_Prof.pCommand );
+    s_Prof.pCommand = ABC_ALLOC( char, nSize );
+    s_Prof.pCommand[0] = 0;
+    for ( i = 0; i < argc; i++ )
+    {
+        if ( i ) strcat( s_Prof.pCommand, " " );
+        strcat( s_Prof.pCommand, argv[i] );
+    }
+    for ( i = 0; i < s_Prof.nEntries; i++ )
+        ABC_FREE( s_Prof.pEntries[i].pName );
+    s_Prof.nEntries = 0;
+    s_Prof.fActive  = 1;
+    s_Prof.clkStart = Abc_Clock();
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the string with JSON escapes.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_ProfPrintString( FILE * pFile, char * pStr )
+{
+    fputc( '\"', pFile );
+    for ( ; *pStr; pStr++ )
+    {
+        if ( *pStr == '\"' || *pStr == '\\' )
+            fprintf( pFile, "\\%c", *pStr );
+        else if ( (unsigned char)*pStr < 0x20 )
+            fprintf( pFile, "\\u%04x", (unsigned char)*pStr );
+        else
+            fputc( *pStr, pFile );
+    }
+    fputc( '\"', pFile );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops profiling of one command and writes the report.]
+
+  Description [The report is one JSON object on a separate line, which
+  contains the command line, the return status, the runtime in seconds,
+  the peak memory usage in MB, and the timers and counters recorded by
+  the engines called by the command.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_ProfCommandStop( int Status )
+{
+    Util_ProfEntry_t * pEntry;
+    FILE * pFile = stdout;
+    abctime clkTotal;
+    int i, k;
+    if ( !s_Prof.fActive )
+        return;
+    clkTotal = Abc_Clock() - s_Prof.clkStart;
+    s_Prof.fActive = 0;
+    if ( s_Prof.pFileName && (pFile = fopen( s_Prof.pFileName, "a" )) == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing the profile.\n", s_Prof.pFileName );
+        return;
+    }
+    fprintf( pFile, "{\"command\": " );
+    Util_ProfPrintString( pFile, s_Prof.pCommand );
+    fprintf( pFile, ", \"status\": %d", Status );
+    fprintf( pFile, ", \"time\": %.6f", 1.0*clkTotal/CLOCKS_PER_SEC );
+    fprintf( pFile, ", \"peak_memory_mb\": %.2f", Util_ProfPeakMemory() );
+    fprintf( pFile, ", \"timers\": {" );
+    for ( i = k = 0; i < s_Prof.nEntries; i++ )
+    {
+        pEntry = s_Prof.pEntries + i;
+        if ( !pEntry->fTimer )
+            continue;
+        fprintf( pFile, "%s", k++ ? ", " : "" );
+        Util_ProfPrintString( pFile, pEntry->pName );
+        fprintf( pFile, ": {\"time\": %.6f, \"calls\": %d}", 1.0*pEntry->Value/CLOCKS_PER_SEC, pEntry->nCalls );
+    }
+    fprintf( pFile, "}, \"counters\": {" );
+    for ( i = k = 0; i < s_Prof.nEntries; i++ )
+    {
+        pEntry = s_Prof.pEntries + i;
+        if ( pEntry->fTimer )
+            continue;
+        fprintf( pFile, "%s", k++ ? ", " : "" );
+        Util_ProfPrintString( pFile, pEntry->pName );
+        fprintf( pFile, ": %.0f", (double)pEntry->Value );
+    }
+    fprintf( pFile, "}}\n" );
+    if ( pFile != stdout )
+        fclose( pFile );
+    else
+        fflush( stdout );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,66 @@
+/**CFile****************************************************************
+
+  FileName    [utilProf.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Profiling utilities.]
+
+  Synopsis    [Registry of per-command timers and counters.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilProf.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilProf_h
+#define ABC__misc__util__utilProf_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilProf.c ==========================================================*/
+
+extern void      Util_ProfStart( char * pFileName );
+extern void      Util_ProfStop();
+extern int       Util_ProfIsEnabled();
+extern char *    Util_ProfFileName();
+extern void      Util_ProfTimeAdd( const char * pName, abctime Time );
+extern void      Util_ProfCountAdd( const char * pName, word Count );
+extern int       Util_ProfCommandStart( int argc, char ** argv );
+extern void      Util_ProfCommandStop( int Status );
+extern double    Util_ProfPeakMemory();
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
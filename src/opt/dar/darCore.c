@@ -58,6 +58,8 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
     pPars->fUseZeros    =  0;
     pPars->fPower       =  0;
     pPars->fRecycle     =  1;
+    pPars->nThreads     =  1;
+    pPars->nWinSize     =  0;
     pPars->fVerbose     =  0;
     pPars->fVeryVerbose =  0;
 }
@@ -75,7 +77,7 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+int Dar_ManRewriteInt( Aig_Man_t * pAig, Dar_RwrPar_t * pPars, Dar_Lib_t * pLib )
 {
     extern Vec_Int_t * Saig_ManComputeSwitchProbs( Aig_Man_t * p, int nFrames, int nPref, int fProbOne );
     Dar_Man_t * p;
@@ -86,10 +88,12 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
     abctime clk = 0, clkStart;
     int Counter = 0;
     int nMffcSize;//, nMffcGains[MAX_VAL+1][MAX_VAL+1] = {{0}};
-    // prepare the library
-    Dar_LibPrepare( pPars->nSubgMax ); 
+    // prepare the library (a thread-private copy is prepared before it is duplicated)
+    if ( pLib == NULL )
+        Dar_LibPrepare( pPars->nSubgMax ); 
     // create rewriting manager
     p = Dar_ManStart( pAig, pPars );
+    p->pLib = pLib;
     if ( pPars->fPower )
         pAig->vProbs = Saig_ManComputeSwitchProbs( pAig, 48, 16, 1 );
     // remove dangling nodes
@@ -245,6 +249,22 @@ p->timeOther = p->timeTotal - p->timeCuts - p->timeEval;
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs DAG-aware rewriting of the AIG in place.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    return Dar_ManRewriteInt( pAig, pPars, NULL );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the total number of cuts.]
@@ -50,6 +50,7 @@ ABC_NAMESPACE_HEADER_START
 
 typedef struct Dar_Man_t_            Dar_Man_t;
 typedef struct Dar_Cut_t_            Dar_Cut_t;
+typedef struct Dar_Lib_t_            Dar_Lib_t;
 
 // the AIG 4-cut
 struct Dar_Cut_t_  // 6 words
@@ -69,6 +70,7 @@ struct Dar_Man_t_
     // input data
     Dar_RwrPar_t *   pPars;          // rewriting parameters
     Aig_Man_t *      pAig;           // AIG manager 
+    Dar_Lib_t *      pLib;           // private library copy (or NULL if the global one is used)
     // various data members
     Aig_MmFixed_t *  pMemCuts;       // memory manager for cuts
     void *           pManCnf;        // CNF managers
@@ -130,6 +132,7 @@ static inline void         Dar_ObjSetCuts( Aig_Obj_t * pObj, Dar_Cut_t * pCuts )
 
 /*=== darBalance.c ========================================================*/
 /*=== darCore.c ===========================================================*/
+extern int             Dar_ManRewriteInt( Aig_Man_t * pAig, Dar_RwrPar_t * pPars, Dar_Lib_t * pLib );
 /*=== darCut.c ============================================================*/
 extern void            Dar_ManCutsRestart( Dar_Man_t * p, Aig_Obj_t * pRoot );
 extern void            Dar_ManCutsFree( Dar_Man_t * p );
@@ -144,6 +147,8 @@ extern Vec_Int_t *     Dar_LibReadPrios();
 /*=== darLib.c ============================================================*/
 extern void            Dar_LibStart();
 extern void            Dar_LibStop();
+extern Dar_Lib_t *     Dar_LibDup();
+extern void            Dar_LibDupFree( Dar_Lib_t * p );
 extern void            Dar_LibReturnCanonicals( unsigned * pCanons );
 extern void            Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Required, int * pnMffcSize );
 extern Aig_Obj_t *     Dar_LibBuildBest( Dar_Man_t * p );
@@ -154,6 +159,9 @@ extern void            Dar_ManPrintStats( Dar_Man_t * p );
 /*=== darPrec.c ============================================================*/
 extern char **         Dar_Permutations( int n );
 extern void            Dar_Truth4VarNPN( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap );
+/*=== darScript.c =========================================================*/
+extern Aig_Man_t *     Dar_NewCompressLib( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, Dar_Lib_t * pLib, int fVerbose );
+extern Aig_Man_t *     Dar_NewCompress2Lib( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fLightSynth, Dar_Lib_t * pLib, int fVerbose );
 
 
 
@@ -29,7 +29,6 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-typedef struct Dar_Lib_t_            Dar_Lib_t;
 typedef struct Dar_LibObj_t_         Dar_LibObj_t;
 typedef struct Dar_LibDat_t_         Dar_LibDat_t;
 
@@ -107,6 +106,9 @@ struct Dar_Lib_t_ // library
 
 static Dar_Lib_t * s_DarLib = NULL;
 
+// the library used by the manager (each thread of the parallel rewriter has its own copy)
+static inline Dar_Lib_t *   Dar_ManLib( Dar_Man_t * p )         { return p->pLib ? p->pLib : s_DarLib; }
+
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
 
@@ -619,6 +621,39 @@ void Dar_LibStop()
     s_DarLib = NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the library for a thread.]
+
+  Description [The library objects and their data are modified while
+  evaluating and building the subgraphs, so each thread gets a private
+  copy of them. The remaining arrays are read-only after the library is
+  prepared and are shared with the global library.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dar_Lib_t * Dar_LibDup()
+{
+    Dar_Lib_t * p;
+    assert( s_DarLib != NULL );
+    p = ABC_ALLOC( Dar_Lib_t, 1 );
+    memcpy( p, s_DarLib, sizeof(Dar_Lib_t) );
+    p->pObjs  = ABC_ALLOC( Dar_LibObj_t, p->nObjs );
+    memcpy( p->pObjs, s_DarLib->pObjs, sizeof(Dar_LibObj_t) * p->nObjs );
+    p->pDatas = ABC_ALLOC( Dar_LibDat_t, p->nDatas );
+    memcpy( p->pDatas, s_DarLib->pDatas, sizeof(Dar_LibDat_t) * p->nDatas );
+    return p;
+}
+void Dar_LibDupFree( Dar_Lib_t * p )
+{
+    ABC_FREE( p->pObjs );
+    ABC_FREE( p->pDatas );
+    ABC_FREE( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Updates the score of the class and adjusts the priority of this class.]
@@ -705,14 +740,15 @@ void Dar_LibDumpPriorities()
 ***********************************************************************/
 int Dar_LibCutMatch( Dar_Man_t * p, Dar_Cut_t * pCut )
 {
+    Dar_Lib_t * pLib = Dar_ManLib( p );
     Aig_Obj_t * pFanin;
     unsigned uPhase;
     char * pPerm;
     int i;
     assert( pCut->nLeaves == 4 );
     // get the fanin permutation
-    uPhase = s_DarLib->pPhases[pCut->uTruth];
-    pPerm = s_DarLib->pPerms4[ (int)s_DarLib->pPerms[pCut->uTruth] ];
+    uPhase = pLib->pPhases[pCut->uTruth];
+    pPerm = pLib->pPerms4[ (int)pLib->pPerms[pCut->uTruth] ];
     // collect fanins with the corresponding permutation/phase
     for ( i = 0; i < (int)pCut->nLeaves; i++ )
     {
@@ -723,13 +759,13 @@ int Dar_LibCutMatch( Dar_Man_t * p, Dar_Cut_t * pCut )
             return 0;
         }
         pFanin = Aig_NotCond(pFanin, ((uPhase >> i) & 1) );
-        s_DarLib->pDatas[i].pFunc = pFanin;
-        s_DarLib->pDatas[i].Level = Aig_Regular(pFanin)->Level;
+        pLib->pDatas[i].pFunc = pFanin;
+        pLib->pDatas[i].Level = Aig_Regular(pFanin)->Level;
         // copy the propability of node being one
         if ( p->pPars->fPower )
         {
             float Prob = Abc_Int2Float( Vec_IntEntry( p->pAig->vProbs, Aig_ObjId(Aig_Regular(pFanin)) ) );
-            s_DarLib->pDatas[i].dProb = Aig_IsComplement(pFanin)? 1.0-Prob : Prob;
+            pLib->pDatas[i].dProb = Aig_IsComplement(pFanin)? 1.0-Prob : Prob;
         }
     }
     p->nCutsGood++;
@@ -749,17 +785,17 @@ int Dar_LibCutMatch( Dar_Man_t * p, Dar_Cut_t * pCut )
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_LibCutMarkMffc( Aig_Man_t * p, Aig_Obj_t * pRoot, int nLeaves, float * pPower )
+int Dar_LibCutMarkMffc( Dar_Lib_t * pLib, Aig_Man_t * p, Aig_Obj_t * pRoot, int nLeaves, float * pPower )
 {
     int i, nNodes;
     // mark the cut leaves
     for ( i = 0; i < nLeaves; i++ )
-        Aig_Regular(s_DarLib->pDatas[i].pFunc)->nRefs++;
+        Aig_Regular(pLib->pDatas[i].pFunc)->nRefs++;
     // label MFFC with current ID
     nNodes = Aig_NodeMffcLabel( p, pRoot, pPower );
     // unmark the cut leaves
     for ( i = 0; i < nLeaves; i++ )
-        Aig_Regular(s_DarLib->pDatas[i].pFunc)->nRefs--;
+        Aig_Regular(pLib->pDatas[i].pFunc)->nRefs--;
     return nNodes;
 }
 
@@ -774,18 +810,18 @@ int Dar_LibCutMarkMffc( Aig_Man_t * p, Aig_Obj_t * pRoot, int nLeaves, float * p
   SeeAlso     []
 
 ***********************************************************************/
-void Dar_LibObjPrint_rec( Dar_LibObj_t * pObj )
+void Dar_LibObjPrint_rec( Dar_Lib_t * pLib, Dar_LibObj_t * pObj )
 {
     if ( pObj->fTerm )
     {
-        printf( "%c", 'a' + (int)(pObj - s_DarLib->pObjs) );
+        printf( "%c", 'a' + (int)(pObj - pLib->pObjs) );
         return;
     }
     printf( "(" );
-    Dar_LibObjPrint_rec( Dar_LibObj(s_DarLib, pObj->Fan0) );
+    Dar_LibObjPrint_rec( pLib, Dar_LibObj(pLib, pObj->Fan0) );
     if ( pObj->fCompl0 )
         printf( "\'" );
-    Dar_LibObjPrint_rec( Dar_LibObj(s_DarLib, pObj->Fan1) );
+    Dar_LibObjPrint_rec( pLib, Dar_LibObj(pLib, pObj->Fan1) );
     if ( pObj->fCompl0 )
         printf( "\'" );
     printf( ")" );
@@ -805,26 +841,27 @@ void Dar_LibObjPrint_rec( Dar_LibObj_t * pObj )
 ***********************************************************************/
 void Dar_LibEvalAssignNums( Dar_Man_t * p, int Class, Aig_Obj_t * pRoot )
 {
+    Dar_Lib_t * pLib = Dar_ManLib( p );
     Dar_LibObj_t * pObj;
     Dar_LibDat_t * pData, * pData0, * pData1;
     Aig_Obj_t * pFanin0, * pFanin1;
     int i;
-    for ( i = 0; i < s_DarLib->nNodes0[Class]; i++ )
+    for ( i = 0; i < pLib->nNodes0[Class]; i++ )
     {
         // get one class node, assign its temporary number and set its data
-        pObj = Dar_LibObj(s_DarLib, s_DarLib->pNodes0[Class][i]);
+        pObj = Dar_LibObj(pLib, pLib->pNodes0[Class][i]);
         pObj->Num = 4 + i;
-        assert( (int)pObj->Num < s_DarLib->nNodes0Max + 4 );
-        pData = s_DarLib->pDatas + pObj->Num;
+        assert( (int)pObj->Num < pLib->nNodes0Max + 4 );
+        pData = pLib->pDatas + pObj->Num;
         pData->fMffc = 0;
         pData->pFunc = NULL;
         pData->TravId = 0xFFFF;
 
         // explore the fanins
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan0)->Num < s_DarLib->nNodes0Max + 4 );
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan1)->Num < s_DarLib->nNodes0Max + 4 );
-        pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        assert( (int)Dar_LibObj(pLib, pObj->Fan0)->Num < pLib->nNodes0Max + 4 );
+        assert( (int)Dar_LibObj(pLib, pObj->Fan1)->Num < pLib->nNodes0Max + 4 );
+        pData0 = pLib->pDatas + Dar_LibObj(pLib, pObj->Fan0)->Num;
+        pData1 = pLib->pDatas + Dar_LibObj(pLib, pObj->Fan1)->Num;
         pData->Level = 1 + Abc_MaxInt(pData0->Level, pData1->Level);
         if ( pData0->pFunc == NULL || pData1->pFunc == NULL )
             continue;
@@ -860,14 +897,14 @@ void Dar_LibEvalAssignNums( Dar_Man_t * p, int Class, Aig_Obj_t * pRoot )
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required, float * pPower )
+int Dar_LibEval_rec( Dar_Lib_t * pLib, Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required, float * pPower )
 {
     Dar_LibDat_t * pData;
     float Power0, Power1;
     int Area;
     if ( pPower )
         *pPower = (float)0.0;
-    pData = s_DarLib->pDatas + pObj->Num;
+    pData = pLib->pDatas + pObj->Num;
     if ( pData->TravId == Out )
         return 0;
     pData->TravId = Out;
@@ -888,16 +925,16 @@ int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required
     }
     // this is a new node - get a bound on the area of its branches
     nNodesSaved--;
-    Area = Dar_LibEval_rec( Dar_LibObj(s_DarLib, pObj->Fan0), Out, nNodesSaved, Required+1, pPower? &Power0 : NULL );
+    Area = Dar_LibEval_rec( pLib, Dar_LibObj(pLib, pObj->Fan0), Out, nNodesSaved, Required+1, pPower? &Power0 : NULL );
     if ( Area > nNodesSaved )
         return 0xff;
-    Area += Dar_LibEval_rec( Dar_LibObj(s_DarLib, pObj->Fan1), Out, nNodesSaved, Required+1, pPower? &Power1 : NULL );
+    Area += Dar_LibEval_rec( pLib, Dar_LibObj(pLib, pObj->Fan1), Out, nNodesSaved, Required+1, pPower? &Power1 : NULL );
     if ( Area > nNodesSaved )
         return 0xff;
     if ( pPower )
     {
-        Dar_LibDat_t * pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        Dar_LibDat_t * pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        Dar_LibDat_t * pData0 = pLib->pDatas + Dar_LibObj(pLib, pObj->Fan0)->Num;
+        Dar_LibDat_t * pData1 = pLib->pDatas + Dar_LibObj(pLib, pObj->Fan1)->Num;
         pData->dProb = (pObj->fCompl0? 1.0 - pData0->dProb : pData0->dProb)*
                        (pObj->fCompl1? 1.0 - pData1->dProb : pData1->dProb);
         *pPower = Power0 + 2.0 * pData0->dProb * (1.0 - pData0->dProb) +
@@ -919,6 +956,7 @@ int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required
 ***********************************************************************/
 void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Required, int * pnMffcSize )
 {
+    Dar_Lib_t * pLib = Dar_ManLib( p );
     int fTraining = 0;
     float PowerSaved, PowerAdded;
     Dar_LibObj_t * pObj;
@@ -930,19 +968,19 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
     if ( !Dar_LibCutMatch(p, pCut) )
         return;
     // mark MFFC of the node
-    nNodesSaved = Dar_LibCutMarkMffc( p->pAig, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
+    nNodesSaved = Dar_LibCutMarkMffc( pLib, p->pAig, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
     // evaluate the cut
-    Class = s_DarLib->pMap[pCut->uTruth];
+    Class = pLib->pMap[pCut->uTruth];
     Dar_LibEvalAssignNums( p, Class, pRoot );
     // profile outputs by their savings
-    p->nTotalSubgs += s_DarLib->nSubgr0[Class];
-    p->ClassSubgs[Class] += s_DarLib->nSubgr0[Class];
-    for ( Out = 0; Out < s_DarLib->nSubgr0[Class]; Out++ )
+    p->nTotalSubgs += pLib->nSubgr0[Class];
+    p->ClassSubgs[Class] += pLib->nSubgr0[Class];
+    for ( Out = 0; Out < pLib->nSubgr0[Class]; Out++ )
     {
-        pObj = Dar_LibObj(s_DarLib, s_DarLib->pSubgr0[Class][Out]);
-        if ( Aig_Regular(s_DarLib->pDatas[pObj->Num].pFunc) == pRoot )
+        pObj = Dar_LibObj(pLib, pLib->pSubgr0[Class][Out]);
+        if ( Aig_Regular(pLib->pDatas[pObj->Num].pFunc) == pRoot )
             continue;
-        nNodesAdded = Dar_LibEval_rec( pObj, Out, nNodesSaved - !p->pPars->fUseZeros, Required, p->pPars->fPower? &PowerAdded : NULL );
+        nNodesAdded = Dar_LibEval_rec( pLib, pObj, Out, nNodesSaved - !p->pPars->fUseZeros, Required, p->pPars->fPower? &PowerAdded : NULL );
         nNodesGained = nNodesSaved - nNodesAdded;
         if ( p->pPars->fPower && PowerSaved < PowerAdded )
             continue;
@@ -951,15 +989,15 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
         if ( nNodesGained < 0 || (nNodesGained == 0 && !p->pPars->fUseZeros) )
             continue;
         if ( nNodesGained <  p->GainBest || 
-            (nNodesGained == p->GainBest && s_DarLib->pDatas[pObj->Num].Level >= p->LevelBest) )
+            (nNodesGained == p->GainBest && pLib->pDatas[pObj->Num].Level >= p->LevelBest) )
             continue;
         // remember this possibility
         Vec_PtrClear( p->vLeavesBest );
         for ( k = 0; k < (int)pCut->nLeaves; k++ )
-            Vec_PtrPush( p->vLeavesBest, s_DarLib->pDatas[k].pFunc );
-        p->OutBest    = s_DarLib->pSubgr0[Class][Out];
+            Vec_PtrPush( p->vLeavesBest, pLib->pDatas[k].pFunc );
+        p->OutBest    = pLib->pSubgr0[Class][Out];
         p->OutNumBest = Out;
-        p->LevelBest  = s_DarLib->pDatas[pObj->Num].Level;
+        p->LevelBest  = pLib->pDatas[pObj->Num].Level;
         p->GainBest   = nNodesGained;
         p->ClassBest  = Class;
         assert( p->LevelBest <= Required );
@@ -981,14 +1019,14 @@ p->timeEval += clk;
   SeeAlso     []
 
 ***********************************************************************/
-void Dar_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
+void Dar_LibBuildClear_rec( Dar_Lib_t * pLib, Dar_LibObj_t * pObj, int * pCounter )
 {
     if ( pObj->fTerm )
         return;
     pObj->Num = (*pCounter)++;
-    s_DarLib->pDatas[ pObj->Num ].pFunc = NULL;
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan0), pCounter );
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan1), pCounter );
+    pLib->pDatas[ pObj->Num ].pFunc = NULL;
+    Dar_LibBuildClear_rec( pLib, Dar_LibObj(pLib, pObj->Fan0), pCounter );
+    Dar_LibBuildClear_rec( pLib, Dar_LibObj(pLib, pObj->Fan1), pCounter );
 }
 
 /**Function*************************************************************
@@ -1004,12 +1042,13 @@ void Dar_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
 ***********************************************************************/
 Aig_Obj_t * Dar_LibBuildBest_rec( Dar_Man_t * p, Dar_LibObj_t * pObj )
 {
+    Dar_Lib_t * pLib = Dar_ManLib( p );
     Aig_Obj_t * pFanin0, * pFanin1;
-    Dar_LibDat_t * pData = s_DarLib->pDatas + pObj->Num;
+    Dar_LibDat_t * pData = pLib->pDatas + pObj->Num;
     if ( pData->pFunc )
         return pData->pFunc;
-    pFanin0 = Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, pObj->Fan0) );
-    pFanin1 = Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, pObj->Fan1) );
+    pFanin0 = Dar_LibBuildBest_rec( p, Dar_LibObj(pLib, pObj->Fan0) );
+    pFanin1 = Dar_LibBuildBest_rec( p, Dar_LibObj(pLib, pObj->Fan1) );
     pFanin0 = Aig_NotCond( pFanin0, pObj->fCompl0 );
     pFanin1 = Aig_NotCond( pFanin1, pObj->fCompl1 );
     pData->pFunc = Aig_And( p->pAig, pFanin0, pFanin1 );
@@ -1030,11 +1069,12 @@ Aig_Obj_t * Dar_LibBuildBest_rec( Dar_Man_t * p, Dar_LibObj_t * pObj )
 ***********************************************************************/
 Aig_Obj_t * Dar_LibBuildBest( Dar_Man_t * p )
 {
+    Dar_Lib_t * pLib = Dar_ManLib( p );
     int i, Counter = 4;
     for ( i = 0; i < Vec_PtrSize(p->vLeavesBest); i++ )
-        s_DarLib->pDatas[i].pFunc = (Aig_Obj_t *)Vec_PtrEntry( p->vLeavesBest, i );
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, p->OutBest), &Counter );
-    return Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, p->OutBest) );
+        pLib->pDatas[i].pFunc = (Aig_Obj_t *)Vec_PtrEntry( p->vLeavesBest, i );
+    Dar_LibBuildClear_rec( pLib, Dar_LibObj(pLib, p->OutBest), &Counter );
+    return Dar_LibBuildBest_rec( p, Dar_LibObj(pLib, p->OutBest) );
 }
 
 
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "darInt.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -70,6 +71,15 @@ void Dar_ManStop( Dar_Man_t * p )
 {
     if ( p->pPars->fVerbose )
         Dar_ManPrintStats( p );
+    if ( Util_ProfIsEnabled() )
+    {
+        Util_ProfTimeAdd( "dar.cuts",  p->timeCuts );
+        Util_ProfTimeAdd( "dar.eval",  p->timeEval );
+        Util_ProfTimeAdd( "dar.other", p->timeOther );
+        Util_ProfTimeAdd( "dar.total", p->timeTotal );
+        Util_ProfCountAdd( "dar.tried", p->nNodesTried );
+        Util_ProfCountAdd( "dar.gain",  Abc_MaxInt(p->nNodesInit - Aig_ManNodeNum(p->pAig), 0) );
+    }
     if ( p->vCutNodes )
         Vec_PtrFree( p->vCutNodes );
     if ( p->pMemCuts )
@@ -0,0 +1,566 @@
+/**CFile****************************************************************
+
+  FileName    [darPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware AIG rewriting.]
+
+  Synopsis    [Multi-threaded rewriting of AIG windows.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - April 28, 2007.]
+
+  Revision    [$Id: darPth.c,v 1.00 2007/04/28 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "darInt.h"
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+static Aig_Man_t * Dar_ManRewritePth( Aig_Man_t * pAig, Dar_RwrPar_t * pPars ) { return NULL; }
+
+#else // pthreads are used
+
+#define PAR_THR_MAX 100
+
+typedef struct Dar_ThData_t_
+{
+    Dar_Lib_t *    pLib;        // thread-private copy of the library
+    Dar_RwrPar_t   Pars;        // thread-private copy of the parameters
+    Aig_Man_t *    pWin;        // the window to rewrite
+    int            iWin;        // the window number (or -1 if none is assigned)
+    int            nWins;       // the number of windows rewritten
+    int            fWorking;    // the thread is busy
+    abctime        clkUsed;     // runtime of the thread
+} Dar_ThData_t;
+
+typedef struct Dar_ChcData_t_
+{
+    Dar_Lib_t *    pLib;        // thread-private copy of the library
+    Aig_Man_t *    pAig;        // the AIG to synthesize (consumed by the thread)
+    Gia_Man_t *    pGia;        // the resulting snapshot
+    int            fCompress2;  // performs "compress2" instead of "compress"
+    int            fBalance;    // the synthesis parameters
+    int            fUpdateLevel;
+    int            fLightSynth;
+    abctime        clkUsed;     // runtime of the thread
+} Dar_ChcData_t;
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if rewriting can be done in windows.]
+
+  Description [Choices, boxes and power-aware rewriting, which computes
+  switching activity of the whole AIG using the shared random generator,
+  are only supported by the single-threaded rewriter.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dar_ManRewriteCheckPar( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( pPars->nThreads < 2 || pPars->fPower )
+        return 0;
+    if ( pAig->pEquivs || pAig->pReprs || pAig->pManTime || Aig_ManBufNum(pAig) > 0 )
+        return 0;
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the copy of the fanin in the window.]
+
+  Description [Fanins belonging to other windows become the CIs of this
+  window. They are recorded in vIns, in the order of the window's CIs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Aig_Obj_t * Dar_ManWinFanin( Aig_Man_t * p, Aig_Man_t * pWin, Aig_Obj_t * pFanin, int iWin, Vec_Int_t * vWinIds, Vec_Int_t * vStamps, Vec_Ptr_t * vCiCopies, Vec_Int_t * vIns )
+{
+    int Id = Aig_ObjId( pFanin );
+    if ( Aig_ObjIsConst1(pFanin) )
+        return Aig_ManConst1( pWin );
+    if ( Vec_IntEntry(vWinIds, Id) == iWin )
+        return (Aig_Obj_t *)pFanin->pData;
+    if ( Vec_IntEntry(vStamps, Id) != iWin )
+    {
+        Vec_IntWriteEntry( vStamps, Id, iWin );
+        Vec_IntPush( vIns, Id );
+        Vec_PtrWriteEntry( vCiCopies, Id, Aig_ObjCreateCi(pWin) );
+    }
+    return (Aig_Obj_t *)Vec_PtrEntry( vCiCopies, Id );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Partitions the AIG into windows.]
+
+  Description [The internal nodes are ordered by a DFS from the COs and
+  the order is split into contiguous ranges of roughly the same size.
+  Because the DFS visits the cones of the COs one after another, each range
+  covers a group of neighboring cones, and the nodes on the boundary are
+  mostly those shared by several groups. Each window has, as its CIs, the
+  nodes of the earlier windows and the CIs of the AIG used by it, and, as
+  its COs, the nodes used in the later windows or by the COs of the AIG.
+  Because the fanins precede the fanouts in the DFS order, the windows
+  can be put back together in the same order.]
+
+  SideEffects [Uses the pData field of the objects.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Ptr_t * Dar_ManDeriveWindows( Aig_Man_t * p, int nWinSize, Vec_Wec_t ** pvIns, Vec_Wec_t ** pvOuts )
+{
+    Vec_Ptr_t * vWins, * vNodes, * vCiCopies;
+    Vec_Int_t * vWinIds, * vStamps, * vIns, * vOuts;
+    Aig_Man_t * pWin = NULL;
+    Aig_Obj_t * pObj, * pFan0, * pFan1;
+    int i, iWin, nWins, nNodes;
+    vNodes  = Aig_ManDfs( p, 1 );
+    nNodes  = Vec_PtrSize( vNodes );
+    nWins   = (nNodes + nWinSize - 1) / nWinSize;
+    vWinIds = Vec_IntStartFull( Aig_ManObjNumMax(p) );
+    vStamps = Vec_IntStartFull( Aig_ManObjNumMax(p) );
+    vCiCopies = Vec_PtrStart( Aig_ManObjNumMax(p) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        Vec_IntWriteEntry( vWinIds, Aig_ObjId(pObj), (int)((word)i * nWins / nNodes) );
+    // mark the nodes used outside of their windows
+    Aig_ManCleanMarkA( p );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+    {
+        iWin = Vec_IntEntry( vWinIds, Aig_ObjId(pObj) );
+        if ( Aig_ObjIsNode(Aig_ObjFanin0(pObj)) && Vec_IntEntry(vWinIds, Aig_ObjFaninId0(pObj)) != iWin )
+            Aig_ObjFanin0(pObj)->fMarkA = 1;
+        if ( Aig_ObjIsNode(Aig_ObjFanin1(pObj)) && Vec_IntEntry(vWinIds, Aig_ObjFaninId1(pObj)) != iWin )
+            Aig_ObjFanin1(pObj)->fMarkA = 1;
+    }
+    Aig_ManForEachCo( p, pObj, i )
+        if ( Aig_ObjIsNode(Aig_ObjFanin0(pObj)) )
+            Aig_ObjFanin0(pObj)->fMarkA = 1;
+    // create the windows
+    vWins   = Vec_PtrAlloc( nWins );
+    *pvIns  = Vec_WecStart( nWins );
+    *pvOuts = Vec_WecStart( nWins );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+    {
+        iWin  = Vec_IntEntry( vWinIds, Aig_ObjId(pObj) );
+        vIns  = Vec_WecEntry( *pvIns, iWin );
+        vOuts = Vec_WecEntry( *pvOuts, iWin );
+        if ( iWin == Vec_PtrSize(vWins) )
+        {
+            pWin = Aig_ManStart( 2 * nNodes / nWins + 100 );
+            Vec_PtrPush( vWins, pWin );
+        }
+        pFan0 = Dar_ManWinFanin( p, pWin, Aig_ObjFanin0(pObj), iWin, vWinIds, vStamps, vCiCopies, vIns );
+        pFan1 = Dar_ManWinFanin( p, pWin, Aig_ObjFanin1(pObj), iWin, vWinIds, vStamps, vCiCopies, vIns );
+        pObj->pData = Aig_And( pWin, Aig_NotCond(pFan0, Aig_ObjFaninC0(pObj)), Aig_NotCond(pFan1, Aig_ObjFaninC1(pObj)) );
+        if ( !pObj->fMarkA )
+            continue;
+        Aig_ObjCreateCo( pWin, (Aig_Obj_t *)pObj->pData );
+        Vec_IntPush( vOuts, Aig_ObjId(pObj) );
+    }
+    assert( Vec_PtrSize(vWins) == nWins );
+    Aig_ManCleanMarkA( p );
+    Vec_IntFree( vWinIds );
+    Vec_IntFree( vStamps );
+    Vec_PtrFree( vCiCopies );
+    Vec_PtrFree( vNodes );
+    return vWins;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Puts the rewritten windows back together.]
+
+  Description [The windows are added in the order of their creation,
+  with their CIs replaced by the copies of the corresponding nodes. The
+  new nodes are structurally hashed, which merges the logic duplicated
+  in several windows.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Aig_Man_t * Dar_ManStitchWindows( Aig_Man_t * p, Vec_Ptr_t * vWins, Vec_Wec_t * vIns, Vec_Wec_t * vOuts )
+{
+    Aig_Man_t * pNew, * pWin;
+    Aig_Obj_t * pObj;
+    Vec_Ptr_t * vCopies;
+    int i, k;
+    pNew = Aig_ManStart( Aig_ManObjNumMax(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    pNew->nAsserts = p->nAsserts;
+    pNew->nConstrs = p->nConstrs;
+    if ( p->vFlopNums )
+        pNew->vFlopNums = Vec_IntDup( p->vFlopNums );
+    vCopies = Vec_PtrStart( Aig_ManObjNumMax(p) );
+    Vec_PtrWriteEntry( vCopies, 0, Aig_ManConst1(pNew) );
+    Aig_ManForEachCi( p, pObj, i )
+        Vec_PtrWriteEntry( vCopies, Aig_ObjId(pObj), Aig_ObjCreateCi(pNew) );
+    Vec_PtrForEachEntry( Aig_Man_t *, vWins, pWin, i )
+    {
+        assert( Aig_ManCiNum(pWin) == Vec_IntSize(Vec_WecEntry(vIns, i)) );
+        assert( Aig_ManCoNum(pWin) == Vec_IntSize(Vec_WecEntry(vOuts, i)) );
+        Aig_ManConst1(pWin)->pData = Aig_ManConst1(pNew);
+        Aig_ManForEachCi( pWin, pObj, k )
+            pObj->pData = Vec_PtrEntry( vCopies, Vec_IntEntry(Vec_WecEntry(vIns, i), k) );
+        Aig_ManForEachNode( pWin, pObj, k )
+            pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+        Aig_ManForEachCo( pWin, pObj, k )
+            Vec_PtrWriteEntry( vCopies, Vec_IntEntry(Vec_WecEntry(vOuts, i), k), Aig_ObjChild0Copy(pObj) );
+    }
+    Aig_ManForEachCo( p, pObj, i )
+        Aig_ObjCreateCo( pNew, Aig_NotCond((Aig_Obj_t *)Vec_PtrEntry(vCopies, Aig_ObjFaninId0(pObj)), Aig_ObjFaninC0(pObj)) );
+    Vec_PtrFree( vCopies );
+    Aig_ManCleanup( pNew );
+    Aig_ManSetRegNum( pNew, Aig_ManRegNum(p) );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites the windows assigned to the thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Dar_ManWorkerThread( void * pArg )
+{
+    Dar_ThData_t * pThData = (Dar_ThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    Aig_Man_t * pTemp;
+    abctime clk;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->pWin == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        clk = Abc_Clock();
+        Dar_ManRewriteInt( pThData->pWin, &pThData->Pars, pThData->pLib );
+        pThData->pWin = Aig_ManDupDfs( pTemp = pThData->pWin );
+        Aig_ManStop( pTemp );
+        pThData->nWins++;
+        pThData->clkUsed += Abc_Clock() - clk;
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites the AIG in windows using several threads.]
+
+  Description [The windows are extracted and put back together by the
+  main thread. Each window is rewritten by the first idle thread, using
+  its own rewriting manager, cut storage and copy of the library.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Aig_Man_t * Dar_ManRewritePth( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Dar_ThData_t ThData[PAR_THR_MAX];
+    Vec_Wec_t * vIns, * vOuts;
+    Vec_Ptr_t * vWins;
+    Aig_Man_t * pNew, * pWin;
+    int nThreads = Abc_MinInt( pPars->nThreads, PAR_THR_MAX );
+    int i, t, status, fRunning, nWinSize, nNodes;
+    abctime clk = Abc_Clock();
+    Aig_ManCleanup( pAig );
+    nNodes = Aig_ManNodeNum( pAig );
+    // by default, use two windows per thread, which keeps the boundaries few
+    nWinSize = pPars->nWinSize > 0 ? pPars->nWinSize : Abc_MaxInt( 1000, (nNodes + 2 * nThreads - 1) / (2 * nThreads) );
+    vWins = Dar_ManDeriveWindows( pAig, nWinSize, &vIns, &vOuts );
+    // the library should be prepared before it is copied
+    Dar_LibPrepare( pPars->nSubgMax );
+    // start the threads
+    for ( t = 0; t < nThreads; t++ )
+    {
+        ThData[t].pLib     = Dar_LibDup();
+        ThData[t].Pars     = *pPars;
+        ThData[t].Pars.fVerbose = 0;
+        ThData[t].Pars.fVeryVerbose = 0;
+        ThData[t].pWin     = NULL;
+        ThData[t].iWin     = -1;
+        ThData[t].nWins    = 0;
+        ThData[t].fWorking = 0;
+        ThData[t].clkUsed  = 0;
+        status = pthread_create( WorkerThread + t, NULL, Dar_ManWorkerThread, (void *)(ThData + t) );  assert( status == 0 );
+    }
+    // give each window to the first idle thread
+    Vec_PtrForEachEntry( Aig_Man_t *, vWins, pWin, i )
+    {
+        for ( t = 0; *(volatile int *)&ThData[t].fWorking; t = (t + 1) % nThreads );
+        if ( ThData[t].iWin >= 0 )
+            Vec_PtrWriteEntry( vWins, ThData[t].iWin, ThData[t].pWin );
+        ThData[t].pWin = pWin;
+        ThData[t].iWin = i;
+        ThData[t].fWorking = 1;
+    }
+    // wait till the threads finish
+    for ( fRunning = 1; fRunning; )
+    {
+        fRunning = 0;
+        for ( t = 0; t < nThreads; t++ )
+            if ( *(volatile int *)&ThData[t].fWorking )
+                fRunning = 1;
+    }
+    for ( t = 0; t < nThreads; t++ )
+        if ( ThData[t].iWin >= 0 )
+            Vec_PtrWriteEntry( vWins, ThData[t].iWin, ThData[t].pWin );
+    // stop the threads
+    for ( t = 0; t < nThreads; t++ )
+    {
+        assert( !ThData[t].fWorking );
+        ThData[t].pWin = NULL;
+        ThData[t].fWorking = 1;
+    }
+    for ( t = 0; t < nThreads; t++ )
+    {
+        status = pthread_join( WorkerThread[t], NULL );  assert( status == 0 );
+        Dar_LibDupFree( ThData[t].pLib );
+    }
+    // put the windows together
+    pNew = Dar_ManStitchWindows( pAig, vWins, vIns, vOuts );
+    if ( pPars->fVerbose )
+    {
+        printf( "Windows = %d. Window size = %d. Threads = %d. Nodes: %d -> %d. ",
+            Vec_PtrSize(vWins), nWinSize, nThreads, nNodes, Aig_ManNodeNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        for ( t = 0; t < nThreads; t++ )
+        {
+            printf( "Thread %2d : Windows = %4d. ", t, ThData[t].nWins );
+            Abc_PrintTime( 1, "Time", ThData[t].clkUsed );
+        }
+    }
+    Vec_PtrForEachEntry( Aig_Man_t *, vWins, pWin, i )
+        Aig_ManStop( pWin );
+    Vec_PtrFree( vWins );
+    Vec_WecFree( vIns );
+    Vec_WecFree( vOuts );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives one synthesis snapshot.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Dar_NewChoiceWorkerThread( void * pArg )
+{
+    Dar_ChcData_t * pThData = (Dar_ChcData_t *)pArg;
+    Aig_Man_t * pAig;
+    abctime clk = Abc_Clock();
+    if ( pThData->fCompress2 )
+        pAig = Dar_NewCompress2Lib( pThData->pAig, pThData->fBalance, pThData->fUpdateLevel, 1, 0, pThData->fLightSynth, pThData->pLib, 0 );
+    else
+        pAig = Dar_NewCompressLib( pThData->pAig, pThData->fBalance, pThData->fUpdateLevel, 0, pThData->pLib, 0 );
+    pThData->pAig = NULL;
+    pThData->pGia = Gia_ManFromAig( pAig );
+    Aig_ManStop( pAig );
+    pThData->clkUsed = Abc_Clock() - clk;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the two synthesized snapshots concurrently.]
+
+  Description [Both AIGs are consumed. Each snapshot is derived by its
+  own thread using its own copy of the rewriting library.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_NewChoiceSynthesisPth( Aig_Man_t * pAig1, Aig_Man_t * pAig2, int fBalance, int fUpdateLevel, int fLightSynth, Gia_Man_t ** ppGia1, Gia_Man_t ** ppGia2, int fVerbose )
+{
+    pthread_t WorkerThread[2];
+    Dar_ChcData_t ThData[2];
+    int t, status;
+    // the library should be prepared before it is copied
+    Dar_LibPrepare( 5 );
+    for ( t = 0; t < 2; t++ )
+    {
+        memset( ThData + t, 0, sizeof(Dar_ChcData_t) );
+        ThData[t].pLib         = Dar_LibDup();
+        ThData[t].pAig         = t ? pAig2 : pAig1;
+        ThData[t].fCompress2   = t;
+        ThData[t].fBalance     = fBalance;
+        ThData[t].fUpdateLevel = fUpdateLevel;
+        ThData[t].fLightSynth  = fLightSynth;
+        status = pthread_create( WorkerThread + t, NULL, Dar_NewChoiceWorkerThread, (void *)(ThData + t) );  assert( status == 0 );
+    }
+    for ( t = 0; t < 2; t++ )
+    {
+        status = pthread_join( WorkerThread[t], NULL );  assert( status == 0 );
+        Dar_LibDupFree( ThData[t].pLib );
+    }
+    *ppGia1 = ThData[0].pGia;
+    *ppGia2 = ThData[1].pGia;
+    if ( fVerbose )
+    {
+        printf( "Compress:  " ), Gia_ManPrintStats( *ppGia1, NULL );
+        printf( "Compress2: " ), Gia_ManPrintStats( *ppGia2, NULL );
+        for ( t = 0; t < 2; t++ )
+        {
+            printf( "Thread %2d : ", t );
+            Abc_PrintTime( 1, "Time", ThData[t].clkUsed );
+        }
+    }
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Performs DAG-aware rewriting and returns the new AIG.]
+
+  Description [If more than one thread is requested, the AIG is split
+  into windows, which are rewritten concurrently and put back together.
+  Otherwise, the AIG is rewritten in place and duplicated in the DFS order.
+  The node replacements crossing the window boundaries are not considered,
+  and, when levels are preserved, they are only preserved in each window,
+  so the result may differ from the single-threaded one.]
+
+  SideEffects [The original AIG may be modified.]
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManRewritePar( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    if ( !Dar_ManRewriteCheckPar(pAig, pPars) )
+    {
+        Dar_ManRewrite( pAig, pPars );
+        return Aig_ManDupDfs( pAig );
+    }
+    return Dar_ManRewritePth( pAig, pPars );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the miter of synthesis snapshots for choice computation.]
+
+  Description [Similar to Dar_NewChoiceSynthesis() except that it starts
+  from GIA and derives the snapshots "compress" and "compress2" concurrently.
+  As a result, both snapshots are derived from the original AIG, while the
+  single-threaded version applies "compress2" to the result of "compress".
+  The order of snapshots in the miter is the same: "compress2", "compress",
+  and the original AIG. Power-aware synthesis, which uses the shared random
+  generator, is only supported by the single-threaded version.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Dar_NewChoiceSynthesisPar( Gia_Man_t * p, int fBalance, int fUpdateLevel, int fLightSynth, int fVerbose )
+{
+    extern Gia_Man_t * Dar_NewChoiceSynthesis( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, int fLightSynth, int fVerbose );
+    extern int Dar_NewChoiceSynthesisGuard( Aig_Man_t * pAig );
+    Vec_Ptr_t * vGias;
+    Gia_Man_t * pGia, * pGia1 = NULL, * pGia2 = NULL;
+    Aig_Man_t * pAig, * pAig1, * pAig2;
+    int i;
+    pAig = Gia_ManToAig( p, 0 );
+#ifndef ABC_USE_PTHREADS
+    return Dar_NewChoiceSynthesis( pAig, fBalance, fUpdateLevel, 0, fLightSynth, fVerbose );
+#else
+    if ( fUpdateLevel && Dar_NewChoiceSynthesisGuard(pAig) )
+    {
+        if ( fVerbose )
+            printf( "Warning: Due to high fanout count of some nodes, level updating is disabled.\n" );
+        fUpdateLevel = 0;
+    }
+    if ( fVerbose ) printf( "Starting:  " ), Aig_ManPrintStats( pAig );
+    pAig1 = Aig_ManDupDfs( pAig );
+    pAig2 = Aig_ManDupDfs( pAig );
+    Dar_NewChoiceSynthesisPth( pAig1, pAig2, fBalance, fUpdateLevel, fLightSynth, &pGia1, &pGia2, fVerbose );
+    // collect the snapshots in the same order as Dar_NewChoiceSynthesis()
+    vGias = Vec_PtrAlloc( 3 );
+    Vec_PtrPush( vGias, pGia2 );
+    Vec_PtrPush( vGias, pGia1 );
+    Vec_PtrPush( vGias, Gia_ManFromAig(pAig) );
+    Aig_ManStop( pAig );
+    // derive the miter
+    pGia = Gia_ManChoiceMiter( vGias );
+    Vec_PtrForEachEntry( Gia_Man_t *, vGias, pGia1, i )
+        Gia_ManStop( pGia1 );
+    Vec_PtrFree( vGias );
+    return pGia;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -232,7 +232,7 @@ Aig_Man_t * Dar_ManCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, i
   SeeAlso     []
 
 ***********************************************************************/
-Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+Aig_Man_t * Dar_ManCompress2Par( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nThreads, int fVerbose )
 //alias compress2   "b -l; rw -l; rf -l; b -l; rw -l; rwz -l; b -l; rfz -l; rwz -l; b -l"
 {
     Aig_Man_t * pTemp;
@@ -247,6 +247,7 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     pParsRef->fUpdateLevel = fUpdateLevel;
     pParsRwr->fFanout = fFanout;
     pParsRwr->fPower = fPower;
+    pParsRwr->nThreads = nThreads;
 
     pParsRwr->fVerbose = 0;//fVerbose;
     pParsRef->fVerbose = 0;//fVerbose;
@@ -265,11 +266,10 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     // rewrite
 //    Dar_ManRewrite( pAig, pParsRwr );
     pParsRwr->fUpdateLevel = 0;  // disable level update
-    Dar_ManRewrite( pAig, pParsRwr );
+    pAig = Dar_ManRewritePar( pTemp = pAig, pParsRwr );
+    Aig_ManStop( pTemp );
     pParsRwr->fUpdateLevel = fUpdateLevel;  // reenable level update if needed
 
-    pAig = Aig_ManDupDfs( pTemp = pAig ); 
-    Aig_ManStop( pTemp );
     if ( fVerbose ) printf( "Rewrite:   " ), Aig_ManPrintStats( pAig );
     
     // refactor
@@ -287,8 +287,7 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     }
     
     // rewrite
-    Dar_ManRewrite( pAig, pParsRwr );
-    pAig = Aig_ManDupDfs( pTemp = pAig ); 
+    pAig = Dar_ManRewritePar( pTemp = pAig, pParsRwr );
     Aig_ManStop( pTemp );
     if ( fVerbose ) printf( "Rewrite:   " ), Aig_ManPrintStats( pAig );
 
@@ -296,8 +295,7 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     pParsRef->fUseZeros = 1;
     
     // rewrite
-    Dar_ManRewrite( pAig, pParsRwr );
-    pAig = Aig_ManDupDfs( pTemp = pAig ); 
+    pAig = Dar_ManRewritePar( pTemp = pAig, pParsRwr );
     Aig_ManStop( pTemp );
     if ( fVerbose ) printf( "RewriteZ:  " ), Aig_ManPrintStats( pAig );
 
@@ -316,8 +314,7 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     if ( fVerbose ) printf( "RefactorZ: " ), Aig_ManPrintStats( pAig );
     
     // rewrite
-    Dar_ManRewrite( pAig, pParsRwr );
-    pAig = Aig_ManDupDfs( pTemp = pAig ); 
+    pAig = Dar_ManRewritePar( pTemp = pAig, pParsRwr );
     Aig_ManStop( pTemp );
     if ( fVerbose ) printf( "RewriteZ:  " ), Aig_ManPrintStats( pAig );
 
@@ -331,6 +328,11 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     return pAig;
 }
 
+Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+{
+    return Dar_ManCompress2Par( pAig, fBalance, fUpdateLevel, fFanout, fPower, 1, fVerbose );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reproduces script "compress2".]
@@ -421,14 +423,15 @@ ABC_PRT( "Choicing time ", Abc_Clock() - clk );
 
   Synopsis    [Reproduces script "compress".]
 
-  Description []
+  Description [If the library copy is given, it is used instead of the
+  global library, so that several snapshots can be derived concurrently.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Aig_Man_t * Dar_NewCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, int fVerbose )
+Aig_Man_t * Dar_NewCompressLib( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, Dar_Lib_t * pLib, int fVerbose )
 //alias compress2   "b -l; rw -l; rwz -l; b -l; rwz -l; b -l"
 {
     Aig_Man_t * pTemp;
@@ -451,7 +454,7 @@ Aig_Man_t * Dar_NewCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, i
     if ( fVerbose ) printf( "Starting:  " ), Aig_ManPrintStats( pAig );
 
     // rewrite
-    Dar_ManRewrite( pAig, pParsRwr );
+    Dar_ManRewriteInt( pAig, pParsRwr, pLib );
     pAig = Aig_ManDupDfs( pTemp = pAig ); 
     Aig_ManStop( pTemp );
     if ( fVerbose ) printf( "Rewrite:   " ), Aig_ManPrintStats( pAig );
@@ -474,7 +477,7 @@ Aig_Man_t * Dar_NewCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, i
     pParsRef->fUseZeros = 1;
     
     // rewrite
-    Dar_ManRewrite( pAig, pParsRwr );
+    Dar_ManRewriteInt( pAig, pParsRwr, pLib );
     pAig = Aig_ManDupDfs( pTemp = pAig ); 
     Aig_ManStop( pTemp );
     if ( fVerbose ) printf( "RewriteZ:  " ), Aig_ManPrintStats( pAig );
@@ -482,18 +485,24 @@ Aig_Man_t * Dar_NewCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, i
     return pAig;
 }
 
+Aig_Man_t * Dar_NewCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, int fVerbose )
+{
+    return Dar_NewCompressLib( pAig, fBalance, fUpdateLevel, fPower, NULL, fVerbose );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reproduces script "compress2".]
 
-  Description []
+  Description [If the library copy is given, it is used instead of the
+  global library, so that several snapshots can be derived concurrently.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Aig_Man_t * Dar_NewCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fLightSynth, int fVerbose )
+Aig_Man_t * Dar_NewCompress2Lib( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fLightSynth, Dar_Lib_t * pLib, int fVerbose )
 //alias compress2   "b -l; rw -l; rf -l; b -l; rw -l; rwz -l; b -l; rfz -l; rwz -l; b -l"
 {
     Aig_Man_t * pTemp;
@@ -521,7 +530,7 @@ Aig_Man_t * Dar_NewCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
         // rewrite
         //Dar_ManRewrite( pAig, pParsRwr );
 //        pParsRwr->fUpdateLevel = 0;  // disable level update  // this change was requested in July and later disabled
-        Dar_ManRewrite( pAig, pParsRwr );
+        Dar_ManRewriteInt( pAig, pParsRwr, pLib );
 //        pParsRwr->fUpdateLevel = fUpdateLevel;  // reenable level update if needed
 
         pAig = Aig_ManDupDfs( pTemp = pAig ); 
@@ -544,7 +553,7 @@ Aig_Man_t * Dar_NewCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     if ( !fLightSynth )
     {
         // rewrite
-        Dar_ManRewrite( pAig, pParsRwr );
+        Dar_ManRewriteInt( pAig, pParsRwr, pLib );
         pAig = Aig_ManDupDfs( pTemp = pAig ); 
         Aig_ManStop( pTemp );
         if ( fVerbose ) printf( "Rewrite:   " ), Aig_ManPrintStats( pAig );
@@ -554,7 +563,7 @@ Aig_Man_t * Dar_NewCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     pParsRef->fUseZeros = 1;
     
     // rewrite
-    Dar_ManRewrite( pAig, pParsRwr );
+    Dar_ManRewriteInt( pAig, pParsRwr, pLib );
     pAig = Aig_ManDupDfs( pTemp = pAig ); 
     Aig_ManStop( pTemp );
     if ( fVerbose ) printf( "RewriteZ:  " ), Aig_ManPrintStats( pAig );
@@ -581,7 +590,7 @@ Aig_Man_t * Dar_NewCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     if ( !fLightSynth )
     {
         // rewrite
-        Dar_ManRewrite( pAig, pParsRwr );
+        Dar_ManRewriteInt( pAig, pParsRwr, pLib );
         pAig = Aig_ManDupDfs( pTemp = pAig ); 
         Aig_ManStop( pTemp );
         if ( fVerbose ) printf( "RewriteZ:  " ), Aig_ManPrintStats( pAig );
@@ -597,6 +606,11 @@ Aig_Man_t * Dar_NewCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     return pAig;
 }
 
+Aig_Man_t * Dar_NewCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fLightSynth, int fVerbose )
+{
+    return Dar_NewCompress2Lib( pAig, fBalance, fUpdateLevel, fFanout, fPower, fLightSynth, NULL, fVerbose );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Count the number of nodes with very high fanout count.]
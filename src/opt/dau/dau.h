@@ -87,6 +87,16 @@ extern void          Abc_TtHieManStop(Abc_TtHieMan_t * p );
 extern unsigned      Abc_TtCanonicizeWrap(TtCanonicizeFunc func, Abc_TtHieMan_t * p, word * pTruth, int nVars, char * pCanonPerm, int flag);
 extern unsigned      Abc_TtCanonicizeAda(Abc_TtHieMan_t * p, word * pTruth, int nVars, char * pCanonPerm, int iThres);
 extern unsigned      Abc_TtCanonicizeHie(Abc_TtHieMan_t * p, word * pTruthInit, int nVars, char * pCanonPerm, int fExact);
+/*=== dauCache.c ==========================================================*/
+extern void          Dau_NpnCacheStart( char * pFileName, int fVerbose );
+extern void          Dau_NpnCacheStop();
+extern int           Dau_NpnCacheSave();
+extern int           Dau_NpnCacheIsOn( int nVars );
+extern int           Dau_NpnCacheLookup( word * pTruth, int nVars, char * pCanonPerm, unsigned * puCanonPhase );
+extern void          Dau_NpnCacheInsert( word * pTruth, word * pCanon, int nVars, char * pCanonPerm, unsigned uCanonPhase );
+extern int           Dau_NpnCacheLookupDsd( word * pTruth, int nVars, char * pDsd, word * pRes );
+extern void          Dau_NpnCacheInsertDsd( word * pTruth, int nVars, char * pDsd, word * pRes, int nSizeNonDec );
+extern void          Dau_NpnCachePrintStats();
 /*=== dauCount.c ==========================================================*/
 extern int           Abc_TtCountOnesInCofsQuick( word * pTruth, int nVars, int * pStore );
 /*=== dauDsd.c  ==========================================================*/
@@ -0,0 +1,771 @@
+/**CFile****************************************************************
+
+  FileName    [dauCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware unmapping.]
+
+  Synopsis    [Persistent cache of NPN canonical forms and DSD structures.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: dauCache.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "dauInt.h"
+#include "misc/util/utilTruth.h"
+#include "misc/mem/mem.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache file starts with a header, followed by variable-size records.
+// Each record contains the record header, the truth table used as the key,
+// the canonical form (if the NPN data is present), the truth table of the
+// non-decomposable part and the DSD string (if the DSD data is present).
+// The sizes of all parts are multiples of 8 bytes, so the truth tables in
+// the mapped file are aligned. The records are only appended to the file.
+// When the same key is recorded several times, the data is merged.
+// Each record carries a checksum, and the records with a wrong checksum 
+// are skipped when the file is loaded. The processes sharing the file 
+// append to it under an exclusive lock and map it under a shared lock, 
+// so they do not see each other's partially written records.
+
+#define DAU_CACHE_VAR_MIN      6    // the smallest support size cached
+#define DAU_CACHE_VAR_MAX      8    // the largest support size cached
+#define DAU_CACHE_VERSION      2    // should be updated when canonicization changes
+#define DAU_CACHE_NPN          1    // the record contains the NPN data
+#define DAU_CACHE_DSD          2    // the record contains the DSD data
+
+typedef struct Dau_CacheHead_t_ Dau_CacheHead_t;
+struct Dau_CacheHead_t_
+{
+    char           pMagic[8];       // "abcnpn\n"
+    int            Version;         // the file version
+    int            nVarsMax;        // the largest support size
+};
+
+typedef struct Dau_CacheRec_t_ Dau_CacheRec_t;
+struct Dau_CacheRec_t_
+{
+    unsigned char  nVars;           // the number of variables
+    unsigned char  fFlags;          // the data present in the record
+    unsigned short nDsdLen;         // the size of the DSD string (including 0)
+    unsigned       uPhase;          // the phase of the canonical form
+    char           pPerm[8];        // the permutation of the canonical form
+    int            nSizeNonDec;     // the size of the non-decomposable part
+    unsigned       uCheck;          // the checksum of the record
+};
+
+typedef struct Dau_CacheEnt_t_ Dau_CacheEnt_t;
+struct Dau_CacheEnt_t_
+{
+    word *         pKey;            // the truth table
+    word *         pCanon;          // the canonical form
+    word *         pRes;            // the non-decomposable part
+    char *         pDsd;            // the DSD string
+    unsigned       uPhase;          // the phase of the canonical form
+    int            nSizeNonDec;     // the size of the non-decomposable part
+    char           pPerm[8];        // the permutation of the canonical form
+    int            nVars;           // the number of variables
+    int            fFlags;          // the data present in the entry
+    int            fDirty;          // the data to be written into the file
+};
+
+typedef struct Dau_Cache_t_ Dau_Cache_t;
+struct Dau_Cache_t_
+{
+    char *         pFileName;       // the cache file
+    int            fVerbose;        // verbose output
+    int            fLoaded;         // the file was loaded
+    int            fRewrite;        // the file should be rewritten
+    char *         pContents;       // the file contents
+    int            nFileSize;       // the file size
+    int            fMapped;         // the contents are mapped
+    Dau_CacheEnt_t * pEnts;         // the entries
+    int            nEnts;           // the number of entries
+    int            nEntsAlloc;      // the number of allocated entries
+    int *          pTable;          // the hash table (entry numbers plus one)
+    int            nTableMask;      // the hash table size minus one
+    Mem_Flex_t *   pMem;            // memory for the new entries
+    // statistics
+    int            nLoaded;         // the entries loaded from the file
+    int            nSaved;          // the records written into the file
+    int            nSkipped;        // the records skipped because of a wrong checksum
+    double         nLookups;        // canonical form lookups
+    double         nHits;           // canonical form hits
+    double         nDsdLookups;     // DSD lookups
+    double         nDsdHits;        // DSD hits
+    abctime        timeLoad;        // the time to load the file
+};
+
+static Dau_Cache_t * s_DauCache = NULL;
+static char          s_DauCacheMagic[8] = "abcnpn\n";
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Hash table.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Dau_CacheHash( word * pKey, int nWords, int nVars )
+{
+    word Hash = (word)nVars;
+    int i;
+    for ( i = 0; i < nWords; i++ )
+    {
+        Hash = (Hash ^ pKey[i]) * ABC_CONST(0x9E3779B97F4A7C15);
+        Hash ^= Hash >> 29;
+    }
+    return (unsigned)(Hash >> 32);
+}
+static int * Dau_CacheFind( Dau_Cache_t * p, word * pKey, int nVars )
+{
+    int nWords = Abc_TtWordNum( nVars );
+    int * pPlace = p->pTable + (Dau_CacheHash(pKey, nWords, nVars) & p->nTableMask);
+    Dau_CacheEnt_t * pEnt;
+    for ( ; *pPlace; pPlace = (pPlace == p->pTable + p->nTableMask) ? p->pTable : pPlace + 1 )
+    {
+        pEnt = p->pEnts + *pPlace - 1;
+        if ( pEnt->nVars == nVars && Abc_TtEqual(pEnt->pKey, pKey, nWords) )
+            return pPlace;
+    }
+    return pPlace;
+}
+static void Dau_CacheResize( Dau_Cache_t * p )
+{
+    Dau_CacheEnt_t * pEnt;
+    int i, * pPlace;
+    ABC_FREE( p->pTable );
+    p->nTableMask = 2 * p->nTableMask + 1;
+    p->pTable = ABC_CALLOC( int, p->nTableMask + 1 );
+    for ( i = 0; i < p->nEnts; i++ )
+    {
+        pEnt = p->pEnts + i;
+        pPlace = Dau_CacheFind( p, pEnt->pKey, pEnt->nVars );
+        assert( *pPlace == 0 );
+        *pPlace = i + 1;
+    }
+}
+// returns the entry with this key, while the key is stored if the entry is new
+static Dau_CacheEnt_t * Dau_CacheEntry( Dau_Cache_t * p, word * pKey, int nVars, int fCopyKey )
+{
+    Dau_CacheEnt_t * pEnt;
+    int * pPlace = Dau_CacheFind( p, pKey, nVars );
+    if ( *pPlace )
+        return p->pEnts + *pPlace - 1;
+    if ( p->nEnts == p->nEntsAlloc )
+    {
+        p->nEntsAlloc = Abc_MaxInt( 1000, 2 * p->nEntsAlloc );
+        p->pEnts = ABC_REALLOC( Dau_CacheEnt_t, p->pEnts, p->nEntsAlloc );
+    }
+    pEnt = p->pEnts + p->nEnts;
+    memset( pEnt, 0, sizeof(Dau_CacheEnt_t) );
+    pEnt->nVars = nVars;
+    pEnt->pKey  = fCopyKey ? (word *)Mem_FlexEntryFetch( p->pMem, sizeof(word) * Abc_TtWordNum(nVars) ) : pKey;
+    if ( fCopyKey )
+        Abc_TtCopy( pEnt->pKey, pKey, Abc_TtWordNum(nVars), 0 );
+    *pPlace = ++p->nEnts;
+    if ( 2 * p->nEnts > p->nTableMask )
+        Dau_CacheResize( p );
+    return pEnt;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the cache file into memory.]
+
+  Description [On Windows, the file is read into memory.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Dau_CacheMapFile( char * pFileName, int * pnFileSize, int * pfMapped )
+{
+    char * pContents = NULL;
+    FILE * pFile;
+    *pnFileSize = 0;
+    *pfMapped = 0;
+#ifndef _WIN32
+    {
+        struct stat Stat;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd == -1 )
+            return NULL;
+        // the shared lock keeps the writers away while the file is mapped
+        if ( flock( fd, LOCK_SH ) == -1 || fstat( fd, &Stat ) == -1 || Stat.st_size == 0 || Stat.st_size > 0x7FFFFFFF )
+        {
+            close( fd );
+            return NULL;
+        }
+        pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+        // the mapping keeps the file open, so closing it would not release the lock
+        flock( fd, LOCK_UN );
+        close( fd );
+        if ( pContents != (char *)MAP_FAILED )
+        {
+            *pnFileSize = (int)Stat.st_size;
+            *pfMapped = 1;
+            return pContents;
+        }
+        pContents = NULL;
+    }
+#endif
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    *pnFileSize = (int)ftell( pFile );
+    rewind( pFile );
+    if ( *pnFileSize > 0 )
+    {
+        pContents = ABC_ALLOC( char, *pnFileSize );
+        if ( fread( pContents, *pnFileSize, 1, pFile ) != 1 )
+        {
+            ABC_FREE( pContents );
+            *pnFileSize = 0;
+        }
+    }
+    fclose( pFile );
+    return pContents;
+}
+static void Dau_CacheUnmapFile( Dau_Cache_t * p )
+{
+    if ( p->pContents == NULL )
+        return;
+#ifndef _WIN32
+    if ( p->fMapped )
+        munmap( p->pContents, (size_t)p->nFileSize );
+    else
+#endif
+        ABC_FREE( p->pContents );
+    p->pContents = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the cache file.]
+
+  Description [Called when the cache is used for the first time. The
+  entries point to the mapped file, which is shared by the processes
+  using the same cache. If the file is missing, has another version, or
+  ends with an incomplete record, it is rewritten when the cache is saved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Dau_CacheRecSize( Dau_CacheRec_t * pRec )
+{
+    int nWords = Abc_TtWordNum( pRec->nVars );
+    int nSize  = sizeof(Dau_CacheRec_t) + sizeof(word) * nWords;
+    if ( pRec->fFlags & DAU_CACHE_NPN )
+        nSize += sizeof(word) * nWords;
+    if ( pRec->fFlags & DAU_CACHE_DSD )
+        nSize += sizeof(word) * nWords + 8 * ((pRec->nDsdLen + 7) / 8);
+    return nSize;
+}
+static inline unsigned Dau_CacheRecChecksum( Dau_CacheRec_t * pRec )
+{
+    Dau_CacheRec_t Rec = *pRec;
+    int nWords = (Dau_CacheRecSize(pRec) - (int)sizeof(Dau_CacheRec_t)) / 8;
+    Rec.uCheck = 0;
+    return Dau_CacheHash( (word *)&Rec, sizeof(Dau_CacheRec_t) / 8, 0 ) ^ Dau_CacheHash( (word *)(pRec + 1), nWords, 1 );
+}
+static void Dau_CacheLoad( Dau_Cache_t * p )
+{
+    Dau_CacheHead_t * pHead;
+    Dau_CacheRec_t * pRec;
+    Dau_CacheEnt_t * pEnt;
+    abctime clk = Abc_Clock();
+    char * pCur, * pEnd;
+    word * pData;
+    int nWords;
+    assert( !p->fLoaded );
+    p->fLoaded = 1;
+    p->pContents = Dau_CacheMapFile( p->pFileName, &p->nFileSize, &p->fMapped );
+    pHead = (Dau_CacheHead_t *)p->pContents;
+    if ( p->pContents == NULL || p->nFileSize < (int)sizeof(Dau_CacheHead_t) || memcmp(pHead->pMagic, s_DauCacheMagic, 8) || pHead->Version != DAU_CACHE_VERSION )
+    {
+        if ( p->pContents && p->fVerbose )
+            printf( "The NPN cache file \"%s\" has wrong format or version and will be rewritten.\n", p->pFileName );
+        Dau_CacheUnmapFile( p );
+        p->fRewrite = 1;
+        p->timeLoad = Abc_Clock() - clk;
+        return;
+    }
+    pCur = p->pContents + sizeof(Dau_CacheHead_t);
+    pEnd = p->pContents + p->nFileSize;
+    while ( pCur < pEnd )
+    {
+        pRec = (Dau_CacheRec_t *)pCur;
+        if ( pCur + sizeof(Dau_CacheRec_t) > pEnd || pRec->nVars < DAU_CACHE_VAR_MIN || pRec->nVars > DAU_CACHE_VAR_MAX || 
+             (pRec->fFlags & ~(DAU_CACHE_NPN | DAU_CACHE_DSD)) || pCur + Dau_CacheRecSize(pRec) > pEnd )
+        {
+            if ( p->fVerbose )
+                printf( "The NPN cache file \"%s\" has an incomplete record and will be rewritten.\n", p->pFileName );
+            p->fRewrite = 1;
+            break;
+        }
+        nWords = Abc_TtWordNum( pRec->nVars );
+        pData  = (word *)(pRec + 1);
+        if ( pRec->uCheck != Dau_CacheRecChecksum(pRec) || ((pRec->fFlags & DAU_CACHE_DSD) && 
+             (pRec->nDsdLen == 0 || ((char *)(pData + (pRec->fFlags & DAU_CACHE_NPN ? 3 : 2) * nWords))[pRec->nDsdLen-1] != 0)) )
+        {
+            p->nSkipped++;
+            p->fRewrite = 1;
+            pCur += Dau_CacheRecSize( pRec );
+            continue;
+        }
+        pEnt   = Dau_CacheEntry( p, pData, pRec->nVars, 0 );
+        pData += nWords;
+        if ( pRec->fFlags & DAU_CACHE_NPN )
+        {
+            if ( !(pEnt->fFlags & DAU_CACHE_NPN) )
+            {
+                pEnt->pCanon = pData;
+                pEnt->uPhase = pRec->uPhase;
+                memcpy( pEnt->pPerm, pRec->pPerm, 8 );
+                pEnt->fFlags |= DAU_CACHE_NPN;
+            }
+            pData += nWords;
+        }
+        if ( pRec->fFlags & DAU_CACHE_DSD )
+        {
+            if ( !(pEnt->fFlags & DAU_CACHE_DSD) )
+            {
+                pEnt->pRes = pData;
+                pEnt->pDsd = (char *)(pData + nWords);
+                pEnt->nSizeNonDec = pRec->nSizeNonDec;
+                pEnt->fFlags |= DAU_CACHE_DSD;
+            }
+        }
+        pCur += Dau_CacheRecSize( pRec );
+    }
+    if ( p->nSkipped && p->fVerbose )
+        printf( "Skipped %d corrupted records of the NPN cache file \"%s\", which will be rewritten.\n", p->nSkipped, p->pFileName );
+    p->nLoaded = p->nEnts;
+    p->timeLoad = Abc_Clock() - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the cache entries into the file.]
+
+  Description [Only the entries with the new data are appended, unless
+  the file is rewritten. The records are collected in a buffer and
+  written at once while the file is locked. If writing fails, the file 
+  is truncated to the old size. The file is rewritten by creating a 
+  temporary file and renaming it, so the processes using the old file 
+  are not affected. The old file is locked till the new one replaces it, 
+  and a process that locked a replaced file opens the new one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dau_CacheWriteEntry( Vec_Str_t * vOut, Dau_CacheEnt_t * pEnt )
+{
+    Dau_CacheRec_t Rec, * pRec;
+    int nWords = Abc_TtWordNum( pEnt->nVars );
+    int nDsdLen = pEnt->pDsd ? (int)strlen(pEnt->pDsd) + 1 : 0;
+    int iStart = Vec_StrSize( vOut );
+    memset( &Rec, 0, sizeof(Dau_CacheRec_t) );
+    Rec.nVars       = (unsigned char)pEnt->nVars;
+    Rec.fFlags      = (unsigned char)pEnt->fFlags;
+    Rec.nDsdLen     = (unsigned short)nDsdLen;
+    Rec.uPhase      = pEnt->uPhase;
+    Rec.nSizeNonDec = pEnt->nSizeNonDec;
+    memcpy( Rec.pPerm, pEnt->pPerm, 8 );
+    Vec_StrPushBuffer( vOut, (char *)&Rec, sizeof(Dau_CacheRec_t) );
+    Vec_StrPushBuffer( vOut, (char *)pEnt->pKey, sizeof(word) * nWords );
+    if ( pEnt->fFlags & DAU_CACHE_NPN )
+        Vec_StrPushBuffer( vOut, (char *)pEnt->pCanon, sizeof(word) * nWords );
+    if ( pEnt->fFlags & DAU_CACHE_DSD )
+    {
+        Vec_StrPushBuffer( vOut, (char *)pEnt->pRes, sizeof(word) * nWords );
+        Vec_StrPushBuffer( vOut, pEnt->pDsd, nDsdLen );
+        while ( nDsdLen++ % 8 )
+            Vec_StrPush( vOut, 0 );
+    }
+    pRec = (Dau_CacheRec_t *)(Vec_StrArray(vOut) + iStart);
+    pRec->uCheck = Dau_CacheRecChecksum( pRec );
+}
+#ifndef _WIN32
+static int Dau_CacheOpenLocked( char * pFileName )
+{
+    struct stat StatFd, StatName;
+    int fd;
+    while ( 1 )
+    {
+        fd = open( pFileName, O_WRONLY | O_APPEND | O_CREAT, 0666 );
+        if ( fd == -1 )
+            return -1;
+        if ( flock( fd, LOCK_EX ) == -1 || fstat( fd, &StatFd ) == -1 )
+        {
+            close( fd );
+            return -1;
+        }
+        // make sure the file was not replaced while waiting for the lock
+        if ( stat( pFileName, &StatName ) == 0 && StatName.st_dev == StatFd.st_dev && StatName.st_ino == StatFd.st_ino )
+            return fd;
+        close( fd );
+    }
+}
+static int Dau_CacheWriteAll( int fd, char * pBuffer, int nSize )
+{
+    ssize_t nWritten;
+    while ( nSize > 0 )
+    {
+        nWritten = write( fd, pBuffer, (size_t)nSize );
+        if ( nWritten == -1 && errno == EINTR )
+            continue;
+        if ( nWritten <= 0 )
+            return 0;
+        pBuffer += nWritten;
+        nSize   -= (int)nWritten;
+    }
+    return 1;
+}
+#endif
+static int Dau_CacheWriteFile( Dau_Cache_t * p, Vec_Str_t * vOut )
+{
+    char * pTemp = ABC_ALLOC( char, strlen(p->pFileName) + 30 );
+    int RetValue = 0;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd, fdLock = Dau_CacheOpenLocked( p->pFileName );
+    if ( fdLock == -1 )
+        printf( "Cannot open the NPN cache file \"%s\" for writing.\n", p->pFileName );
+    else if ( !p->fRewrite )
+    {
+        // append the records and cut them off if writing failed
+        if ( fstat( fdLock, &Stat ) == -1 )
+            printf( "Cannot write into the NPN cache file \"%s\".\n", p->pFileName );
+        else if ( Dau_CacheWriteAll( fdLock, Vec_StrArray(vOut), Vec_StrSize(vOut) ) )
+            RetValue = 1;
+        else
+        {
+            printf( "Cannot write into the NPN cache file \"%s\".\n", p->pFileName );
+            if ( ftruncate( fdLock, Stat.st_size ) ) {}
+        }
+    }
+    else
+    {
+        sprintf( pTemp, "%s.tmp%d", p->pFileName, (int)getpid() );
+        fd = open( pTemp, O_WRONLY | O_CREAT | O_TRUNC, 0666 );
+        if ( fd == -1 )
+            printf( "Cannot open the NPN cache file \"%s\" for writing.\n", pTemp );
+        else
+        {
+            RetValue = Dau_CacheWriteAll( fd, Vec_StrArray(vOut), Vec_StrSize(vOut) );
+            if ( close( fd ) )
+                RetValue = 0;
+            if ( !RetValue )
+                printf( "Cannot write into the NPN cache file \"%s\".\n", pTemp );
+            else if ( rename( pTemp, p->pFileName ) )
+            {
+                printf( "Cannot rename the NPN cache file \"%s\".\n", pTemp );
+                RetValue = 0;
+            }
+            if ( !RetValue )
+                remove( pTemp );
+        }
+    }
+    if ( fdLock != -1 )
+        close( fdLock );
+#else
+    FILE * pFile;
+    if ( p->fRewrite )
+        sprintf( pTemp, "%s.tmp", p->pFileName );
+    pFile = fopen( p->fRewrite ? pTemp : p->pFileName, p->fRewrite ? "wb" : "ab" );
+    if ( pFile == NULL )
+        printf( "Cannot open the NPN cache file \"%s\" for writing.\n", p->fRewrite ? pTemp : p->pFileName );
+    else
+    {
+        RetValue = (int)fwrite( Vec_StrArray(vOut), 1, Vec_StrSize(vOut), pFile ) == Vec_StrSize(vOut);
+        if ( fclose( pFile ) )
+            RetValue = 0;
+        if ( !RetValue )
+            printf( "Cannot write into the NPN cache file \"%s\".\n", p->fRewrite ? pTemp : p->pFileName );
+        else if ( p->fRewrite )
+        {
+            remove( p->pFileName );
+            if ( rename( pTemp, p->pFileName ) )
+            {
+                printf( "Cannot rename the NPN cache file \"%s\".\n", pTemp );
+                RetValue = 0;
+            }
+        }
+    }
+#endif
+    ABC_FREE( pTemp );
+    return RetValue;
+}
+int Dau_NpnCacheSave()
+{
+    Dau_Cache_t * p = s_DauCache;
+    Dau_CacheHead_t Head;
+    Vec_Str_t * vOut;
+    int i, nRecs = 0;
+    if ( p == NULL || !p->fLoaded )
+        return 0;
+    vOut = Vec_StrAlloc( 1 << 16 );
+    if ( p->fRewrite )
+    {
+        memset( &Head, 0, sizeof(Dau_CacheHead_t) );
+        memcpy( Head.pMagic, s_DauCacheMagic, 8 );
+        Head.Version  = DAU_CACHE_VERSION;
+        Head.nVarsMax = DAU_CACHE_VAR_MAX;
+        Vec_StrPushBuffer( vOut, (char *)&Head, sizeof(Dau_CacheHead_t) );
+    }
+    for ( i = 0; i < p->nEnts; i++ )
+        if ( p->fRewrite || p->pEnts[i].fDirty )
+            Dau_CacheWriteEntry( vOut, p->pEnts + i ), nRecs++;
+    if ( nRecs == 0 && !p->fRewrite )
+    {
+        Vec_StrFree( vOut );
+        return 0;
+    }
+    if ( !Dau_CacheWriteFile( p, vOut ) )
+    {
+        Vec_StrFree( vOut );
+        return 0;
+    }
+    if ( p->fVerbose )
+        printf( "Written %d records (%.2f MB) into the NPN cache file \"%s\".\n", nRecs, 1.0*Vec_StrSize(vOut)/(1<<20), p->pFileName );
+    Vec_StrFree( vOut );
+    for ( i = 0; i < p->nEnts; i++ )
+        p->pEnts[i].fDirty = 0;
+    p->fRewrite = 0;
+    p->nSaved += nRecs;
+    return nRecs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the cache.]
+
+  Description [Starting the cache only records the file name. The file
+  is loaded when the cache is used for the first time. Stopping the
+  cache appends the new entries to the file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dau_NpnCacheStart( char * pFileName, int fVerbose )
+{
+    Dau_Cache_t * p;
+    Dau_NpnCacheStop();
+    p = ABC_CALLOC( Dau_Cache_t, 1 );
+    p->pFileName  = Abc_UtilStrsav( pFileName );
+    p->fVerbose   = fVerbose;
+    p->nTableMask = (1 << 12) - 1;
+    p->pTable     = ABC_CALLOC( int, p->nTableMask + 1 );
+    p->pMem       = Mem_FlexStart();
+    s_DauCache = p;
+}
+void Dau_NpnCacheStop()
+{
+    Dau_Cache_t * p = s_DauCache;
+    if ( p == NULL )
+        return;
+    Dau_NpnCacheSave();
+    s_DauCache = NULL;
+    Dau_CacheUnmapFile( p );
+    Mem_FlexStop( p->pMem, 0 );
+    ABC_FREE( p->pEnts );
+    ABC_FREE( p->pTable );
+    ABC_FREE( p->pFileName );
+    ABC_FREE( p );
+}
+int Dau_NpnCacheIsOn( int nVars )
+{
+    return s_DauCache != NULL && nVars >= DAU_CACHE_VAR_MIN && nVars <= DAU_CACHE_VAR_MAX;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up and records the canonical forms.]
+
+  Description [If the canonical form is found, the truth table is
+  overwritten by it, the permutation is copied, and the phase is
+  returned through the last argument.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dau_NpnCacheLookup( word * pTruth, int nVars, char * pCanonPerm, unsigned * puCanonPhase )
+{
+    Dau_Cache_t * p = s_DauCache;
+    Dau_CacheEnt_t * pEnt;
+    int * pPlace;
+    if ( !Dau_NpnCacheIsOn(nVars) )
+        return 0;
+    if ( !p->fLoaded )
+        Dau_CacheLoad( p );
+    p->nLookups++;
+    pPlace = Dau_CacheFind( p, pTruth, nVars );
+    if ( *pPlace == 0 || !((pEnt = p->pEnts + *pPlace - 1)->fFlags & DAU_CACHE_NPN) )
+        return 0;
+    p->nHits++;
+    Abc_TtCopy( pTruth, pEnt->pCanon, Abc_TtWordNum(nVars), 0 );
+    memcpy( pCanonPerm, pEnt->pPerm, (size_t)nVars );
+    *puCanonPhase = pEnt->uPhase;
+    return 1;
+}
+void Dau_NpnCacheInsert( word * pTruth, word * pCanon, int nVars, char * pCanonPerm, unsigned uCanonPhase )
+{
+    Dau_Cache_t * p = s_DauCache;
+    Dau_CacheEnt_t * pEnt;
+    int nWords = Abc_TtWordNum( nVars );
+    if ( !Dau_NpnCacheIsOn(nVars) )
+        return;
+    if ( !p->fLoaded )
+        Dau_CacheLoad( p );
+    pEnt = Dau_CacheEntry( p, pTruth, nVars, 1 );
+    if ( pEnt->fFlags & DAU_CACHE_NPN )
+        return;
+    pEnt->pCanon = (word *)Mem_FlexEntryFetch( p->pMem, sizeof(word) * nWords );
+    Abc_TtCopy( pEnt->pCanon, pCanon, nWords, 0 );
+    memcpy( pEnt->pPerm, pCanonPerm, (size_t)nVars );
+    pEnt->uPhase  = uCanonPhase;
+    pEnt->fFlags |= DAU_CACHE_NPN;
+    pEnt->fDirty  = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up and records the results of DSD.]
+
+  Description [The DSD string and the truth table of the non-decomposable
+  part are the same as those computed by Dau_DsdDecompose() with prime
+  nodes written as truth tables. Returns the size of the non-decomposable
+  part, or -1 if the function is not in the cache.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dau_NpnCacheLookupDsd( word * pTruth, int nVars, char * pDsd, word * pRes )
+{
+    Dau_Cache_t * p = s_DauCache;
+    Dau_CacheEnt_t * pEnt;
+    int * pPlace;
+    if ( !Dau_NpnCacheIsOn(nVars) )
+        return -1;
+    if ( !p->fLoaded )
+        Dau_CacheLoad( p );
+    p->nDsdLookups++;
+    pPlace = Dau_CacheFind( p, pTruth, nVars );
+    if ( *pPlace == 0 || !((pEnt = p->pEnts + *pPlace - 1)->fFlags & DAU_CACHE_DSD) )
+        return -1;
+    p->nDsdHits++;
+    Abc_TtCopy( pRes, pEnt->pRes, Abc_TtWordNum(nVars), 0 );
+    strcpy( pDsd, pEnt->pDsd );
+    return pEnt->nSizeNonDec;
+}
+void Dau_NpnCacheInsertDsd( word * pTruth, int nVars, char * pDsd, word * pRes, int nSizeNonDec )
+{
+    Dau_Cache_t * p = s_DauCache;
+    Dau_CacheEnt_t * pEnt;
+    int nWords = Abc_TtWordNum( nVars );
+    int nDsdLen = (int)strlen( pDsd ) + 1;
+    if ( !Dau_NpnCacheIsOn(nVars) || nDsdLen > 0xFFFF )
+        return;
+    if ( !p->fLoaded )
+        Dau_CacheLoad( p );
+    pEnt = Dau_CacheEntry( p, pTruth, nVars, 1 );
+    if ( pEnt->fFlags & DAU_CACHE_DSD )
+        return;
+    pEnt->pRes = (word *)Mem_FlexEntryFetch( p->pMem, sizeof(word) * nWords );
+    Abc_TtCopy( pEnt->pRes, pRes, nWords, 0 );
+    pEnt->pDsd = Mem_FlexEntryFetch( p->pMem, 8 * ((nDsdLen + 7) / 8) ); // keeps the entries aligned
+    memcpy( pEnt->pDsd, pDsd, (size_t)nDsdLen );
+    pEnt->nSizeNonDec = nSizeNonDec;
+    pEnt->fFlags |= DAU_CACHE_DSD;
+    pEnt->fDirty  = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the cache statistics.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dau_NpnCachePrintStats()
+{
+    Dau_Cache_t * p = s_DauCache;
+    int i, nNpn = 0, nDsd = 0, nDirty = 0, pVars[DAU_CACHE_VAR_MAX+1] = {0};
+    if ( p == NULL )
+    {
+        printf( "The NPN cache is not used.\n" );
+        return;
+    }
+    for ( i = 0; i < p->nEnts; i++ )
+    {
+        nNpn   += (p->pEnts[i].fFlags & DAU_CACHE_NPN) > 0;
+        nDsd   += (p->pEnts[i].fFlags & DAU_CACHE_DSD) > 0;
+        nDirty += p->pEnts[i].fDirty;
+        pVars[p->pEnts[i].nVars]++;
+    }
+    printf( "NPN cache \"%s\" (%s):  ", p->pFileName, !p->fLoaded ? "not loaded" : (!p->pContents ? "new" : (p->fMapped ? "mapped" : "read")) );
+    printf( "File = %.2f MB.  Load = %.2f sec.\n", 1.0*p->nFileSize/(1<<20), 1.0*((double)(p->timeLoad))/((double)CLOCKS_PER_SEC) );
+    printf( "Entries = %d  (loaded = %d  new = %d  unsaved = %d  saved records = %d  skipped records = %d).  ", p->nEnts, p->nLoaded, p->nEnts - p->nLoaded, nDirty, p->nSaved, p->nSkipped );
+    printf( "Memory = %.2f MB.\n", 1.0*(Mem_FlexReadMemUsage(p->pMem) + sizeof(Dau_CacheEnt_t) * p->nEntsAlloc + sizeof(int) * (p->nTableMask + 1))/(1<<20) );
+    printf( "Support sizes: " );
+    for ( i = DAU_CACHE_VAR_MIN; i <= DAU_CACHE_VAR_MAX; i++ )
+        printf( " %d = %d", i, pVars[i] );
+    printf( ".\n" );
+    printf( "Canonical forms:  Entries = %8d.  Lookups = %10.0f.  Hits = %10.0f. (%6.2f %%)\n", nNpn, p->nLookups, p->nHits, p->nLookups ? 100.0*p->nHits/p->nLookups : 0.0 );
+    printf( "DSD structures:   Entries = %8d.  Lookups = %10.0f.  Hits = %10.0f. (%6.2f %%)\n", nDsd, p->nDsdLookups, p->nDsdHits, p->nDsdLookups ? 100.0*p->nDsdHits/p->nDsdLookups : 0.0 );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -302,7 +302,7 @@ void Abc_TtNormalizeSmallTruth(word * pTruth, int nVars)
     }
 }
 
-inline void Abc_TtVerifySmallTruth(word * pTruth, int nVars)
+static inline void Abc_TtVerifySmallTruth(word * pTruth, int nVars)
 {
 #ifndef NDEBUG
     if (nVars < 6) {
@@ -369,7 +369,7 @@ int Abc_TtCountOnesInCofsSimple( word * pTruth, int nVars, int * pStore )
 }
 
 // Shifted Cofactor Coefficient
-inline int shiftFunc(int ci)
+static inline int shiftFunc(int ci)
 //{ return ci * ci; }
 { return 1 << ci; }
 
@@ -1028,7 +1028,7 @@ int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char *
 
 ***********************************************************************/
 #define CANON_VERIFY
-unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
+static unsigned Abc_TtCanonicizeInt( word * pTruth, int nVars, char * pCanonPerm )
 {
     int pStoreIn[17];
     unsigned uCanonPhase;
@@ -1076,6 +1076,19 @@ unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
 */
     return uCanonPhase;
 }
+unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
+{
+    word pTruthInit[4];
+    unsigned uCanonPhase;
+    if ( !Dau_NpnCacheIsOn(nVars) )
+        return Abc_TtCanonicizeInt( pTruth, nVars, pCanonPerm );
+    if ( Dau_NpnCacheLookup( pTruth, nVars, pCanonPerm, &uCanonPhase ) )
+        return uCanonPhase;
+    Abc_TtCopy( pTruthInit, pTruth, Abc_TtWordNum(nVars), 0 );
+    uCanonPhase = Abc_TtCanonicizeInt( pTruth, nVars, pCanonPerm );
+    Dau_NpnCacheInsert( pTruthInit, pTruth, nVars, pCanonPerm, uCanonPhase );
+    return uCanonPhase;
+}
 
 unsigned Abc_TtCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm )
 {
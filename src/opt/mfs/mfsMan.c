@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "mfsInt.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -171,6 +172,20 @@ void Mfs_ManStop( Mfs_Man_t * p )
 {
     if ( p->pPars->fVerbose )
         Mfs_ManPrint( p );
+    if ( Util_ProfIsEnabled() )
+    {
+        Util_ProfTimeAdd( "mfs.win",   p->timeWin );
+        Util_ProfTimeAdd( "mfs.div",   p->timeDiv );
+        Util_ProfTimeAdd( "mfs.aig",   p->timeAig );
+        Util_ProfTimeAdd( "mfs.gia",   p->timeGia );
+        Util_ProfTimeAdd( "mfs.cnf",   p->timeCnf );
+        Util_ProfTimeAdd( "mfs.sat",   p->timeSat - p->timeInt );
+        Util_ProfTimeAdd( "mfs.int",   p->timeInt );
+        Util_ProfTimeAdd( "mfs.total", p->timeTotal );
+        Util_ProfCountAdd( "mfs.tried",    p->nNodesTried );
+        Util_ProfCountAdd( "mfs.resub",    p->nNodesResub );
+        Util_ProfCountAdd( "mfs.timeouts", p->nTimeOuts );
+    }
     if ( p->vTruth )
         Vec_IntFree( p->vTruth );
     if ( p->pManDec )
@@ -51,6 +51,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nThreads     =    1;  // the number of threads
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -202,6 +203,14 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // record the update to be performed by the caller
+    if ( p->fDelayUpd )
+    {
+        p->iUpdFanin = f;
+        p->iUpdNew   = iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar);
+        p->uUpdTruth = uTruth;
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth );
     return 1;
@@ -246,32 +255,18 @@ int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Performs resubstitution for all nodes in one thread.]
 
-  Description []
+  Description [Returns the number of nodes changed.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
+int Sfm_NtkPerformSerial( Sfm_Ntk_t * p )
 {
     int i, k, Counter = 0;
-    p->timeTotal = Abc_Clock();
-    if ( pPars->fVerbose )
-    {
-        int nFixed = p->vFixed ? Vec_StrSum(p->vFixed) : 0;
-        int nEmpty = p->vEmpty ? Vec_StrSum(p->vEmpty) : 0;
-        printf( "Performing MFS with %d PIs, %d POs, %d nodes (%d flexible, %d fixed, %d empty).\n", 
-            p->nPis, p->nPos, p->nNodes, p->nNodes-nFixed, nFixed, nEmpty );
-    }
-    p->pPars = pPars;
-    Sfm_NtkPrepare( p );
-//    Sfm_ComputeInterpolantCheck( p );
-//    return 0;
-    p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
-    p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
     Sfm_NtkForEachNode( p, i )
     {
         if ( Sfm_ObjIsFixed( p, i ) )
@@ -286,9 +281,44 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //            break;
         }
         Counter += (k > 0);
-        if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
+        if ( p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax )
             break;
     }
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
+{
+    int Counter;
+    p->timeTotal = Abc_Clock();
+    if ( pPars->fVerbose )
+    {
+        int nFixed = p->vFixed ? Vec_StrSum(p->vFixed) : 0;
+        int nEmpty = p->vEmpty ? Vec_StrSum(p->vEmpty) : 0;
+        printf( "Performing MFS with %d PIs, %d POs, %d nodes (%d flexible, %d fixed, %d empty).\n", 
+            p->nPis, p->nPos, p->nNodes, p->nNodes-nFixed, nFixed, nEmpty );
+    }
+    p->pPars = pPars;
+    Sfm_NtkPrepare( p );
+//    Sfm_ComputeInterpolantCheck( p );
+//    return 0;
+    p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
+    p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
+    if ( pPars->nThreads > 1 )
+        Counter = Sfm_NtkPerformPar( p );
+    else
+        Counter = Sfm_NtkPerformSerial( p );
     p->nTotalNodesEnd = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesEnd = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
     p->timeTotal = Abc_Clock() - p->timeTotal;
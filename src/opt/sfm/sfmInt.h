@@ -108,6 +108,11 @@ struct Sfm_Ntk_t_
     int               nTryResubs;  // number of resubstitutions
     int               nRemoves;    // number of fanin removals
     int               nResubs;     // number of resubstitutions
+    // delayed update
+    int               fDelayUpd;   // record the update instead of performing it
+    int               iUpdFanin;   // the fanin index to remove or replace
+    int               iUpdNew;     // the new fanin (or -1 if the fanin is removed)
+    word              uUpdTruth;   // the new truth table
     // counter-examples
     int               nCexes;      // number of CEXes
     Vec_Wrd_t *       vDivCexes;   // counter-examples
@@ -199,6 +204,8 @@ extern int          Sfm_TruthToCnf( word Truth, int nVars, Vec_Int_t * vCover, V
 extern Vec_Wec_t *  Sfm_CreateCnf( Sfm_Ntk_t * p );
 extern void         Sfm_TranslateCnf( Vec_Wec_t * vRes, Vec_Str_t * vCnf, Vec_Int_t * vFaninMap, int iPivotVar );
 /*=== sfmCore.c ==========================================================*/
+extern int          Sfm_NodeResub( Sfm_Ntk_t * p, int iNode );
+extern int          Sfm_NtkPerformSerial( Sfm_Ntk_t * p );
 /*=== sfmLib.c ==========================================================*/
 extern int          Sfm_LibFindComplInputGate( Vec_Wrd_t * vFuncs, int iGate, int nFanins, int iFanin, int * piFaninNew );
 extern Sfm_Lib_t *  Sfm_LibPrepare( int nVars, int fTwo, int fDelay, int fVerbose, int fLibVerbose );
@@ -213,6 +220,8 @@ extern int          Sfm_LibImplementGatesDelay( Sfm_Lib_t * p, int * pFanins, Mi
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth );
+/*=== sfmPth.c ==========================================================*/
+extern int          Sfm_NtkPerformPar( Sfm_Ntk_t * p );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
 extern word         Sfm_ComputeInterpolant( Sfm_Ntk_t * p );
@@ -0,0 +1,477 @@
+/**CFile****************************************************************
+
+  FileName    [sfmPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based optimization using internal don't-cares.]
+
+  Synopsis    [Multi-threaded resubstitution.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: sfmPth.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "sfmInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int Sfm_NtkPerformPar( Sfm_Ntk_t * p ) { return Sfm_NtkPerformSerial( p ); }
+
+#else // pthreads are used
+
+#define PAR_THR_MAX 100
+#define SFM_JOB_MUL   8   // the number of jobs per thread in one round
+
+typedef struct Sfm_Job_t_ Sfm_Job_t;
+struct Sfm_Job_t_
+{
+    int            iNode;       // the node to try
+    int            fFound;      // the update is found
+    int            iFanin;      // the fanin index to remove or replace
+    int            iFaninNew;   // the new fanin (or -1 if the fanin is removed)
+    word           uTruth;      // the new truth table
+    int            LevelR;      // the reverse level of the node
+    int            LevelNew;    // the level of the new fanin
+    Vec_Int_t *    vOrder;      // the objects of the window
+    Vec_Int_t *    vTfo;        // the TFO of the node in the window
+};
+
+typedef struct Sfm_ThData_t_
+{
+    Sfm_Ntk_t *    p;           // thread-private copy of the network manager
+    Sfm_Par_t      Pars;        // thread-private copy of the parameters
+    Sfm_Job_t *    pJob;        // the current job (or NULL to stop)
+    int            fWorking;    // the thread is busy
+    abctime        clkUsed;     // runtime of the thread
+} Sfm_ThData_t;
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the thread-private copy of the manager.]
+
+  Description [The copy shares the network (fanins, fanouts, levels,
+  truth tables and CNFs) with the original manager, which is not modified
+  while the threads are working. The traversal IDs, the window and the
+  SAT solver are private to the copy.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Sfm_Ntk_t * Sfm_NtkDupThread( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
+{
+    Sfm_Ntk_t * pNew = ABC_ALLOC( Sfm_Ntk_t, 1 );
+    *pNew = *p;
+    pNew->pPars = pPars;
+    memset( &pNew->vCounts,   0, sizeof(Vec_Int_t) );
+    memset( &pNew->vTravIds,  0, sizeof(Vec_Int_t) );
+    memset( &pNew->vTravIds2, 0, sizeof(Vec_Int_t) );
+    memset( &pNew->vId2Var,   0, sizeof(Vec_Int_t) );
+    memset( &pNew->vVar2Id,   0, sizeof(Vec_Int_t) );
+    Vec_IntFill( &pNew->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pNew->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pNew->vVar2Id,   2*p->nObjs, -1 );
+    pNew->nTravIds  = 0;
+    pNew->nTravIds2 = 0;
+    pNew->nSatVars  = 0;
+    pNew->vCover    = NULL;
+    pNew->fDelayUpd = 1;
+    // statistics
+    pNew->nTryRemoves = pNew->nTryResubs = pNew->nRemoves = pNew->nResubs = 0;
+    pNew->nNodesTried = pNew->nTotalDivs = pNew->nSatCalls = pNew->nTimeOuts = pNew->nMaxDivs = 0;
+    pNew->timeWin = pNew->timeDiv = pNew->timeCnf = pNew->timeSat = 0;
+    Sfm_NtkPrepare( pNew );
+    return pNew;
+}
+static void Sfm_NtkFreeThread( Sfm_Ntk_t * p )
+{
+    ABC_FREE( p->vCounts.pArray );
+    ABC_FREE( p->vTravIds.pArray );
+    ABC_FREE( p->vTravIds2.pArray );
+    ABC_FREE( p->vId2Var.pArray );
+    ABC_FREE( p->vVar2Id.pArray );
+    Vec_IntFreeP( &p->vNodes );
+    Vec_IntFreeP( &p->vDivs  );
+    Vec_IntFreeP( &p->vRoots );
+    Vec_IntFreeP( &p->vTfo   );
+    Vec_WrdFreeP( &p->vDivCexes );
+    Vec_IntFreeP( &p->vOrder );
+    Vec_IntFreeP( &p->vDivVars );
+    Vec_IntFreeP( &p->vDivIds );
+    Vec_IntFreeP( &p->vLits  );
+    Vec_IntFreeP( &p->vValues );
+    Vec_WecFreeP( &p->vClauses );
+    Vec_IntFreeP( &p->vFaninMap );
+    if ( p->pSat  ) sat_solver_delete( p->pSat );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the statistics of the thread to the manager.]
+
+  Description [The number of removals and resubstitutions is counted
+  by the main thread, because not all updates found are performed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Sfm_NtkAddStats( Sfm_Ntk_t * p, Sfm_Ntk_t * pThr )
+{
+    p->nNodesTried += pThr->nNodesTried;
+    p->nTryRemoves += pThr->nTryRemoves;
+    p->nTryResubs  += pThr->nTryResubs;
+    p->nTotalDivs  += pThr->nTotalDivs;
+    p->nSatCalls   += pThr->nSatCalls;
+    p->nTimeOuts   += pThr->nTimeOuts;
+    p->nMaxDivs    += pThr->nMaxDivs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the node should be tried.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sfm_NtkNodeIsCand( Sfm_Ntk_t * p, int i )
+{
+    if ( Sfm_ObjIsFixed( p, i ) )
+        return 0;
+    if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
+        return 0;
+    if ( Sfm_ObjFaninNum(p, i) < 2 || Sfm_ObjFaninNum(p, i) > 6 )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the update found can be performed.]
+
+  Description [The update found by the thread is valid as long as
+  the functions of the window objects did not change and no fanout was
+  added to or removed from the node and its TFO in the window. The first
+  array is marked for the objects whose function changed or which were
+  removed, the second one is marked for the objects whose fanouts changed.
+  Additionally, the level constraint is checked using the current levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sfm_NtkJobIsValid( Sfm_Ntk_t * p, Sfm_Job_t * pJob, Vec_Int_t * vMarkFun, Vec_Int_t * vMarkFan, int Stamp )
+{
+    int i, iObj;
+    Vec_IntForEachEntry( pJob->vOrder, iObj, i )
+        if ( Vec_IntEntry(vMarkFun, iObj) == Stamp )
+            return 0;
+    if ( Vec_IntEntry(vMarkFan, pJob->iNode) == Stamp )
+        return 0;
+    Vec_IntForEachEntry( pJob->vTfo, iObj, i )
+        if ( Vec_IntEntry(vMarkFan, iObj) == Stamp )
+            return 0;
+    if ( Sfm_ObjLevelR(p, pJob->iNode) > pJob->LevelR )
+        return 0;
+    if ( pJob->iFaninNew >= 0 && Sfm_ObjLevel(p, pJob->iFaninNew) > pJob->LevelNew )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the update and marks the objects it changed.]
+
+  Description [All objects whose fanins or fanouts may change belong to
+  the TFI of the node, which is included in the window.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Sfm_NtkJobUpdate( Sfm_Ntk_t * p, Sfm_Job_t * pJob, Vec_Int_t * vMarkFun, Vec_Int_t * vMarkFan, int Stamp, Vec_Int_t * vSizes )
+{
+    int i, iObj;
+    Vec_IntClear( vSizes );
+    Vec_IntForEachEntry( pJob->vOrder, iObj, i )
+    {
+        Vec_IntPush( vSizes, Sfm_ObjFaninNum(p, iObj) );
+        Vec_IntPush( vSizes, Sfm_ObjFanoutNum(p, iObj) );
+    }
+    Sfm_NtkUpdate( p, pJob->iNode, pJob->iFanin, pJob->iFaninNew, pJob->uTruth );
+    // the functions of the node and its TFO in the window may change
+    Vec_IntWriteEntry( vMarkFun, pJob->iNode, Stamp );
+    Vec_IntForEachEntry( pJob->vTfo, iObj, i )
+        Vec_IntWriteEntry( vMarkFun, iObj, Stamp );
+    // the objects in the TFI may be removed or lose/gain fanouts
+    Vec_IntForEachEntry( pJob->vOrder, iObj, i )
+    {
+        if ( Sfm_ObjFaninNum(p, iObj) != Vec_IntEntry(vSizes, 2*i) )
+            Vec_IntWriteEntry( vMarkFun, iObj, Stamp );
+        if ( Sfm_ObjFanoutNum(p, iObj) != Vec_IntEntry(vSizes, 2*i+1) )
+            Vec_IntWriteEntry( vMarkFan, iObj, Stamp );
+    }
+    if ( pJob->iFaninNew == -1 )
+        p->nRemoves++;
+    else
+        p->nResubs++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Sfm_NtkWorkerThread( void * pArg )
+{
+    Sfm_ThData_t * pThData = (Sfm_ThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    Sfm_Ntk_t * p = pThData->p;
+    Sfm_Job_t * pJob;
+    abctime clk;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->pJob == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        clk = Abc_Clock();
+        pJob = pThData->pJob;
+        pJob->fFound = Sfm_NodeResub( p, pJob->iNode );
+        if ( pJob->fFound )
+        {
+            pJob->iFanin    = p->iUpdFanin;
+            pJob->iFaninNew = p->iUpdNew;
+            pJob->uTruth    = p->uUpdTruth;
+            pJob->LevelR    = Sfm_ObjLevelR(p, pJob->iNode);
+            pJob->LevelNew  = p->iUpdNew >= 0 ? Sfm_ObjLevel(p, p->iUpdNew) : 0;
+            Vec_IntClear( pJob->vOrder );
+            Vec_IntAppend( pJob->vOrder, p->vOrder );
+            Vec_IntClear( pJob->vTfo );
+            Vec_IntAppend( pJob->vTfo, p->vTfo );
+        }
+        pThData->clkUsed += Abc_Clock() - clk;
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution for all nodes using several threads.]
+
+  Description [The nodes are processed in rounds. In each round, the
+  threads look for updates of a batch of nodes, which are spread across
+  the network, using their own windows and SAT solvers, while the network
+  is not modified. After this, the main thread performs the updates found
+  in the order of the batch, skipping those whose windows were changed by
+  earlier updates in the same round. The nodes that are updated or
+  skipped are tried again in the next round. Returns the number of nodes
+  changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformPar( Sfm_Ntk_t * p )
+{
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Sfm_ThData_t ThData[PAR_THR_MAX];
+    Sfm_Job_t * pJobs, * pJob;
+    Vec_Int_t * vNodes, * vBatch, * vRetry, * vChanged, * vMarkFun, * vMarkFan, * vSizes;
+    int nThreads = Abc_MinInt( p->pPars->nThreads, PAR_THR_MAX );
+    int nBatch   = SFM_JOB_MUL * nThreads;
+    int i, k, t, iNode, status, fRunning, nSegSize, iRound = 0, nRounds = 0, nSkipped = 0, Counter = 0;
+    // collect the nodes
+    vNodes = Vec_IntAlloc( p->nNodes );
+    Sfm_NtkForEachNode( p, i )
+        Vec_IntPush( vNodes, i );
+    nSegSize = (Vec_IntSize(vNodes) + nBatch - 1) / nBatch;
+    // the batch never exceeds the size of the previous batch plus nBatch
+    pJobs = ABC_CALLOC( Sfm_Job_t, 2 * nBatch );
+    for ( i = 0; i < 2 * nBatch; i++ )
+    {
+        pJobs[i].vOrder = Vec_IntAlloc( 100 );
+        pJobs[i].vTfo   = Vec_IntAlloc( 100 );
+    }
+    vBatch   = Vec_IntAlloc( 2 * nBatch );
+    vRetry   = Vec_IntAlloc( 2 * nBatch );
+    vChanged = Vec_IntStart( p->nObjs );
+    vMarkFun = Vec_IntStart( p->nObjs );
+    vMarkFan = Vec_IntStart( p->nObjs );
+    vSizes   = Vec_IntAlloc( 1000 );
+    // start the threads
+    for ( t = 0; t < nThreads; t++ )
+    {
+        ThData[t].Pars     = *p->pPars;
+        ThData[t].Pars.fVerbose = 0;
+        ThData[t].Pars.fVeryVerbose = 0;
+        ThData[t].p        = Sfm_NtkDupThread( p, &ThData[t].Pars );
+        ThData[t].pJob     = NULL;
+        ThData[t].fWorking = 0;
+        ThData[t].clkUsed  = 0;
+        status = pthread_create( WorkerThread + t, NULL, Sfm_NtkWorkerThread, (void *)(ThData + t) );  assert( status == 0 );
+    }
+    while ( 1 )
+    {
+        // the nodes to retry come first, followed by one node from each segment
+        Vec_IntClear( vBatch );
+        Vec_IntAppend( vBatch, vRetry );
+        if ( Vec_IntSize(vRetry) < nBatch && iRound < nSegSize )
+        {
+            for ( k = 0; k < nBatch; k++ )
+                if ( k * nSegSize + iRound < Vec_IntSize(vNodes) )
+                    Vec_IntPush( vBatch, Vec_IntEntry(vNodes, k * nSegSize + iRound) );
+            iRound++;
+        }
+        if ( Vec_IntSize(vBatch) == 0 )
+            break;
+        nRounds++;
+        // give each candidate node to the first idle thread
+        k = 0;
+        Vec_IntForEachEntry( vBatch, iNode, i )
+        {
+            if ( !Sfm_NtkNodeIsCand(p, iNode) )
+                continue;
+            pJob = pJobs + k++;
+            pJob->iNode  = iNode;
+            pJob->fFound = 0;
+            for ( t = 0; *(volatile int *)&ThData[t].fWorking; t = (t + 1) % nThreads );
+            ThData[t].pJob = pJob;
+            ThData[t].fWorking = 1;
+        }
+        // wait till the threads finish
+        for ( fRunning = 1; fRunning; )
+        {
+            fRunning = 0;
+            for ( t = 0; t < nThreads; t++ )
+                if ( *(volatile int *)&ThData[t].fWorking )
+                    fRunning = 1;
+        }
+        // perform the updates
+        Vec_IntClear( vRetry );
+        for ( i = 0; i < k; i++ )
+        {
+            pJob = pJobs + i;
+            if ( !pJob->fFound )
+                continue;
+            if ( !Sfm_NtkJobIsValid(p, pJob, vMarkFun, vMarkFan, nRounds) )
+            {
+                Vec_IntPush( vRetry, pJob->iNode );
+                nSkipped++;
+                continue;
+            }
+            Sfm_NtkJobUpdate( p, pJob, vMarkFun, vMarkFan, nRounds, vSizes );
+            Vec_IntPush( vRetry, pJob->iNode );
+            if ( Vec_IntEntry(vChanged, pJob->iNode) == 0 )
+            {
+                Vec_IntWriteEntry( vChanged, pJob->iNode, 1 );
+                Counter++;
+            }
+        }
+        if ( p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax )
+            break;
+    }
+    // stop the threads
+    for ( t = 0; t < nThreads; t++ )
+    {
+        assert( !ThData[t].fWorking );
+        ThData[t].pJob = NULL;
+        ThData[t].fWorking = 1;
+    }
+    for ( t = 0; t < nThreads; t++ )
+    {
+        status = pthread_join( WorkerThread[t], NULL );  assert( status == 0 );
+        Sfm_NtkAddStats( p, ThData[t].p );
+        Sfm_NtkFreeThread( ThData[t].p );
+    }
+    if ( p->pPars->fVerbose )
+    {
+        printf( "Threads = %d. Rounds = %d. Updates skipped due to conflicts = %d.\n", nThreads, nRounds, nSkipped );
+        for ( t = 0; t < nThreads; t++ )
+        {
+            printf( "Thread %2d : ", t );
+            Abc_PrintTime( 1, "Time", ThData[t].clkUsed );
+        }
+    }
+    for ( i = 0; i < 2 * nBatch; i++ )
+    {
+        Vec_IntFree( pJobs[i].vOrder );
+        Vec_IntFree( pJobs[i].vTfo );
+    }
+    ABC_FREE( pJobs );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vBatch );
+    Vec_IntFree( vRetry );
+    Vec_IntFree( vChanged );
+    Vec_IntFree( vMarkFun );
+    Vec_IntFree( vMarkFan );
+    Vec_IntFree( vSizes );
+    return Counter;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
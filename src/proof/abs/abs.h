@@ -58,6 +58,7 @@ struct Abs_Par_t_
     int            nRatioMin;          // stop when less than this % of object is unabstracted
     int            nRatioMin2;         // stop when less than this % of object is unabstracted during refinement
     int            nRatioMax;          // restart when the number of abstracted object is more than this
+    int            nProcs;             // the number of threads (the main one and the look-ahead ones)
     int            fUseTermVars;       // use terminal variables
     int            fUseRollback;       // use rollback to the starting number of frames
     int            fPropFanout;        // propagate fanout implications
@@ -138,6 +139,10 @@ extern Gia_Man_t *       Gia_ManShrinkGla( Gia_Man_t * p, int nFrameMax, int nTi
 extern void              Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose );
 extern void              Gia_GlaProveCancel( int fVerbose );
 extern int               Gia_GlaProveCheck( int fVerbose );
+extern void *            Gia_GlaBmcStart( int nThreads, int nFramesMax, int nConfLimit, int fVerbose );
+extern void              Gia_GlaBmcUpdate( void * p, Gia_Man_t * pAig, int nAbsSize, int iFrame );
+extern int               Gia_GlaBmcIsProved( void * p, int iFrame );
+extern void              Gia_GlaBmcStop( void * p );
 /*=== absVta.c =========================================================*/
 extern int               Gia_VtaPerform( Gia_Man_t * pAig, Abs_Par_t * pPars );
 /*=== absUtil.c =========================================================*/
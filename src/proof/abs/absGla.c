@@ -1505,6 +1505,7 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
     abctime clk2, clk = Abc_Clock();
     int Status = l_Undef, RetValue = -1, iFrameTryToProve = -1, fOneIsSent = 0;
     int i, c, f, Lit;
+    void * pBmc = NULL;
     pPars->iFrame = -1;
     // check trivial case 
     assert( Gia_ManPoNum(pAig) == 1 ); 
@@ -1530,6 +1531,9 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
     // start the manager
     p = Ga2_ManStart( pAig, pPars );
     p->timeInit = Abc_Clock() - clk;
+    // start the look-ahead threads (&gla -J <num>)
+    if ( pPars->nProcs > 1 )
+        pBmc = Gia_GlaBmcStart( pPars->nProcs - 1, pPars->nFramesMax, pPars->nConfLimit, pPars->fVerbose );
     // perform initial abstraction
     if ( p->pPars->fVerbose )
     {
@@ -1629,7 +1633,10 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                 }
                 // perform SAT solving
                 clk2 = Abc_Clock();
-                Status = sat_solver2_solve( p->pSat, &Lit, &Lit+1, (ABC_INT64_T)pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+                if ( c == 0 && pBmc && Gia_GlaBmcIsProved( pBmc, f ) ) // proved by the look-ahead threads
+                    Status = l_False;
+                else
+                    Status = sat_solver2_solve( p->pSat, &Lit, &Lit+1, (ABC_INT64_T)pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
                 if ( Status == l_True ) // perform refinement
                 {
                     p->nCexes++;
@@ -1789,6 +1796,9 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                     goto finish;
                 }
             }
+            // give the following timeframes to the look-ahead threads
+            if ( pBmc )
+                Gia_GlaBmcUpdate( pBmc, pAig, Vec_IntSize(p->vAbs), f );
             // check the number of stable frames
             if ( p->pPars->nFramesNoChange == p->pPars->nFramesNoChangeLim )
             {
@@ -1839,6 +1849,9 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
     }
 finish:
     Prf_ManStopP( &p->pSat->pPrf2 );
+    // stop the look-ahead threads
+    if ( pBmc )
+        Gia_GlaBmcStop( pBmc );
     // cancel old one if it is proving
     if ( iFrameTryToProve >= 0 )
         Gia_GlaProveCancel( pPars->fVerbose );
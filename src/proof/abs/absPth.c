@@ -21,6 +21,8 @@
 #include "abs.h"
 #include "proof/pdr/pdr.h"
 #include "proof/ssw/ssw.h"
+#include "sat/cnf/cnf.h"
+#include "sat/bsat/satSolver2.h"
 
 
 #ifdef ABC_USE_PTHREADS
@@ -46,6 +48,11 @@ void Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose ) {}
 void Gia_GlaProveCancel( int fVerbose )                                    {}
 int  Gia_GlaProveCheck( int fVerbose )                                     { return 0; }
 
+void * Gia_GlaBmcStart( int nThreads, int nFramesMax, int nConfLimit, int fVerbose )       { return NULL; }
+void   Gia_GlaBmcUpdate( void * p, Gia_Man_t * pAig, int nAbsSize, int iFrame )          {}
+int    Gia_GlaBmcIsProved( void * p, int iFrame )                                        { return 0; }
+void   Gia_GlaBmcStop( void * p )                                                        {}
+
 #else // pthreads are used
 
 // information given to the thread
@@ -194,6 +201,353 @@ int Gia_GlaProveCheck( int fVerbose )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Look-ahead BMC on the abstraction.]
+
+  Description [While the main thread of GLA is working on the current
+  timeframe, the helper threads check the following timeframes using the
+  current abstraction, each on its own unrolling and its own SAT solver.
+  A timeframe proved with some abstraction remains proved with any larger
+  abstraction, and GLA abstractions only grow, so the main thread can skip
+  SAT solving in the timeframes proved by the helpers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+
+#define PAR_THR_MAX 100
+
+// information given to the look-ahead thread
+typedef struct Abs_BmcData_t_
+{
+    Gia_Man_t *  pAbs;         // the abstraction to check
+    int          iFrame;       // the timeframe to check (-1 if none)
+    int          nConfLimit;   // the conflict limit
+    int          Status;       // the result (1 = unsat; 0 = sat; -1 = undecided)
+    int          nAbsSize;     // the abstraction size
+    int          fCancel;      // the request to stop
+    int          fWorking;     // the thread is busy
+} Abs_BmcData_t;
+
+// look-ahead manager
+typedef struct Abs_BmcMan_t_
+{
+    int            nThreads;     // the number of helper threads
+    int            nFramesMax;   // the max number of frames
+    int            fVerbose;     // verbosity flag
+    Vec_Int_t *    vProved;      // timeframes proved by the helpers
+    Vec_Int_t *    vFailed;      // abstraction size when a timeframe was not proved
+    int            nProved;      // the number of proved timeframes
+    int            nUsed;        // the number of timeframes skipped by the main thread
+    pthread_t      Threads[PAR_THR_MAX];
+    Abs_BmcData_t  ThData[PAR_THR_MAX];
+} Abs_BmcMan_t;
+
+/**Function*************************************************************
+
+  Synopsis    [Unrolls the abstraction and returns the output of one timeframe.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_GlaBmcUnroll( Gia_Man_t * p, int iFrame )
+{
+    Gia_Man_t * pNew, * pTemp;
+    Gia_Obj_t * pObj, * pObjRi, * pObjRo;
+    int i, f;
+    assert( Gia_ManPoNum(p) == 1 );
+    pNew = Gia_ManStart( (iFrame + 1) * Gia_ManObjNum(p) );
+    Gia_ManHashAlloc( pNew );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachRo( p, pObj, i )
+        pObj->Value = 0;
+    for ( f = 0; f <= iFrame; f++ )
+    {
+        Gia_ManForEachPi( p, pObj, i )
+            pObj->Value = Gia_ManAppendCi( pNew );
+        Gia_ManForEachAnd( p, pObj, i )
+            pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        Gia_ManForEachCo( p, pObj, i )
+            pObj->Value = Gia_ObjFanin0Copy(pObj);
+        Gia_ManForEachRiRo( p, pObjRi, pObjRo, i )
+            pObjRo->Value = pObjRi->Value;
+    }
+    Gia_ManAppendCo( pNew, Gia_ManPo(p, 0)->Value );
+    Gia_ManHashStop( pNew );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks one timeframe of the abstraction.]
+
+  Description [Returns 1 if the output is proved to be 0 in this timeframe,
+  0 if it can be 1, and -1 if undecided or cancelled.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_GlaBmcSolve( Gia_Man_t * pAbs, int iFrame, int nConfLimit, volatile int * pfCancel )
+{
+    Gia_Man_t * pFrames;
+    Aig_Man_t * pAig;
+    Cnf_Dat_t * pCnf;
+    sat_solver2 * pSat;
+    int i, Lit, status, RetValue = -1;
+    pFrames = Gia_GlaBmcUnroll( pAbs, iFrame );
+    if ( Gia_ObjIsConst0(Gia_ObjFanin0(Gia_ManPo(pFrames, 0))) )
+    {
+        RetValue = !Gia_ObjFaninC0(Gia_ManPo(pFrames, 0));
+        Gia_ManStop( pFrames );
+        return RetValue;
+    }
+    pAig = Gia_ManToAigSimple( pFrames );
+    Gia_ManStop( pFrames );
+    pCnf = Cnf_DeriveSimple( pAig, 1 );
+    pSat = sat_solver2_new();
+    sat_solver2_setnvars( pSat, pCnf->nVars );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        sat_solver2_addclause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1], -1 );
+    Lit = toLit( pCnf->pVarNums[Aig_ManCo(pAig, 0)->Id] );
+    // solve in small chunks to react to cancellation
+    while ( !*pfCancel )
+    {
+        status = sat_solver2_solve( pSat, &Lit, &Lit + 1, (ABC_INT64_T)1000, (ABC_INT64_T)0, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)0 );
+        if ( status == l_False )
+            RetValue = 1;
+        else if ( status == l_True )
+            RetValue = 0;
+        else if ( !nConfLimit || sat_solver2_nconflicts(pSat) < nConfLimit )
+            continue;
+        break;
+    }
+    sat_solver2_delete( pSat );
+    Cnf_DataFree( pCnf );
+    Aig_ManStop( pAig );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Look-ahead thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abs_BmcThread( void * pArg )
+{
+    Abs_BmcData_t * pThData = (Abs_BmcData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->pAbs == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        pThData->Status = Gia_GlaBmcSolve( pThData->pAbs, pThData->iFrame, pThData->nConfLimit, &pThData->fCancel );
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the look-ahead threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_GlaBmcStart( int nThreads, int nFramesMax, int nConfLimit, int fVerbose )
+{
+    Abs_BmcMan_t * p;
+    int i, status;
+    p = ABC_CALLOC( Abs_BmcMan_t, 1 );
+    p->nThreads   = Abc_MinInt( nThreads, PAR_THR_MAX );
+    p->nFramesMax = nFramesMax;
+    p->fVerbose   = fVerbose;
+    p->vProved    = Vec_IntAlloc( 100 );
+    p->vFailed    = Vec_IntAlloc( 100 );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        p->ThData[i].pAbs       = NULL;
+        p->ThData[i].iFrame     = -1;
+        p->ThData[i].nConfLimit = nConfLimit;
+        p->ThData[i].fCancel    = 0;
+        p->ThData[i].fWorking   = 0;
+        status = pthread_create( p->Threads + i, NULL, Abs_BmcThread, (void *)(p->ThData + i) );  assert( status == 0 );
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the results of the look-ahead threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_GlaBmcCollect( Abs_BmcMan_t * p )
+{
+    Abs_BmcData_t * pThData;
+    int i;
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        pThData = p->ThData + i;
+        if ( *(volatile int *)&pThData->fWorking || pThData->pAbs == NULL )
+            continue;
+        if ( pThData->Status == 1 && !Vec_IntGetEntry(p->vProved, pThData->iFrame) )
+        {
+            Vec_IntSetEntry( p->vProved, pThData->iFrame, 1 );
+            p->nProved++;
+        }
+        else if ( pThData->Status == 0 )
+            Vec_IntSetEntry( p->vFailed, pThData->iFrame, pThData->nAbsSize );
+        Gia_ManStop( pThData->pAbs );
+        pThData->pAbs    = NULL;
+        pThData->iFrame  = -1;
+        pThData->fCancel = 0;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Gives the following timeframes to the idle threads.]
+
+  Description [Should be called by the main thread after it finished
+  timeframe iFrame. The threads working on the timeframes already reached
+  by the main thread are cancelled. The idle threads get the next
+  timeframes, which were neither proved nor disproved with the abstraction
+  of the same size.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_GlaBmcUpdate( void * pMan, Gia_Man_t * pAig, int nAbsSize, int iFrame )
+{
+    Abs_BmcMan_t * p = (Abs_BmcMan_t *)pMan;
+    Abs_BmcData_t * pThData;
+    int i, k, f = iFrame + 2, fStop = iFrame + 2 + p->nThreads;
+    if ( p->nFramesMax )
+        fStop = Abc_MinInt( fStop, p->nFramesMax );
+    Gia_GlaBmcCollect( p );
+    // cancel the threads that fell behind
+    for ( i = 0; i < p->nThreads; i++ )
+        if ( p->ThData[i].pAbs && p->ThData[i].iFrame <= iFrame )
+            p->ThData[i].fCancel = 1;
+    // assign the timeframes
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        pThData = p->ThData + i;
+        if ( pThData->pAbs )
+            continue;
+        for ( ; f < fStop; f++ )
+        {
+            if ( Vec_IntGetEntry(p->vProved, f) || Vec_IntGetEntry(p->vFailed, f) == nAbsSize )
+                continue;
+            for ( k = 0; k < p->nThreads; k++ )
+                if ( p->ThData[k].pAbs && p->ThData[k].iFrame == f )
+                    break;
+            if ( k == p->nThreads )
+                break;
+        }
+        if ( f == fStop )
+            break;
+        pThData->pAbs     = Gia_ManDupAbsGates( pAig, pAig->vGateClasses );
+        pThData->iFrame   = f++;
+        pThData->nAbsSize = nAbsSize;
+        pThData->Status   = -1;
+        pThData->fWorking = 1;
+    }
+    Gia_ManCleanValue( pAig );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the timeframe was proved by the look-ahead threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_GlaBmcIsProved( void * pMan, int iFrame )
+{
+    Abs_BmcMan_t * p = (Abs_BmcMan_t *)pMan;
+    Gia_GlaBmcCollect( p );
+    if ( !Vec_IntGetEntry(p->vProved, iFrame) )
+        return 0;
+    p->nUsed++;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the look-ahead threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_GlaBmcStop( void * pMan )
+{
+    Abs_BmcMan_t * p = (Abs_BmcMan_t *)pMan;
+    int i, status;
+    for ( i = 0; i < p->nThreads; i++ )
+        p->ThData[i].fCancel = 1;
+    for ( i = 0; i < p->nThreads; i++ )
+        while ( *(volatile int *)&p->ThData[i].fWorking );
+    Gia_GlaBmcCollect( p );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        p->ThData[i].pAbs = NULL;
+        p->ThData[i].fWorking = 1;
+    }
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        status = pthread_join( p->Threads[i], NULL );  assert( status == 0 );
+    }
+    if ( p->fVerbose )
+        Abc_Print( 1, "Look-ahead BMC with %d threads proved %d timeframes (%d skipped by the main thread).\n", p->nThreads, p->nProved, p->nUsed );
+    Vec_IntFree( p->vProved );
+    Vec_IntFree( p->vFailed );
+    ABC_FREE( p );
+}
+
 #endif // pthreads are used
 
 ////////////////////////////////////////////////////////////////////////
@@ -55,6 +55,7 @@ void Abs_ParSetDefaults( Abs_Par_t * p )
     p->nTimeOut           =      0;   // timeout in seconds
     p->nRatioMin          =      0;   // stop when less than this % of object is abstracted
     p->nRatioMax          =     30;   // restart when more than this % of object is abstracted
+    p->nProcs             =      1;   // the number of threads (the main one and the look-ahead ones)
     p->fUseTermVars       =      0;   // use terminal variables
     p->fUseRollback       =      0;   // use rollback to the starting number of frames
     p->fPropFanout        =      1;   // propagate fanouts during refinement
@@ -23,6 +23,7 @@
 #include "aig/gia/giaAig.h"
 #include "misc/extra/extra.h"
 #include "sat/cnf/cnf.h"
+#include "sat/satoko/satoko.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -128,6 +129,89 @@ int Cec_ManVerifyOld( Gia_Man_t * pMiter, int fVerbose, int * piOutFail, abctime
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the miter using the Satoko portfolio.]
+
+  Description [Each output of the XOR miter is solved under an assumption
+  by a portfolio of nProcs clause-sharing Satoko solvers, which is started
+  from one solver holding the CNF of the whole miter. The outputs proved
+  equivalent are asserted as units, so later outputs benefit from them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManVerifySatoko( Gia_Man_t * pMiter, Cec_ParCec_t * pPars, abctime clkTotal )
+{
+    Gia_Man_t * pTemp = Gia_ManTransformMiter( pMiter );
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( pTemp, 8, 0, 0, 0, 0 );
+    satoko_t * pSat = satoko_create();
+    satoko_opts_t Opts;
+    Gia_Obj_t * pObj;
+    int i, k, Lit, iVar, status, RetValue = 1, * pValues;
+    satoko_default_opts( &Opts );
+    Opts.verbose = pPars->fVeryVerbose;
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        satoko_add_clause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] );
+    satoko_configure( pSat, &Opts );
+    if ( pPars->TimeLimit )
+        satoko_set_runtime_limit( pSat, clkTotal + (abctime)pPars->TimeLimit * CLOCKS_PER_SEC );
+    pPars->iOutFail = -1;
+    Gia_ManForEachPo( pTemp, pObj, i )
+    {
+        if ( Gia_ObjFaninLit0p(pTemp, pObj) == 0 )
+            continue;
+        Lit = Abc_Var2Lit( pCnf->pVarNums[Gia_ObjId(pTemp, pObj)], 0 );
+        satoko_assump_push( pSat, Lit );
+        status = satoko_solve_parallel( pSat, pPars->nProcs );
+        satoko_assump_pop( pSat );
+        if ( pPars->fVerbose )
+        {
+            Abc_Print( 1, "Output %6d : %-6s  ", i, status == SATOKO_SAT ? "SAT" : status == SATOKO_UNSAT ? "UNSAT" : "UNDEC" );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+        }
+        if ( status == SATOKO_UNSAT )
+        {
+            Lit = Abc_LitNot( Lit );
+            satoko_add_clause( pSat, &Lit, 1 );
+            continue;
+        }
+        if ( status == SATOKO_UNDEC )
+        {
+            RetValue = -1;
+            if ( pPars->TimeLimit && (Abc_Clock() - clkTotal)/CLOCKS_PER_SEC >= pPars->TimeLimit )
+                break;
+            continue;
+        }
+        // derive the counter-example
+        pValues = ABC_CALLOC( int, Gia_ManCiNum(pTemp) );
+        Gia_ManForEachCi( pTemp, pObj, k )
+            if ( (iVar = pCnf->pVarNums[Gia_ObjId(pTemp, pObj)]) >= 0 )
+                pValues[k] = satoko_read_cex_varvalue( pSat, iVar );
+        Cec_ManTransformPattern( pMiter, i, pValues );
+        ABC_FREE( pValues );
+        pPars->iOutFail = i;
+        RetValue = 0;
+        break;
+    }
+    if ( !pPars->fSilent )
+    {
+        if ( RetValue == 1 )
+            Abc_Print( 1, "Networks are equivalent.  " );
+        else if ( RetValue == 0 )
+            Abc_Print( 1, "Networks are NOT EQUIVALENT.  " );
+        else
+            Abc_Print( 1, "Networks are UNDECIDED.  " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    }
+    satoko_destroy( pSat );
+    Cnf_DataFree( pCnf );
+    Gia_ManStop( pTemp );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -401,10 +485,20 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
         return -1;
     }
     // call other solver
-    if ( pPars->fVerbose )
-        Abc_Print( 1, "Calling the old CEC engine.\n" );
-    fflush( stdout );
-    RetValue = Cec_ManVerifyOld( pNew, pPars->fVerbose, &pPars->iOutFail, clkTotal, pPars->fSilent );
+    if ( pPars->nProcs > 1 )
+    {
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Calling the Satoko portfolio with %d solvers.\n", pPars->nProcs );
+        fflush( stdout );
+        RetValue = Cec_ManVerifySatoko( pNew, pPars, clkTotal );
+    }
+    else
+    {
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Calling the old CEC engine.\n" );
+        fflush( stdout );
+        RetValue = Cec_ManVerifyOld( pNew, pPars->fVerbose, &pPars->iOutFail, clkTotal, pPars->fSilent );
+    }
     p->pCexComb = pNew->pCexComb; pNew->pCexComb = NULL;
     if ( p->pCexComb && !Gia_ManVerifyCex( p, p->pCexComb, 1 ) )
         Abc_Print( 1, "Counter-example simulation has failed.\n" );
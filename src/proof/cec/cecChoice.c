@@ -401,6 +401,47 @@ Aig_Man_t * Cec_ComputeChoices( Gia_Man_t * pGia, Dch_Pars_t * pPars )
     return pAig;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs computation of AIGs with choices without leaving GIA.]
+
+  Description [Derives the synthesis snapshots concurrently, proves the
+  candidate equivalences of their miter using several threads, and returns
+  the AIG with choices represented as siblings, as expected by the mappers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cec_ComputeChoicesPar( Gia_Man_t * p, Dch_Pars_t * pPars )
+{
+    extern Gia_Man_t * Dar_NewChoiceSynthesisPar( Gia_Man_t * p, int fBalance, int fUpdateLevel, int fLightSynth, int fVerbose );
+    extern void Cec3_ManComputeChoiceEquivs( Gia_Man_t * p, int nWords, int nConfLimit, int nProcs, int fVerbose );
+    Gia_Man_t * pMiter, * pTemp, * pNew;
+    abctime clk = Abc_Clock();
+    pMiter = Dar_NewChoiceSynthesisPar( p, 1, 1, pPars->fLightSynth, pPars->fVerbose );
+    pPars->timeSynth = Abc_Clock() - clk;
+    if ( pPars->fVerbose )
+        Abc_PrintTime( 1, "Synthesis time", pPars->timeSynth );
+    clk = Abc_Clock();
+    Cec3_ManComputeChoiceEquivs( pMiter, pPars->nWords, pPars->nBTLimit, pPars->nThreads, pPars->fVerbose );
+    pTemp = Gia_ManEquivToChoices( pMiter, 3 );
+    Gia_ManStop( pMiter );
+    pNew = Gia_ManEquivToSibls( pTemp );
+    Gia_ManStop( pTemp );
+    ABC_FREE( pNew->pName );
+    ABC_FREE( pNew->pSpec );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    if ( pPars->fVerbose )
+    {
+        printf( "Choices = %d.  ", Gia_ManChoiceNum(pNew) );
+        Abc_PrintTime( 1, "Choicing time", Abc_Clock() - clk );
+    }
+    return pNew;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "cecInt.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -132,6 +133,7 @@ void Cec_ManFraSetDefaultParams( Cec_ParFra_t * p )
     p->nBTLimit       =     100;  // conflict limit at a node
     p->nLevelMax      =       0;  // restriction on the level of nodes to be swept
     p->nDepthMax      =       1;  // the depth in terms of steps of speculative reduction
+    p->nProcs         =       1;  // the number of threads
     p->fRewriting     =       0;  // enables AIG rewriting
     p->fCheckMiter    =       0;  // the circuit is the miter
 //    p->fFirstStop     =       0;  // stop on the first sat output
@@ -163,6 +165,7 @@ void Cec_ManCecSetDefaultParams( Cec_ParCec_t * p )
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fUseSmartCnf   =       0;  // use smart CNF computation
     p->fRewriting     =       0;  // enables AIG rewriting
+    p->nProcs         =       1;  // the number of solvers in the portfolio for hard outputs
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the number of failed output
@@ -527,6 +530,17 @@ finalize:
         Abc_PrintTime( 1, "Time", (int)(Abc_Clock() - clkTotal) );
     }
 
+    if ( Util_ProfIsEnabled() )
+    {
+        Util_ProfTimeAdd( "cec.sim",   p->timeSim );
+        Util_ProfTimeAdd( "cec.sat",   p->timeSat - pPat->timeTotalSave );
+        Util_ProfTimeAdd( "cec.pat",   p->timePat + pPat->timeTotalSave );
+        Util_ProfTimeAdd( "cec.total", Abc_Clock() - clkTotal );
+        Util_ProfCountAdd( "cec.proved",    p->nAllProved );
+        Util_ProfCountAdd( "cec.disproved", p->nAllDisproved );
+        Util_ProfCountAdd( "cec.failed",    p->nAllFailed );
+    }
+
     pTemp = p->pAig; p->pAig = NULL;
     if ( pTemp == NULL && pSim->iOut >= 0 )
     {
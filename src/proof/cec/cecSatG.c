@@ -23,6 +23,17 @@
 #include "sat/glucose/AbcGlucose.h"
 #include "cec.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -37,6 +48,7 @@ struct Cec3_Par_t_
     int              nSimRounds;    // simulation rounds
     int              nItersMax;     // max number of iterations
     int              nConfLimit;    // SAT solver conflict limit
+    int              nProcs;        // the number of threads
     int              fIsMiter;      // this is a miter
     int              fUseCones;     // use logic cones
     int              fVeryVerbose;  // verbose stats
@@ -59,6 +71,15 @@ struct Cec3_Man_t_
     Vec_Int_t *      vSatVars;       // nodes
     Vec_Int_t *      vObjSatPairs;   // nodes
     Vec_Int_t *      vCexTriples;    // nodes
+    Vec_Int_t *      vCexVals;       // CI values of the counter-example
+    // multi-threading
+    int              nThreads;       // the number of sweeping threads
+    void *           pThData;        // thread data
+    void *           pThreads;       // thread handles
+    Vec_Int_t *      vBatch;         // nodes waiting for SAT calls
+    Vec_Int_t *      vStatus;        // the results of SAT calls
+    Vec_Wrd_t *      vTimes;         // the runtime of SAT calls
+    Vec_Wec_t *      vCexes;         // CI values of the counter-examples
     // statistics
     int              nPatterns;
     int              nSatSat;
@@ -102,6 +123,7 @@ void Cec3_SetDefaultParams( Cec3_Par_t * p )
     p->nSimRounds     =       4;    // simulation rounds
     p->nItersMax      =      10;    // max number of iterations
     p->nConfLimit     =    1000;    // conflict limit at a node
+    p->nProcs         =       1;    // the number of threads
     p->fIsMiter       =       0;    // this is a miter
     p->fUseCones      =       0;    // use logic cones
     p->fVeryVerbose   =       0;    // verbose stats
@@ -402,23 +424,11 @@ static inline void Cec3_ObjSimCo( Gia_Man_t * p, int iObj )
 }
 static inline void Cec3_ObjSimAnd( Gia_Man_t * p, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSim  = Cec3_ObjSim( p, iObj );
     word * pSim0 = Cec3_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec3_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & ~pSim1[w];
-    else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & pSim1[w];
-    else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & ~pSim1[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & pSim1[w];
+    Gia_SimdAnd( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), p->nSimWords );
 }
 static inline int Cec3_ObjSimEqual( Gia_Man_t * p, int iObj0, int iObj1 )
 {
@@ -686,6 +696,7 @@ Cec3_Man_t * Cec3_ManCreate( Gia_Man_t * pAig, Cec3_Par_t * pPars )
     p->vSatVars     = Vec_IntAlloc( 100 );
     p->vObjSatPairs = Vec_IntAlloc( 100 );
     p->vCexTriples  = Vec_IntAlloc( 100 );
+    p->vCexVals     = Vec_IntAlloc( 100 );
     //Pars.conf_limit = pPars->nConfLimit;
     //satoko_configure(p->pSat, &Pars);
     // remember pointer to the solver in the AIG manager
@@ -723,6 +734,7 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
     Vec_IntFreeP( &p->vSatVars );
     Vec_IntFreeP( &p->vObjSatPairs );
     Vec_IntFreeP( &p->vCexTriples );
+    Vec_IntFreeP( &p->vCexVals );
     ABC_FREE( p );
 }
 
@@ -858,24 +870,35 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
     return status;
 }
 
-int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
+int Cec3_ManSweepNodeSolve( Cec3_Man_t * p, int iObj, Vec_Int_t * vCexVals )
 {
-    abctime clk = Abc_Clock();
-    int i, IdAig, IdSat, status, RetValue = 1;
+    int i, IdAig, IdSat, status;
     Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
     Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
     int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
     status = Cec3_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl );
+    Vec_IntClear( vCexVals );
+    if ( status == GLUCOSE_SAT )
+        Vec_IntForEachEntryDouble( p->vObjSatPairs, IdAig, IdSat, i )
+//            Vec_IntPushTwo( vCexVals, IdAig, satoko_var_polarity(p->pSat, IdSat) == SATOKO_LIT_TRUE );
+            Vec_IntPushTwo( vCexVals, IdAig, bmcg_sat_solver_read_cex_varvalue(p->pSat, IdSat) );
+    return status;
+}
+int Cec3_ManSweepNodeRecord( Cec3_Man_t * p, int iObj, int status, Vec_Int_t * vCexVals, abctime clk )
+{
+    int i, IdAig, Value, RetValue = 1;
+    Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
+    Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
+    int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
     if ( status == GLUCOSE_SAT )
     {
         p->nSatSat++;
         p->nPatterns++;
         p->pAig->iPatsPi = (p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 1) ? 1 : p->pAig->iPatsPi + 1;
         assert( p->pAig->iPatsPi > 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords );
-        Vec_IntForEachEntryDouble( p->vObjSatPairs, IdAig, IdSat, i )
-//            Cec3_ObjSimSetInputBit( p->pAig, IdAig, satoko_var_polarity(p->pSat, IdSat) == SATOKO_LIT_TRUE );
-            Cec3_ObjSimSetInputBit( p->pAig, IdAig, bmcg_sat_solver_read_cex_varvalue(p->pSat, IdSat) );
-        p->timeSatSat += Abc_Clock() - clk;
+        Vec_IntForEachEntryDouble( vCexVals, IdAig, Value, i )
+            Cec3_ObjSimSetInputBit( p->pAig, IdAig, Value );
+        p->timeSatSat += clk;
         RetValue = 0;
     }
     else if ( status == GLUCOSE_UNSAT )
@@ -883,7 +906,7 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
         p->nSatUnsat++;
         pObj->Value = Abc_LitNotCond( pRepr->Value, fCompl );
         Gia_ObjSetProved( p->pAig, iObj );
-        p->timeSatUnsat += Abc_Clock() - clk;
+        p->timeSatUnsat += clk;
         RetValue = 1;
     }
     else 
@@ -891,9 +914,16 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
         p->nSatUndec++;
         assert( status == GLUCOSE_UNDEC );
         Gia_ObjSetFailed( p->pAig, iObj );
-        p->timeSatUndec += Abc_Clock() - clk;
+        p->timeSatUndec += clk;
         RetValue = 2;
     }
+    return RetValue;
+}
+int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
+{
+    abctime clk = Abc_Clock();
+    int status = Cec3_ManSweepNodeSolve( p, iObj, p->vCexVals );
+    int RetValue = Cec3_ManSweepNodeRecord( p, iObj, status, p->vCexVals, Abc_Clock() - clk );
     if ( p->pPars->fUseCones )
         return RetValue;
     clk = Abc_Clock();
@@ -902,6 +932,265 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
 //    satoko_stats(p->pSat)->n_conflicts = 0;
     return RetValue;
 }
+void Cec3_ManSweepDupNode( Cec3_Man_t * pMan, Gia_Obj_t * pObj )
+{
+    Gia_Obj_t * pObjNew;
+    pObj->Value = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    if ( Vec_IntSize(&pMan->pNew->vCopies2) == Abc_Lit2Var(pObj->Value) )
+    {
+        pObjNew = Gia_ManObj( pMan->pNew, Abc_Lit2Var(pObj->Value) );
+        pObjNew->fMark0 = Gia_ObjIsMuxType( pObjNew );
+        Gia_ObjSetPhase( pMan->pNew, pObjNew );
+        Vec_IntPush( &pMan->pNew->vCopies2, -1 );
+    }
+    assert( Vec_IntSize(&pMan->pNew->vCopies2) == Gia_ManObjNum(pMan->pNew) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded SAT sweeping.]
+
+  Description [The candidate nodes are visited in the same order as in
+  the single-threaded sweeping. A candidate is added to the batch after 
+  it is duplicated into the internal AIG. The batch is solved when it is 
+  full or when the next node depends on a pending node through its fanins 
+  or its representative. Each thread owns a solver and a copy of the 
+  manager, which gives it private CNF variable mapping and traversal IDs, 
+  while the internal AIG itself is only read. The results are recorded 
+  by the main thread in the order of the nodes, so the counter-examples
+  are added to the shared simulation info in the same order and the 
+  result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Cec3_ManStartThreads( Cec3_Man_t * p ) {}
+void Cec3_ManStopThreads( Cec3_Man_t * p )  {}
+int  Cec3_ManSweepPar( Cec3_Man_t * p )     { return 0; }
+
+#else // pthreads are used
+
+#define PAR_THR_MAX 100
+
+typedef struct Cec3_ThData_t_
+{
+    Cec3_Man_t * pMain;       // the main manager
+    Cec3_Man_t * pMan;        // thread-private copy of the manager
+    int          iThread;     // thread number
+    int          fWorking;    // the thread is busy
+    abctime      clkUsed;     // runtime of the thread
+} Cec3_ThData_t;
+
+void * Cec3_ManWorkerThread( void * pArg )
+{
+    Cec3_ThData_t * pThData = (Cec3_ThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    Cec3_Man_t * p, * pMain;
+    abctime clk, clkOne;
+    int k;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->pMain == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        clk = Abc_Clock();
+        p = pThData->pMan;
+        pMain = pThData->pMain;
+        for ( k = pThData->iThread; k < Vec_IntSize(pMain->vBatch); k += pMain->nThreads )
+        {
+            clkOne = Abc_Clock();
+            Vec_IntWriteEntry( pMain->vStatus, k, Cec3_ManSweepNodeSolve(p, Vec_IntEntry(pMain->vBatch, k), Vec_WecEntry(pMain->vCexes, k)) );
+            bmcg_sat_solver_reset( p->pSat );
+            Vec_WrdWriteEntry( pMain->vTimes, k, (word)(Abc_Clock() - clkOne) );
+        }
+        pThData->clkUsed += Abc_Clock() - clk;
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+void Cec3_ManSyncThread( Cec3_Man_t * p, Gia_Man_t * pNew )
+{
+    // the fields of the AIG owned by the thread
+    Vec_Int_t vCopies2  = p->pNew->vCopies2;
+    int * pTravIds      = p->pNew->pTravIds;
+    int nTravIds        = p->pNew->nTravIds;
+    int nTravIdsAlloc   = p->pNew->nTravIdsAlloc;
+    memcpy( p->pNew, pNew, sizeof(Gia_Man_t) );
+    p->pNew->vCopies2      = vCopies2;
+    p->pNew->pTravIds      = pTravIds;
+    p->pNew->nTravIds      = nTravIds;
+    p->pNew->nTravIdsAlloc = nTravIdsAlloc;
+    Vec_IntFillExtra( &p->pNew->vCopies2, Gia_ManObjNum(pNew), -1 );
+}
+void Cec3_ManStartThreads( Cec3_Man_t * p )
+{
+    Cec3_ThData_t * ThData;
+    pthread_t * WorkerThread;
+    int t, status;
+    if ( p->pPars->nProcs < 2 || p->pPars->fUseCones )
+        return;
+    Gia_ManCleanMark1( p->pAig );
+    p->nThreads  = Abc_MinInt( p->pPars->nProcs, PAR_THR_MAX );
+    p->vBatch    = Vec_IntAlloc( 100 );
+    p->vStatus   = Vec_IntAlloc( 100 );
+    p->vTimes    = Vec_WrdAlloc( 100 );
+    p->vCexes    = Vec_WecAlloc( 100 );
+    p->pThData   = ThData = ABC_CALLOC( Cec3_ThData_t, p->nThreads );
+    p->pThreads  = WorkerThread = ABC_ALLOC( pthread_t, p->nThreads );
+    for ( t = 0; t < p->nThreads; t++ )
+    {
+        Cec3_Man_t * pThr = ABC_CALLOC( Cec3_Man_t, 1 );
+        pThr->pPars        = p->pPars;
+        pThr->pAig         = p->pAig;
+        pThr->pNew         = ABC_CALLOC( Gia_Man_t, 1 );
+        pThr->pSat         = bmcg_sat_solver_start();
+        pThr->vFrontier    = Vec_PtrAlloc( 1000 );
+        pThr->vFanins      = Vec_PtrAlloc( 100 );
+        pThr->vNodesNew    = Vec_IntAlloc( 100 );
+        pThr->vSatVars     = Vec_IntAlloc( 100 );
+        pThr->vObjSatPairs = Vec_IntAlloc( 100 );
+        ThData[t].pMain    = p;
+        ThData[t].pMan     = pThr;
+        ThData[t].iThread  = t;
+        ThData[t].fWorking = 0;
+        ThData[t].clkUsed  = 0;
+        status = pthread_create( WorkerThread + t, NULL, Cec3_ManWorkerThread, (void *)(ThData + t) );  assert( status == 0 );
+    }
+}
+void Cec3_ManStopThreads( Cec3_Man_t * p )
+{
+    Cec3_ThData_t * ThData = (Cec3_ThData_t *)p->pThData;
+    pthread_t * WorkerThread = (pthread_t *)p->pThreads;
+    int t, status;
+    if ( p->nThreads == 0 )
+        return;
+    for ( t = 0; t < p->nThreads; t++ )
+    {
+        assert( !ThData[t].fWorking );
+        ThData[t].pMain = NULL;
+        ThData[t].fWorking = 1;
+    }
+    for ( t = 0; t < p->nThreads; t++ )
+    {
+        Cec3_Man_t * pThr = ThData[t].pMan;
+        status = pthread_join( WorkerThread[t], NULL );  assert( status == 0 );
+        if ( p->pPars->fVerbose )
+        {
+            Abc_Print( 1, "Thread %2d : ", t );
+            Abc_PrintTime( 1, "Time", ThData[t].clkUsed );
+        }
+        bmcg_sat_solver_stop( pThr->pSat );
+        Vec_IntErase( &pThr->pNew->vCopies2 );
+        ABC_FREE( pThr->pNew->pTravIds );
+        ABC_FREE( pThr->pNew );
+        Vec_PtrFreeP( &pThr->vFrontier );
+        Vec_PtrFreeP( &pThr->vFanins );
+        Vec_IntFreeP( &pThr->vNodesNew );
+        Vec_IntFreeP( &pThr->vSatVars );
+        Vec_IntFreeP( &pThr->vObjSatPairs );
+        ABC_FREE( pThr );
+    }
+    ABC_FREE( p->pThData );
+    ABC_FREE( p->pThreads );
+    Vec_IntFreeP( &p->vBatch );
+    Vec_IntFreeP( &p->vStatus );
+    Vec_WrdFreeP( &p->vTimes );
+    Vec_WecFreeP( &p->vCexes );
+    p->nThreads = 0;
+}
+int Cec3_ManSweepBatch( Cec3_Man_t * pMan )
+{
+    Cec3_ThData_t * ThData = (Cec3_ThData_t *)pMan->pThData;
+    Gia_Man_t * p = pMan->pAig;
+    Gia_Obj_t * pObj, * pRepr;
+    int t, k, iObj, fRunning, fDisproved = 0;
+    int nSize = Vec_IntSize(pMan->vBatch);
+    if ( nSize == 0 )
+        return 0;
+    Vec_IntFill( pMan->vStatus, nSize, GLUCOSE_UNDEC );
+    Vec_WrdFill( pMan->vTimes, nSize, 0 );
+    Vec_WecClear( pMan->vCexes );
+    Vec_WecInit( pMan->vCexes, nSize );
+    // solve the batch
+    for ( t = 0; t < pMan->nThreads; t++ )
+        Cec3_ManSyncThread( ThData[t].pMan, pMan->pNew );
+    for ( t = 0; t < pMan->nThreads; t++ )
+        ThData[t].fWorking = 1;
+    for ( fRunning = 1; fRunning; )
+    {
+        fRunning = 0;
+        for ( t = 0; t < pMan->nThreads; t++ )
+            if ( ThData[t].fWorking )
+                fRunning = 1;
+    }
+    // record the results in the order of the nodes
+    Vec_IntForEachEntry( pMan->vBatch, iObj, k )
+    {
+        pObj  = Gia_ManObj( p, iObj );
+        pRepr = Gia_ObjReprObj( p, iObj );
+        pObj->fMark1 = 0;
+        if ( Cec3_ManSweepNodeRecord(pMan, iObj, Vec_IntEntry(pMan->vStatus, k), Vec_WecEntry(pMan->vCexes, k), (abctime)Vec_WrdEntry(pMan->vTimes, k)) )
+        {
+            if ( Gia_ObjProved(p, iObj) )
+                pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            continue;
+        }
+        pObj->Value = ~0;
+        Vec_IntPushThree( pMan->vCexTriples, Gia_ObjId(p, pRepr), iObj, Abc_Var2Lit(p->iPatsPi, pObj->fPhase ^ pRepr->fPhase) );
+        fDisproved = 1;
+    }
+    Vec_IntClear( pMan->vBatch );
+    return fDisproved;
+}
+int Cec3_ManSweepPar( Cec3_Man_t * pMan )
+{
+    Gia_Man_t * p = pMan->pAig;
+    Gia_Obj_t * pObj, * pRepr;
+    int i, fDisproved = 0, nBatchMax = 16 * pMan->nThreads;
+    assert( pMan->nThreads > 0 );
+    Vec_IntClear( pMan->vBatch );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( ~pObj->Value || Gia_ObjFailed(p, i) ) // skip swept nodes and failed nodes
+            continue;
+        // solve the pending nodes this node depends on
+        pRepr = Gia_ObjReprObj( p, i );
+        if ( Gia_ObjFanin0(pObj)->fMark1 || Gia_ObjFanin1(pObj)->fMark1 || (pRepr && pRepr->fMark1) )
+            fDisproved |= Cec3_ManSweepBatch( pMan );
+        if ( !~Gia_ObjFanin0(pObj)->Value || !~Gia_ObjFanin1(pObj)->Value ) // skip fanouts of non-swept nodes
+            continue;
+        assert( !Gia_ObjProved(p, i) && !Gia_ObjFailed(p, i) );
+        // duplicate the node
+        Cec3_ManSweepDupNode( pMan, pObj );
+        if ( pRepr == NULL || !~pRepr->Value )
+            continue;
+        if ( Abc_Lit2Var(pObj->Value) == Abc_Lit2Var(pRepr->Value) )
+        {
+            assert( (pObj->Value ^ pRepr->Value) == (pObj->fPhase ^ pRepr->fPhase) );
+            Gia_ObjSetProved( p, i );
+            continue;
+        }
+        pObj->fMark1 = 1;
+        Vec_IntPush( pMan->vBatch, i );
+        if ( Vec_IntSize(pMan->vBatch) == nBatchMax )
+            fDisproved |= Cec3_ManSweepBatch( pMan );
+    }
+    fDisproved |= Cec3_ManSweepBatch( pMan );
+    return fDisproved;
+}
+
+#endif // pthreads are used
+
 void Cec3_ManPrintStats( Gia_Man_t * p, Cec3_Par_t * pPars, Cec3_Man_t * pMan )
 {
     if ( !pPars->fVerbose )
@@ -914,7 +1203,7 @@ void Cec3_ManPrintStats( Gia_Man_t * p, Cec3_Par_t * pPars, Cec3_Man_t * pMan )
 int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppNew )
 {
     Cec3_Man_t * pMan = Cec3_ManCreate( p, pPars ); 
-    Gia_Obj_t * pObj, * pRepr, * pObjNew; 
+    Gia_Obj_t * pObj, * pRepr; 
     int i, Iter, fDisproved = 1;
 
     // check if any output trivially fails under all-0 pattern
@@ -950,12 +1239,16 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
     }
     // perform sweeping
     //pMan = Cec3_ManCreate( p, pPars );
+    Cec3_ManStartThreads( pMan );
     for ( Iter = 0; fDisproved && Iter < pPars->nItersMax; Iter++ )
     {
         fDisproved = 0;
         pMan->nPatterns = 0;
         Cec3_ManSimulateCis( p );
         Vec_IntClear( pMan->vCexTriples );
+        if ( pMan->nThreads > 0 )
+            fDisproved = Cec3_ManSweepPar( pMan );
+        else
         Gia_ManForEachAnd( p, pObj, i )
         {
             if ( ~pObj->Value || Gia_ObjFailed(p, i) ) // skip swept nodes and failed nodes
@@ -964,15 +1257,7 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
                 continue;
             assert( !Gia_ObjProved(p, i) && !Gia_ObjFailed(p, i) );
             // duplicate the node
-            pObj->Value = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
-            if ( Vec_IntSize(&pMan->pNew->vCopies2) == Abc_Lit2Var(pObj->Value) )
-            {
-                pObjNew = Gia_ManObj( pMan->pNew, Abc_Lit2Var(pObj->Value) );
-                pObjNew->fMark0 = Gia_ObjIsMuxType( pObjNew );
-                Gia_ObjSetPhase( pMan->pNew, pObjNew );
-                Vec_IntPush( &pMan->pNew->vCopies2, -1 );
-            }
-            assert( Vec_IntSize(&pMan->pNew->vCopies2) == Gia_ManObjNum(pMan->pNew) );
+            Cec3_ManSweepDupNode( pMan, pObj );
             pRepr = Gia_ObjReprObj( p, i );
             if ( pRepr == NULL || !~pRepr->Value )
                 continue;
@@ -1002,6 +1287,7 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
         }
         Cec3_ManPrintStats( p, pPars, pMan );
     }
+    Cec3_ManStopThreads( pMan );
     // finish the AIG, if it is not finished
     if ( ppNew )
     {
@@ -1031,6 +1317,7 @@ Gia_Man_t * Cec3_ManSimulateTest( Gia_Man_t * p, Cec_ParFra_t * pPars0 )
 //    pPars->nItersMax  = pPars0->nItersMax;  // max number of iterations
     pPars->nConfLimit = pPars0->nBTLimit;   // conflict limit at a node
     pPars->fUseCones  = pPars0->fUseCones;
+    pPars->nProcs     = pPars0->nProcs;
     pPars->fVerbose   = pPars0->fVerbose;
 //    Gia_ManComputeGiaEquivs( p, 100000, 0 );
 //    Gia_ManEquivPrintClasses( p, 1, 0 );
@@ -1039,6 +1326,48 @@ Gia_Man_t * Cec3_ManSimulateTest( Gia_Man_t * p, Cec_ParFra_t * pPars0 )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes proved equivalences of the choice miter.]
+
+  Description [Performs SAT sweeping of the miter of synthesis snapshots
+  using word-parallel simulation and, if several processes are requested,
+  a pool of threads with their own SAT solvers. The candidate equivalences,
+  which were disproved or remained unresolved, are removed, so that only
+  the proved ones are left in the equivalence classes. The registers are
+  treated as primary inputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec3_ManComputeChoiceEquivs( Gia_Man_t * p, int nWords, int nConfLimit, int nProcs, int fVerbose )
+{
+    Cec3_Par_t Pars, * pPars = &Pars;
+    int i, nRegs = Gia_ManRegNum(p), nRemoved = 0;
+    Cec3_SetDefaultParams( pPars );
+    pPars->nSimWords  = nWords;
+    pPars->nConfLimit = nConfLimit;
+    pPars->nProcs     = nProcs;
+    pPars->fVerbose   = fVerbose;
+    p->nRegs = 0;
+    Cec3_ManPerformSweeping( p, pPars, NULL );
+    p->nRegs = nRegs;
+    p->pData = NULL;
+    // keep only the proved equivalences
+    for ( i = 1; i < Gia_ManObjNum(p); i++ )
+        if ( Gia_ObjRepr(p, i) != GIA_VOID && !Gia_ObjProved(p, i) )
+        {
+            Gia_ObjSetRepr( p, i, GIA_VOID );
+            nRemoved++;
+        }
+    ABC_FREE( p->pNexts );
+    p->pNexts = Gia_ManDeriveNexts( p );
+    if ( fVerbose )
+        printf( "Removed %d unproved candidate equivalences.\n", nRemoved );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
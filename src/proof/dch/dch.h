@@ -46,6 +46,7 @@ struct Dch_Pars_t_
     int              nWords;        // the number of simulation words
     int              nBTLimit;      // conflict limit at a node
     int              nSatVarMax;    // the max number of SAT variables
+    int              nThreads;      // the number of threads
     int              fSynthesis;    // set to 1 to perform synthesis
     int              fPolarFlip;    // uses polarity adjustment
     int              fSimulateTfo;  // uses simulation of TFO classes
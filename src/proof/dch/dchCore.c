@@ -48,6 +48,7 @@ void Dch_ManSetDefaultParams( Dch_Pars_t * p )
     p->nWords         =     8;  // the number of simulation words
     p->nBTLimit       =  1000;  // conflict limit at a node
     p->nSatVarMax     =  5000;  // the max number of SAT variables
+    p->nThreads       =     1;  // the number of threads
     p->fSynthesis     =     1;  // derives three snapshots
     p->fPolarFlip     =     1;  // uses polarity adjustment
     p->fSimulateTfo   =     1;  // simulate TFO
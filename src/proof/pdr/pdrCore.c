@@ -59,6 +59,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nProcs         =       1;  // the number of portfolio workers
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -194,6 +195,8 @@ int Pdr_ManPushClauses( Pdr_Man_t * p )
 
             // if it can be moved, add it to the next frame
             Pdr_ManSolverAddClause( p, k+1, pCubeK );
+            if ( p->pPool )
+                Pdr_ManExportLemma( p, k+1, pCubeK );
             // check if the clause subsumes others
             Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK1, pCubeK1, i )
             {
@@ -433,6 +436,8 @@ int ZPdr_ManDown( Pdr_Man_t * p, int k, Pdr_Set_t ** ppCube, Pdr_Set_t * pPred,
             // add clause
             for ( i = 1; i <= l; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
+            if ( p->pPool )
+                Pdr_ManExportLemma( p, l, pCubeMin );
             Pdr_SetDeref( pPred );
             RetValue = Pdr_ManCheckCube( p, k, *ppCube, &pPred, p->pPars->nConfLimit, 0, 1 );
             assert( RetValue >= 0 );
@@ -991,6 +996,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
+            if ( p->pPool )
+                Pdr_ManExportLemma( p, k, pCubeMin );
             // schedule proof obligation
             if ( (k < kMax || p->pPars->fReuseProofOblig) && !p->pPars->fShortest )
             {
@@ -1142,6 +1149,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                     p->pPars->iFrame = iFrame;
                     return -1;
                 }
+                if ( p->pPool )
+                    Pdr_ManImportLemmas( p );
                 RetValue = Pdr_ManCheckCube( p, iFrame, NULL, &pCube, p->pPars->nConfLimit, 0, 1 );
                 if ( RetValue == 1 )
                     break;
@@ -1287,6 +1296,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Pdr_ManPrintClauses( p, 0 );
         }
         // push clauses into this timeframe
+        if ( p->pPool )
+            Pdr_ManImportLemmas( p );
         RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
         {
@@ -1413,6 +1424,12 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
+    if ( pPars->nProcs > 1 && !pPars->fSolveAll && !pPars->fUseAbs && !pPars->fUseBridge )
+    {
+        RetValue = Pdr_ManSolvePar( pAig, pPars );
+        if ( RetValue != -2 ) // the portfolio was used
+            return RetValue;
+    }
     p = Pdr_ManStart( pAig, pPars, NULL );
     RetValue = Pdr_ManSolveInt( p );
     if ( RetValue == 0 )
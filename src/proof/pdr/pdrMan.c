@@ -20,6 +20,7 @@
 
 #include "pdrInt.h"
 #include "sat/bmc/bmc.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -322,6 +323,23 @@ void Pdr_ManStop( Pdr_Man_t * p )
     int i, k;
     Gia_ManStopP( &p->pGia );
     Aig_ManCleanMarkAB( p->pAig );
+    if ( Util_ProfIsEnabled() )
+    {
+        Util_ProfTimeAdd( "pdr.sat",      p->tSat );
+        Util_ProfTimeAdd( "pdr.unsat",    p->tSatUnsat );
+        Util_ProfTimeAdd( "pdr.satsat",   p->tSatSat );
+        Util_ProfTimeAdd( "pdr.general",  p->tGeneral );
+        Util_ProfTimeAdd( "pdr.push",     p->tPush );
+        Util_ProfTimeAdd( "pdr.ternary",  p->tTsim );
+        Util_ProfTimeAdd( "pdr.contain",  p->tContain );
+        Util_ProfTimeAdd( "pdr.cnf",      p->tCnf );
+        Util_ProfTimeAdd( "pdr.total",    p->tTotal );
+        Util_ProfCountAdd( "pdr.blocks",  p->nBlocks );
+        Util_ProfCountAdd( "pdr.obligs",  p->nObligs );
+        Util_ProfCountAdd( "pdr.clauses", p->nCubes );
+        Util_ProfCountAdd( "pdr.calls",   p->nCalls );
+        Util_ProfCountAdd( "pdr.starts",  p->nStarts );
+    }
     if ( p->pPars->fVerbose ) 
     {
         Abc_Print( 1, "Block =%5d  Oblig =%6d  Clause =%6d  Call =%6d (sat=%.1f%%)  Cex =%4d  Start =%4d\n", 
@@ -0,0 +1,364 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-threaded portfolio with lemma sharing.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 20, 2010.]
+
+  Revision    [$Id: pdrPth.c,v 1.00 2010/11/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "base/main/main.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+void Pdr_ManExportLemma( Pdr_Man_t * p, int k, Pdr_Set_t * pCube ) {}
+void Pdr_ManImportLemmas( Pdr_Man_t * p )                          {}
+int  Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )        { return -2; }
+
+#else // pthreads are used
+
+#define PAR_THR_MAX 100
+#define PAR_IMP_CONF 1000    // conflict limit when checking an imported lemma
+
+// lemma pool shared by the workers
+struct Pdr_Pool_t_
+{
+    pthread_mutex_t mutex;       // protects the lemma storage
+    Vec_Int_t *     vLemmas;     // lemmas as (iWorker, k, nLits, Lit0, Lit1, ...)
+    volatile int    fStop;       // set when one of the workers is done
+    int             iWinner;     // the worker who solved the problem
+    int             RunId;       // the user's run ID
+    int(*pFuncStop)(int);        // the user's callback to terminate
+};
+
+// information given to the thread
+typedef struct Pdr_ThData_t_
+{
+    Pdr_Man_t *     pMan;        // the worker's manager
+    Aig_Man_t *     pAig;        // the worker's copy of the AIG
+    Pdr_Par_t       Pars;        // the worker's parameters
+    int             RetValue;    // the worker's result
+    abctime         clkUsed;     // the worker's runtime
+} Pdr_ThData_t;
+
+// the portfolio currently running
+static Pdr_Pool_t * s_pPdrPool = NULL;
+static pthread_mutex_t s_PdrMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// call back procedure for the workers
+int Pdr_ManCallBackToStop( int RunId )
+{
+    Pdr_Pool_t * pPool = s_pPdrPool;
+    if ( pPool == NULL )
+        return 0;
+    if ( pPool->fStop )
+        return 1;
+    return pPool->pFuncStop && pPool->pFuncStop(pPool->RunId);
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the lemma derived by the worker to the pool.]
+
+  Description [The lemma states that pCube is unreachable in k or
+  fewer steps from the initial state.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManExportLemma( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Pool_t * pPool = p->pPool;
+    int i, status;
+    if ( pPool->fStop )
+        return;
+    status = pthread_mutex_lock(&pPool->mutex);  assert( status == 0 );
+    Vec_IntPush( pPool->vLemmas, p->iWorker );
+    Vec_IntPush( pPool->vLemmas, k );
+    Vec_IntPush( pPool->vLemmas, pCube->nLits );
+    for ( i = 0; i < pCube->nLits; i++ )
+        Vec_IntPush( pPool->vLemmas, pCube->Lits[i] );
+    status = pthread_mutex_unlock(&pPool->mutex);  assert( status == 0 );
+    p->nLemmasOut++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the lemmas derived by other workers to this manager.]
+
+  Description [Each lemma is added at the highest frame, not exceeding
+  the current last frame, where it is inductive relative to the previous
+  frame of this manager. Other workers run with different settings, so
+  their frames differ, and the check is needed to preserve soundness.
+  Lemmas already subsumed by the clauses of this manager are skipped,
+  and so are the lemmas whose check exceeds a small conflict limit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManImportLemmas( Pdr_Man_t * p )
+{
+    Pdr_Pool_t * pPool = p->pPool;
+    Pdr_Set_t * pCube;
+    Vec_Int_t * vNew, * vPiLits;
+    int i, k, l, iWorker, nLits, status, RetValue;
+    int kMax = Vec_PtrSize(p->vSolvers) - 1;
+    int nConfLimit = p->pPars->nConfLimit ? Abc_MinInt(p->pPars->nConfLimit, PAR_IMP_CONF) : PAR_IMP_CONF;
+    if ( pPool->fStop || kMax < 1 )
+        return;
+    // copy new lemmas while holding the lock
+    status = pthread_mutex_lock(&pPool->mutex);  assert( status == 0 );
+    if ( p->iPoolNext == Vec_IntSize(pPool->vLemmas) )
+    {
+        status = pthread_mutex_unlock(&pPool->mutex);  assert( status == 0 );
+        return;
+    }
+    vNew = Vec_IntAllocArrayCopy( Vec_IntArray(pPool->vLemmas) + p->iPoolNext, Vec_IntSize(pPool->vLemmas) - p->iPoolNext );
+    p->iPoolNext = Vec_IntSize(pPool->vLemmas);
+    status = pthread_mutex_unlock(&pPool->mutex);  assert( status == 0 );
+    // add them to this manager
+    vPiLits = Vec_IntAlloc( 0 );
+    for ( i = 0; i < Vec_IntSize(vNew); i += 3 + nLits )
+    {
+        iWorker = Vec_IntEntry( vNew, i );
+        k       = Vec_IntEntry( vNew, i+1 );
+        nLits   = Vec_IntEntry( vNew, i+2 );
+        if ( iWorker == p->iWorker || pPool->fStop )
+            continue;
+        l = Abc_MinInt( k, kMax );
+        if ( l < 1 )
+            continue;
+        Vec_IntClear( p->vLits );
+        Vec_IntPushArray( p->vLits, Vec_IntArray(vNew) + i + 3, nLits );
+        pCube = Pdr_SetCreate( p->vLits, vPiLits );
+        if ( Pdr_SetIsInit(pCube, -1) || Pdr_ManCheckContainment(p, l, pCube) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        RetValue = Pdr_ManCheckCube( p, l-1, pCube, NULL, nConfLimit, 0, 1 );
+        if ( RetValue != 1 ) // not inductive or undecided within the limit
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        Vec_VecPush( p->vClauses, l, pCube );   // consume ref
+        p->nCubes++;
+        for ( k = 1; k <= l; k++ )
+            Pdr_ManSolverAddClause( p, k, pCube );
+        p->iUseFrame = Abc_MinInt( p->iUseFrame, l );
+        p->nLemmasIn++;
+    }
+    Vec_IntFree( vPiLits );
+    Vec_IntFree( vNew );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ManWorkerThread( void * pArg )
+{
+    Pdr_ThData_t * pThData = (Pdr_ThData_t *)pArg;
+    Pdr_Pool_t * pPool = pThData->pMan->pPool;
+    abctime clk = Abc_Clock();
+    int status;
+    pThData->RetValue = Pdr_ManSolveInt( pThData->pMan );
+    pThData->clkUsed  = Abc_Clock() - clk;
+    if ( pThData->RetValue != -1 )
+    {
+        status = pthread_mutex_lock(&pPool->mutex);  assert( status == 0 );
+        if ( pPool->iWinner == -1 )
+        {
+            pPool->iWinner = pThData->pMan->iWorker;
+            pPool->fStop = 1;
+        }
+        status = pthread_mutex_unlock(&pPool->mutex);  assert( status == 0 );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using a portfolio of PDR workers.]
+
+  Description [The workers run with different settings on their own
+  copies of the AIG and exchange the lemmas through the shared pool.
+  The first worker to prove or disprove the property stops the others.
+  Returns -2 if the portfolio could not be started.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Pdr_ThData_t * pThData;
+    Pdr_Pool_t Pool, * pPool = &Pool;
+    Pdr_Man_t * p;
+    int nProcs = Abc_MinInt( pPars->nProcs, PAR_THR_MAX );
+    int i, status, RetValue = -1, iFrameMax = -1;
+    abctime clk = Abc_Clock();
+    assert( nProcs > 1 );
+    assert( !pPars->fSolveAll && !pPars->fUseAbs && !pPars->fUseBridge );
+    // only one portfolio can run at a time
+    status = pthread_mutex_lock(&s_PdrMutex);  assert( status == 0 );
+    if ( s_pPdrPool != NULL )
+    {
+        status = pthread_mutex_unlock(&s_PdrMutex);  assert( status == 0 );
+        return -2;
+    }
+    s_pPdrPool = pPool;
+    status = pthread_mutex_unlock(&s_PdrMutex);  assert( status == 0 );
+    // start the pool
+    status = pthread_mutex_init(&pPool->mutex, NULL);  assert( status == 0 );
+    pPool->vLemmas   = Vec_IntAlloc( 1000 );
+    pPool->fStop     = 0;
+    pPool->iWinner   = -1;
+    pPool->RunId     = pPars->RunId;
+    pPool->pFuncStop = pPars->pFuncStop;
+    // start the workers with different settings
+    pThData = ABC_CALLOC( Pdr_ThData_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].pAig = Aig_ManDupSimple( pAig );
+        pThData[i].Pars = *pPars;
+        pThData[i].Pars.nProcs       = 1;
+        pThData[i].Pars.RunId        = i;
+        pThData[i].Pars.pFuncStop    = Pdr_ManCallBackToStop;
+        pThData[i].Pars.nRandomSeed += i;
+        if ( i & 1 )
+            pThData[i].Pars.fTwoRounds ^= 1;
+        if ( i & 2 )
+            pThData[i].Pars.fMonoCnf ^= 1;
+        if ( i & 4 )
+            pThData[i].Pars.fFlopOrder ^= 1;
+        if ( i > 0 )
+        {
+            pThData[i].Pars.fSilent      = 1;
+            pThData[i].Pars.fVerbose     = 0;
+            pThData[i].Pars.fVeryVerbose = 0;
+            pThData[i].Pars.fNotVerbose  = 1;
+        }
+        pThData[i].pMan = Pdr_ManStart( pThData[i].pAig, &pThData[i].Pars, NULL );
+        pThData[i].pMan->pPool   = pPool;
+        pThData[i].pMan->iWorker = i;
+        pThData[i].RetValue = -1;
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Pdr_ManWorkerThread, (void *)(pThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        iFrameMax = Abc_MaxInt( iFrameMax, pThData[i].Pars.iFrame );
+    }
+    // report the results
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nProcs; i++ )
+        {
+            Abc_Print( 1, "Worker %2d : %-10s  Frame = %4d.  Lemmas out = %7d.  in = %7d.  ", i,
+                pThData[i].RetValue == 1 ? "proved" : pThData[i].RetValue == 0 ? "disproved" : "undecided",
+                pThData[i].Pars.iFrame, pThData[i].pMan->nLemmasOut, pThData[i].pMan->nLemmasIn );
+            Abc_PrintTime( 1, "Time", pThData[i].clkUsed );
+        }
+    }
+    // transfer the results of the winner
+    p = pThData[pPool->iWinner == -1 ? 0 : pPool->iWinner].pMan;
+    if ( pPool->iWinner != -1 )
+    {
+        RetValue = pThData[pPool->iWinner].RetValue;
+        if ( RetValue == 0 )
+        {
+            assert( p->pAig->pSeqModel != NULL );
+            pAig->pSeqModel = p->pAig->pSeqModel;
+            p->pAig->pSeqModel = NULL;
+        }
+        pPars->nFailOuts = p->pPars->nFailOuts;
+    }
+    if ( pPars->fDumpInv )
+    {
+        char * pFileName = pPars->pInvFileName ? pPars->pInvFileName : Extra_FileNameGenericAppend(pAig->pName, "_inv.pla");
+        Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
+        Pdr_ManDumpClauses( p, pFileName, RetValue==1 );
+        printf( "Dumped inductive invariant in file \"%s\".\n", pFileName );
+    }
+    else if ( RetValue == 1 )
+        Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
+    pPars->iFrame = (pPool->iWinner == -1 ? iFrameMax : p->pPars->iFrame) - 1;
+    // stop the workers
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].pMan->tTotal += Abc_Clock() - clk;
+        Pdr_ManStop( pThData[i].pMan );
+        Aig_ManStop( pThData[i].pAig );
+    }
+    ABC_FREE( pThData );
+    Vec_IntFree( pPool->vLemmas );
+    status = pthread_mutex_destroy(&pPool->mutex);  assert( status == 0 );
+    status = pthread_mutex_lock(&s_PdrMutex);  assert( status == 0 );
+    s_pPdrPool = NULL;
+    status = pthread_mutex_unlock(&s_PdrMutex);  assert( status == 0 );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
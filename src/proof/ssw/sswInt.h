@@ -251,6 +251,8 @@ extern int           Ssw_ManSweepLatch( Ssw_Man_t * p );
 extern Ssw_Man_t *   Ssw_ManCreate( Aig_Man_t * pAig, Ssw_Pars_t * pPars );
 extern void          Ssw_ManCleanup( Ssw_Man_t * p );
 extern void          Ssw_ManStop( Ssw_Man_t * p );
+/*=== sswPth.c ===================================================*/
+extern Aig_Man_t *   Ssw_SignalCorrespondencePth( Aig_Man_t * pAig, Ssw_Pars_t * pPars, Vec_Ptr_t * vParts, int fVerbose );
 /*=== sswSat.c ===================================================*/
 extern int           Ssw_NodesAreEquiv( Ssw_Man_t * p, Aig_Obj_t * pOld, Aig_Obj_t * pNew );
 extern int           Ssw_NodesAreConstrained( Ssw_Man_t * p, Aig_Obj_t * pOld, Aig_Obj_t * pNew );
@@ -95,6 +95,19 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
         }
     }
 
+    // perform SSW with partitions using several threads
+    if ( pPars->nProcs > 1 && (pNew = Ssw_SignalCorrespondencePth( pAig, pPars, vResult, fVerbose )) )
+    {
+        Vec_VecFree( (Vec_Vec_t *)vResult );
+        pPars->nPartSize = nPartSize;
+        pPars->fVerbose = fVerbose;
+        if ( fVerbose )
+        {
+            ABC_PRT( "Total time", Abc_Clock() - clk );
+        }
+        return pNew;
+    }
+
     // perform SSW with partitions
     Aig_ManReprStart( pAig, Aig_ManObjNumMax(pAig) );
     Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
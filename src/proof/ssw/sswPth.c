@@ -0,0 +1,416 @@
+/**CFile****************************************************************
+
+  FileName    [sswPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Inductive prover with constraints.]
+
+  Synopsis    [Multi-threaded partitioned signal correspondence.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - September 1, 2008.]
+
+  Revision    [$Id: sswPth.c,v 1.00 2008/09/01 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "sswInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+Aig_Man_t * Ssw_SignalCorrespondencePth( Aig_Man_t * pAig, Ssw_Pars_t * pPars, Vec_Ptr_t * vParts, int fVerbose ) { return NULL; }
+
+#else // pthreads are used
+
+#define PAR_THR_MAX 100
+
+typedef struct Ssw_ThData_t_
+{
+    Ssw_Pars_t     Pars;        // thread-private copy of the parameters
+    Aig_Man_t *    pPart;       // the partition to process
+    int            iPart;       // the partition number (or -1 if none is assigned)
+    int            nIters;      // the number of iterations performed for the last partition
+    int            nParts;      // the number of partitions processed
+    int            fWorking;    // the thread is busy
+    abctime        clkUsed;     // runtime of the thread
+} Ssw_ThData_t;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes signal correspondence of one partition.]
+
+  Description [The equivalences are recorded in the partition AIG.
+  The random simulation patterns come from the thread-local state of 
+  Aig_ManRandom(), which Ssw_SignalCorrespondence() resets, so the 
+  result for a partition does not depend on the thread processing it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Ssw_WorkerThread( void * pArg )
+{
+    Ssw_ThData_t * pThData = (Ssw_ThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    Aig_Man_t * pNew;
+    abctime clk;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->pPart == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        clk = Abc_Clock();
+        pNew = Ssw_SignalCorrespondence( pThData->pPart, &pThData->Pars );
+        if ( pNew )
+            Aig_ManStop( pNew );
+        pThData->nIters = pThData->Pars.nIters;
+        pThData->nParts++;
+        pThData->clkUsed += Abc_Clock() - clk;
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the registers affected by the merged equivalences.]
+
+  Description [A register is affected if it was merged, if another object
+  was merged into it, or if its next-state function depends on a merged
+  object. The partitions without affected registers are not processed
+  again, because their logic did not change.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Str_t * Ssw_ManMarkChangedRegs( Aig_Man_t * p )
+{
+    Vec_Str_t * vChanged, * vRegs;
+    Aig_Obj_t * pObj, * pRepr;
+    int i;
+    vChanged = Vec_StrStart( Aig_ManObjNumMax(p) );
+    vRegs    = Vec_StrStart( Aig_ManRegNum(p) );
+    // the object IDs are topologically ordered
+    Aig_ManForEachObj( p, pObj, i )
+    {
+        if ( (pRepr = Aig_ObjRepr(p, pObj)) )
+        {
+            Vec_StrWriteEntry( vChanged, i, 1 );
+            if ( Saig_ObjIsLo(p, pRepr) )
+                Vec_StrWriteEntry( vRegs, Aig_ObjCioId(pRepr) - Saig_ManPiNum(p), 1 );
+        }
+        else if ( Aig_ObjIsNode(pObj) )
+            Vec_StrWriteEntry( vChanged, i, (char)(Vec_StrEntry(vChanged, Aig_ObjFaninId0(pObj)) | Vec_StrEntry(vChanged, Aig_ObjFaninId1(pObj))) );
+    }
+    Saig_ManForEachLo( p, pObj, i )
+        if ( Vec_StrEntry(vChanged, Aig_ObjId(pObj)) || Vec_StrEntry(vChanged, Aig_ObjFaninId0(Saig_ManLi(p, i))) )
+            Vec_StrWriteEntry( vRegs, i, 1 );
+    Vec_StrFree( vChanged );
+    return vRegs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the registers of the reduced AIG.]
+
+  Description [Should be called after Aig_ManDupRepr() and before
+  Aig_ManSeqCleanup(). For each register of the old AIG, saves the ID
+  of the register of the new AIG it was merged into, or -1 if it was
+  merged into a constant or an internal node.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ssw_ManRecordRegs( Aig_Man_t * p, Vec_Int_t * vRegIds )
+{
+    Aig_Obj_t * pObj, * pRepr, * pObjNew;
+    int i;
+    Vec_IntClear( vRegIds );
+    Saig_ManForEachLo( p, pObj, i )
+    {
+        pRepr = Aig_ObjRepr( p, pObj );
+        pObjNew = Aig_Regular( (Aig_Obj_t *)(pRepr ? pRepr : pObj)->pData );
+        Vec_IntPush( vRegIds, Aig_ObjIsCi(pObjNew) ? Aig_ObjId(pObjNew) : -1 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the partitions into the reduced AIG.]
+
+  Description [Takes the AIG with equivalences and its reduced version
+  derived by Aig_ManDupRepr() and Aig_ManSeqCleanup(). Each register of
+  a partition is replaced by the register it was merged into. The registers
+  that were merged into constants or internal nodes, or removed by the
+  cleanup, are dropped. Returns the array of flags marking the partitions
+  to be processed again.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Ssw_ManRemapParts( Aig_Man_t * p, Aig_Man_t * pNew, Vec_Int_t * vRegIds, Vec_Ptr_t * vParts )
+{
+    Vec_Int_t * vMap, * vDirty, * vPart;
+    Vec_Str_t * vRegs;
+    Aig_Obj_t * pObj;
+    int i, k, iReg, iObj, fDirty;
+    // find the register of the new AIG for each register of the old AIG
+    vMap = Vec_IntStartFull( Aig_ManObjNumMax(pNew) );
+    Saig_ManForEachLo( pNew, pObj, i )
+        Vec_IntWriteEntry( vMap, Aig_ObjId(pObj), i );
+    Vec_IntForEachEntry( vRegIds, iObj, i )
+        Vec_IntWriteEntry( vRegIds, i, iObj >= 0 ? Vec_IntEntry(vMap, iObj) : -1 );
+    Vec_IntFree( vMap );
+    // remap the partitions
+    vRegs = Ssw_ManMarkChangedRegs( p );
+    vDirty = Vec_IntAlloc( Vec_PtrSize(vParts) );
+    Vec_PtrForEachEntry( Vec_Int_t *, vParts, vPart, i )
+    {
+        fDirty = 0;
+        Vec_IntForEachEntry( vPart, iReg, k )
+        {
+            fDirty |= Vec_StrEntry( vRegs, iReg );
+            Vec_IntWriteEntry( vPart, k, Vec_IntEntry(vRegIds, iReg) );
+        }
+        Vec_IntSort( vPart, 0 );
+        Vec_IntUniqify( vPart );
+        if ( Vec_IntSize(vPart) > 0 && Vec_IntEntry(vPart, 0) == -1 )
+            Vec_IntDrop( vPart, 0 );
+        Vec_IntPush( vDirty, fDirty && Vec_IntSize(vPart) > 0 );
+    }
+    Vec_StrFree( vRegs );
+    return vDirty;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs partitioned signal correspondence using several threads.]
+
+  Description [The partitions are derived by the main thread and given
+  to the first idle thread. The equivalences proved in the partitions are
+  transferred to the AIG in the order of partitions, as soon as all the
+  previous partitions are finished, so the result does not depend on the
+  order in which the threads finish. After all partitions are processed,
+  the AIG is reduced using the equivalences and the partitions, whose
+  logic was changed by the reduction, are processed again, until no
+  more equivalences are found.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Ssw_SignalCorrespondencePth( Aig_Man_t * pAig, Ssw_Pars_t * pPars, Vec_Ptr_t * vParts, int fVerbose )
+{
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Ssw_ThData_t ThData[PAR_THR_MAX];
+    Aig_Man_t ** ppParts, * pCur, * pNew;
+    Vec_Int_t * vDirty, * vPart, * vRegIds;
+    Vec_Int_t * vCountPis, * vCountRegs, * vIters;
+    int ** ppMapBacks;
+    int nThreads = Abc_MinInt( pPars->nProcs, PAR_THR_MAX );
+    int t, status, iNext, iDone, nCountPis, nCountRegs;
+    int nClasses, nClassesAll, nSizeOld, Round;
+    abctime clk;
+    // start the threads
+    for ( t = 0; t < nThreads; t++ )
+    {
+        ThData[t].Pars     = *pPars;
+        ThData[t].Pars.fVerbose = 0;
+        ThData[t].Pars.nProcs   = 1;
+        ThData[t].pPart    = NULL;
+        ThData[t].iPart    = -1;
+        ThData[t].nParts   = 0;
+        ThData[t].fWorking = 0;
+        ThData[t].clkUsed  = 0;
+        status = pthread_create( WorkerThread + t, NULL, Ssw_WorkerThread, (void *)(ThData + t) );  assert( status == 0 );
+    }
+    ppParts    = ABC_CALLOC( Aig_Man_t *, Vec_PtrSize(vParts) );
+    ppMapBacks = ABC_CALLOC( int *, Vec_PtrSize(vParts) );
+    vCountPis  = Vec_IntStart( Vec_PtrSize(vParts) );
+    vCountRegs = Vec_IntStart( Vec_PtrSize(vParts) );
+    vIters     = Vec_IntStart( Vec_PtrSize(vParts) );
+    vDirty     = Vec_IntAlloc( 0 );
+    Vec_IntFill( vDirty, Vec_PtrSize(vParts), 1 );
+    vRegIds    = Vec_IntAlloc( 0 );
+    // iterate until the fixed point is reached
+    pCur = pAig;
+    for ( Round = 0; ; Round++ )
+    {
+        clk = Abc_Clock();
+        Aig_ManReprStart( pCur, Aig_ManObjNumMax(pCur) );
+        iDone = 0;
+        nClassesAll = 0;
+        for ( iNext = 0; iNext < Vec_PtrSize(vParts) || iDone < Vec_PtrSize(vParts); )
+        {
+            // assign the next partition to the first idle thread
+            if ( iNext < Vec_PtrSize(vParts) )
+            {
+                vPart = (Vec_Int_t *)Vec_PtrEntry( vParts, iNext );
+                if ( !Vec_IntEntry(vDirty, iNext) )
+                {
+                    iNext++;
+                    continue;
+                }
+                for ( t = 0; t < nThreads; t++ )
+                    if ( !*(volatile int *)&ThData[t].fWorking && ThData[t].iPart == -1 )
+                        break;
+                if ( t < nThreads )
+                {
+                    ppParts[iNext] = Aig_ManRegCreatePart( pCur, vPart, &nCountPis, &nCountRegs, ppMapBacks + iNext );
+                    Aig_ManSetRegNum( ppParts[iNext], ppParts[iNext]->nRegs );
+                    // create the projection of 1-hot registers
+                    if ( pCur->vOnehots )
+                        ppParts[iNext]->vOnehots = Aig_ManRegProjectOnehots( pCur, ppParts[iNext], pCur->vOnehots, fVerbose );
+                    Vec_IntWriteEntry( vCountPis,  iNext, nCountPis );
+                    Vec_IntWriteEntry( vCountRegs, iNext, nCountRegs );
+                    if ( nCountPis > 0 )
+                    {
+                        ThData[t].pPart = ppParts[iNext];
+                        ThData[t].iPart = iNext;
+                        ThData[t].fWorking = 1;
+                    }
+                    iNext++;
+                    continue;
+                }
+            }
+            // collect the results of the finished threads
+            for ( t = 0; t < nThreads; t++ )
+                if ( !*(volatile int *)&ThData[t].fWorking && ThData[t].iPart >= 0 )
+                {
+                    Vec_IntWriteEntry( vIters, ThData[t].iPart, ThData[t].nIters );
+                    ThData[t].pPart = NULL;
+                    ThData[t].iPart = -1;
+                }
+            // transfer the equivalences in the order of partitions
+            for ( ; iDone < iNext; iDone++ )
+            {
+                if ( !Vec_IntEntry(vDirty, iDone) )
+                    continue;
+                for ( t = 0; t < nThreads; t++ )
+                    if ( ThData[t].iPart == iDone )
+                        break;
+                if ( t < nThreads )
+                    break;
+                vPart = (Vec_Int_t *)Vec_PtrEntry( vParts, iDone );
+                if ( Vec_IntEntry(vCountPis, iDone) == 0 )
+                {
+                    Aig_ManStop( ppParts[iDone] );
+                    ppParts[iDone] = NULL;
+                    ABC_FREE( ppMapBacks[iDone] );
+                    continue;
+                }
+                nClasses = Aig_TransferMappedClasses( pCur, ppParts[iDone], ppMapBacks[iDone] );
+                nClassesAll += nClasses;
+                if ( fVerbose )
+                    Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
+                        iDone, Vec_IntSize(vPart), Aig_ManCiNum(ppParts[iDone])-Vec_IntSize(vPart), Vec_IntEntry(vCountPis, iDone), Vec_IntEntry(vCountRegs, iDone),
+                        Aig_ManNodeNum(ppParts[iDone]), Vec_IntEntry(vIters, iDone), nClasses );
+                Aig_ManStop( ppParts[iDone] );
+                ppParts[iDone] = NULL;
+                ABC_FREE( ppMapBacks[iDone] );
+            }
+        }
+        // reduce the AIG
+        nSizeOld = Aig_ManNodeNum(pCur) + Aig_ManRegNum(pCur);
+        pNew = Aig_ManDupRepr( pCur, 0 );
+        Ssw_ManRecordRegs( pCur, vRegIds );
+        Aig_ManSeqCleanup( pNew );
+        if ( fVerbose )
+        {
+            Abc_Print( 1, "Round %2d : Parts = %4d. Cl = %6d. Reg = %7d -> %7d. And = %8d -> %8d. ",
+                Round, Vec_IntCountPositive(vDirty), nClassesAll, Aig_ManRegNum(pCur), Aig_ManRegNum(pNew), Aig_ManNodeNum(pCur), Aig_ManNodeNum(pNew) );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        if ( nClassesAll == 0 || Aig_ManRegNum(pNew) == 0 || Aig_ManNodeNum(pNew) + Aig_ManRegNum(pNew) >= nSizeOld )
+        {
+            if ( pCur != pAig )
+                Aig_ManStop( pCur );
+            break;
+        }
+        // find the partitions to be processed again
+        Vec_IntFree( vDirty );
+        vDirty = Ssw_ManRemapParts( pCur, pNew, vRegIds, vParts );
+        if ( pCur != pAig )
+            Aig_ManStop( pCur );
+        pCur = pNew;
+        if ( Vec_IntCountPositive(vDirty) == 0 )
+            break;
+    }
+    // stop the threads
+    for ( t = 0; t < nThreads; t++ )
+    {
+        assert( !ThData[t].fWorking );
+        ThData[t].pPart = NULL;
+        ThData[t].fWorking = 1;
+    }
+    for ( t = 0; t < nThreads; t++ )
+    {
+        status = pthread_join( WorkerThread[t], NULL );  assert( status == 0 );
+    }
+    if ( fVerbose )
+    {
+        for ( t = 0; t < nThreads; t++ )
+        {
+            Abc_Print( 1, "Thread %2d : Partitions = %4d. ", t, ThData[t].nParts );
+            Abc_PrintTime( 1, "Time", ThData[t].clkUsed );
+        }
+    }
+    ABC_FREE( ppParts );
+    ABC_FREE( ppMapBacks );
+    Vec_IntFree( vCountPis );
+    Vec_IntFree( vCountRegs );
+    Vec_IntFree( vIters );
+    Vec_IntFree( vDirty );
+    Vec_IntFree( vRegIds );
+    return pNew;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
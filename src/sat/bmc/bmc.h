@@ -139,6 +139,8 @@ struct Bmc_AndPar_t_
     int         fUseOldCnf;     // use old CNF construction
     int         fUseGlucose;    // use Glucose 3.0 as the default solver
     int         fUseEliminate;  // use variable elimination
+    int         fPipeline;      // unfold the next frames while solving the current ones
+    int         fSolveAll;      // does not stop at the first SAT output
     int         fVerbose;       // verbose 
     int         fVeryVerbose;   // very verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
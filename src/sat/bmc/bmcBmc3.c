@@ -26,6 +26,7 @@
 #include "misc/vec/vecHsh.h"
 #include "misc/vec/vecWec.h"
 #include "bmc.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -1877,6 +1878,16 @@ finish:
         Abc_Print( 1, "UNDEC = %.1f sec (%.1f %%)",   1.0*nTimeUndec/CLOCKS_PER_SEC, 100.0*nTimeUndec/(Abc_Clock() - clkTotal) );
         Abc_Print( 1, "\n" );
     }
+    if ( Util_ProfIsEnabled() )
+    {
+        Util_ProfTimeAdd( "bmc3.cnf",   clkOther );
+        Util_ProfTimeAdd( "bmc3.unsat", nTimeUnsat );
+        Util_ProfTimeAdd( "bmc3.sat",   nTimeSat );
+        Util_ProfTimeAdd( "bmc3.undec", nTimeUndec );
+        Util_ProfTimeAdd( "bmc3.total", Abc_Clock() - clkTotal );
+        Util_ProfCountAdd( "bmc3.frames",    Abc_MaxInt(pPars->iFrame + 1, 0) );
+        Util_ProfCountAdd( "bmc3.conflicts", p->pSat ? (word)sat_solver_nconflicts(p->pSat) : 0 );
+    }
     Saig_Bmc3ManStop( p );
     fflush( stdout );
     if ( pLogFile )
@@ -364,6 +364,10 @@ int Gia_ManCountRanks( Gia_Man_t * p )
 ***********************************************************************/
 Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 {
+    // restart and garbage collection parameters of the solvers (cycled if there are more solvers)
+    static double pFRst[8] = { 0.80, 0.75, 0.70, 0.65, 0.85, 0.90, 0.60, 0.78 };
+    static double pBRst[8] = { 1.40, 1.35, 1.30, 1.25, 1.45, 1.50, 1.20, 1.38 };
+    static float  pGarb[8] = { 0.30f, 0.35f, 0.40f, 0.45f, 0.25f, 0.50f, 0.20f, 0.33f };
     Bmcs_Man_t * p = ABC_CALLOC( Bmcs_Man_t, 1 ); 
     int i, Lit = Abc_Var2Lit( 0, 1 );
     satoko_opts_t opts;
@@ -384,9 +388,9 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     for ( i = 0; i < pPars->nProcs; i++ )
     {
         // modify parameters to get different SAT solvers
-        opts.f_rst = 0.8 - i * 0.05;
-        opts.b_rst = 1.4 - i * 0.05;
-        opts.garbage_max_ratio = (float) 0.3 + i * 0.05;
+        opts.f_rst = pFRst[i % 8];
+        opts.b_rst = pBRst[i % 8];
+        opts.garbage_max_ratio = pGarb[i % 8];
         // create SAT solvers
         p->pSats[i] = bmc_sat_solver_start( i );  
 #ifdef ABC_USE_EXT_SOLVERS
@@ -726,6 +730,7 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 #ifndef ABC_USE_PTHREADS
 
 int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) { return Bmcs_ManPerformOne(pGia, pPars); }
+int Bmcs_ManPerformPipe( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )  { return Bmcs_ManPerformOne(pGia, pPars); }
 
 #else // pthreads are used
 
@@ -908,6 +913,461 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     return RetValue;
 }
 
+
+/**Function*************************************************************
+
+  Synopsis    [Pipelined BMC with work-stealing of the output queries.]
+
+  Description [The main thread unfolds the next group of timeframes and 
+  computes its CNF while the worker threads solve the outputs of the 
+  current group. Each worker owns a SAT solver and loads the CNFs of the 
+  groups lazily, when it takes its first query of a group, so a worker 
+  without queries does not load anything. The CNF of a group is freed 
+  after all workers have loaded it. The queries (output/frame pairs) of the group are 
+  split into contiguous ranges, one per worker. A worker, whose range is 
+  exhausted, steals the upper half of the largest remaining range. 
+  Without solve-all, a satisfiable query cancels the queries following 
+  it, while the queries preceding it are still solved, so the reported 
+  counter-example is the same as in the sequential run.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Bmcs_Job_t_ Bmcs_Job_t;
+struct Bmcs_Job_t_
+{
+    Cnf_Dat_t *       pCnf;                // CNF of the new timeframes (NULL if the outputs are trivial or all threads loaded it)
+    int               iJob;                // the job number among the jobs with CNF (-1 if the outputs are trivial)
+    int               nClauses;            // the number of clauses in the CNF
+    int               nLoaded;             // the number of threads, which loaded the CNF
+    int               f;                   // the first timeframe 
+    int               nFrames;             // the number of timeframes to solve
+    int               nVarsOld;            // the number of SAT variables before this job
+    int               nVars;               // the number of SAT variables after this job
+    Vec_Int_t *       vLits;               // output literals of the timeframes
+};
+
+typedef struct Bmcs_Pipe_t_ Bmcs_Pipe_t;
+typedef struct Bmcs_PipeThData_t_
+{
+    Bmcs_Pipe_t *     pPipe;               // the shared data
+    bmc_sat_solver *  pSat;                // the solver of this thread
+    int               iThread;             // the thread number
+    int               fWorking;            // the thread is busy
+    int               fStop;               // the solver stop flag
+    int               iQuery;              // the query being solved
+    int               nJobsLoaded;         // the number of jobs whose CNF is loaded by this thread
+    int               nSolved;             // the number of solved queries
+    int               nStolen;             // the number of stolen ranges
+    abctime           clkUsed;             // runtime of the thread
+} Bmcs_PipeThData_t;
+
+struct Bmcs_Pipe_t_
+{
+    Bmcs_Man_t *      pMan;                // BMC manager
+    Bmcs_Job_t *      pJob;                // the current job (NULL to stop)
+    Vec_Ptr_t *       vJobs;               // the jobs with CNF in the order of timeframes
+    Vec_Int_t *       vQueries;            // active queries of the job
+    int *             pStatus;             // the status of each query
+    Vec_Int_t **      ppModels;            // PIs of pFrames assigned to 1 by the satisfying assignments
+    int               pBeg[PAR_THR_MAX];   // the first unsolved query of each thread
+    int               pEnd[PAR_THR_MAX];   // the query after the last one of each thread
+    int               Limit;               // the first query, which is not UNSAT
+    int               fTimeout;            // the timeout is reached
+    int               nProcs;              // the number of threads
+    Bmcs_PipeThData_t * pThData;           // the thread data
+    pthread_mutex_t   mutex;               // protects the query ranges and results
+    pthread_mutex_t   mutexUnf;            // protects the unfolding
+};
+
+Bmcs_Job_t * Bmcs_ManPipeJobStart( Bmcs_Pipe_t * pPipe, int f )
+{
+    Bmcs_Man_t * p = pPipe->pMan;
+    Bmc_AndPar_t * pPars = p->pPars;
+    Bmcs_Job_t * pJob = ABC_CALLOC( Bmcs_Job_t, 1 );
+    int k, i, iObj, nPos = Gia_ManPoNum(p->pGia), status;
+    status = pthread_mutex_lock(&pPipe->mutexUnf);  assert( status == 0 );
+    pJob->pCnf     = Bmcs_ManAddNewCnf( p, f, pPars->nFramesAdd );
+    pJob->f        = f;
+    pJob->nFrames  = pPars->nFramesMax ? Abc_MinInt(pPars->nFramesAdd, pPars->nFramesMax - f) : pPars->nFramesAdd;
+    pJob->nVarsOld = p->nSatVarsOld;
+    pJob->nVars    = p->nSatVars;
+    pJob->vLits    = Vec_IntStart( pJob->nFrames * nPos );
+    if ( pJob->pCnf )
+        for ( k = 0; k < pJob->nFrames; k++ )
+        for ( i = 0; i < nPos; i++ )
+        {
+            iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, (f+k) * nPos + i) );
+            Vec_IntWriteEntry( pJob->vLits, k * nPos + i, Abc_Var2Lit(Vec_IntEntry(&p->vFr2Sat, iObj), 0) );
+        }
+    p->nSatVarsOld = p->nSatVars;
+    status = pthread_mutex_unlock(&pPipe->mutexUnf);  assert( status == 0 );
+    pJob->iJob = -1;
+    if ( pJob->pCnf )
+    {
+        pJob->nClauses = pJob->pCnf->nClauses;
+        status = pthread_mutex_lock(&pPipe->mutex);  assert( status == 0 );
+        pJob->iJob = Vec_PtrSize( pPipe->vJobs );
+        Vec_PtrPush( pPipe->vJobs, pJob );
+        status = pthread_mutex_unlock(&pPipe->mutex);  assert( status == 0 );
+    }
+    return pJob;
+}
+void Bmcs_ManPipeJobStop( Bmcs_Job_t * pJob )
+{
+    if ( pJob == NULL )
+        return;
+    if ( pJob->pCnf )
+        Cnf_DataFree( pJob->pCnf );
+    Vec_IntFreeP( &pJob->vLits );
+    ABC_FREE( pJob );
+}
+Vec_Int_t * Bmcs_ManPipeModel( Bmcs_Pipe_t * pPipe, bmc_sat_solver * pSat, Bmcs_Job_t * pJob )
+{
+    Bmcs_Man_t * p = pPipe->pMan;
+    Vec_Int_t * vModel = Vec_IntAlloc( 100 );
+    Gia_Obj_t * pObj;  int k, iSatVar, status;
+    status = pthread_mutex_lock(&pPipe->mutexUnf);  assert( status == 0 );
+    Gia_ManForEachPi( p->pFrames, pObj, k )
+    {
+        if ( Vec_IntEntry(&p->vCiMap, 2*k+1) >= pJob->f + pJob->nFrames )
+            continue;
+        iSatVar = Vec_IntEntry( &p->vFr2Sat, Gia_ObjId(p->pFrames, pObj) );
+        if ( iSatVar > 0 && iSatVar < pJob->nVars && bmc_sat_solver_read_cex_varvalue(pSat, iSatVar) )
+            Vec_IntPush( vModel, k );
+    }
+    status = pthread_mutex_unlock(&pPipe->mutexUnf);  assert( status == 0 );
+    return vModel;
+}
+Abc_Cex_t * Bmcs_ManPipeCex( Bmcs_Man_t * p, int i, int f, Vec_Int_t * vModel )
+{
+    Abc_Cex_t * pCex = Abc_CexMakeTriv( Gia_ManRegNum(p->pGia), Gia_ManPiNum(p->pGia), Gia_ManPoNum(p->pGia), f*Gia_ManPoNum(p->pGia)+i );
+    int k, Entry;
+    Vec_IntForEachEntry( vModel, Entry, k )
+    {
+        int iCiId   = Vec_IntEntry( &p->vCiMap, 2*Entry+0 );
+        int iFrame  = Vec_IntEntry( &p->vCiMap, 2*Entry+1 );
+        if ( iFrame <= f )
+            Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(p->pGia) + iFrame * Gia_ManPiNum(p->pGia) + iCiId );
+    }
+    return pCex;
+}
+// returns the next query of the thread or -1 if there are no queries left
+int Bmcs_ManPipeNextQuery( Bmcs_Pipe_t * pPipe, int t )
+{
+    int u, uBest = -1, Mid;
+    if ( pPipe->fTimeout )
+        return -1;
+    if ( pPipe->pBeg[t] == pPipe->pEnd[t] )
+    {
+        for ( u = 0; u < pPipe->nProcs; u++ )
+            if ( pPipe->pBeg[u] < pPipe->pEnd[u] && (uBest == -1 || pPipe->pEnd[u] - pPipe->pBeg[u] > pPipe->pEnd[uBest] - pPipe->pBeg[uBest]) )
+                uBest = u;
+        if ( uBest == -1 )
+            return -1;
+        Mid = pPipe->pBeg[uBest] + (pPipe->pEnd[uBest] - pPipe->pBeg[uBest]) / 2;
+        pPipe->pBeg[t] = Mid;
+        pPipe->pEnd[t] = pPipe->pEnd[uBest];
+        pPipe->pEnd[uBest] = Mid;
+        pPipe->pThData[t].nStolen++;
+    }
+    return pPipe->pBeg[t]++;
+}
+void Bmcs_ManPipeLoadCnf( bmc_sat_solver * pSat, Bmcs_Job_t * pJob )
+{
+    Cnf_Dat_t * pCnf = pJob->pCnf;
+    int i;
+    for ( i = pJob->nVarsOld; i < pJob->nVars; i++ )
+        bmc_sat_solver_addvar( pSat );
+    for ( i = 0; i < pCnf->nClauses; i++ )
+        if ( !bmc_sat_solver_addclause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] ) )
+            assert( 0 );
+}
+// loads the CNFs of the jobs up to the given one, which are not loaded by the thread yet
+void Bmcs_ManPipeLoadJobs( Bmcs_Pipe_t * pPipe, Bmcs_PipeThData_t * pThData, int iJobLast )
+{
+    Bmcs_Job_t * pJob;
+    int status;
+    for ( ; pThData->nJobsLoaded <= iJobLast; pThData->nJobsLoaded++ )
+    {
+        status = pthread_mutex_lock(&pPipe->mutex);  assert( status == 0 );
+        pJob = (Bmcs_Job_t *)Vec_PtrEntry( pPipe->vJobs, pThData->nJobsLoaded );
+        status = pthread_mutex_unlock(&pPipe->mutex);  assert( status == 0 );
+        Bmcs_ManPipeLoadCnf( pThData->pSat, pJob );
+        status = pthread_mutex_lock(&pPipe->mutex);  assert( status == 0 );
+        if ( ++pJob->nLoaded == pPipe->nProcs )
+        {
+            Cnf_DataFree( pJob->pCnf );
+            pJob->pCnf = NULL;
+        }
+        status = pthread_mutex_unlock(&pPipe->mutex);  assert( status == 0 );
+    }
+}
+void * Bmcs_ManPipeWorkerThread( void * pArg )
+{
+    Bmcs_PipeThData_t * pThData = (Bmcs_PipeThData_t *)pArg;
+    Bmcs_Pipe_t * pPipe = pThData->pPipe;
+    volatile int * pPlace = &pThData->fWorking;
+    Bmcs_Job_t * pJob;
+    Vec_Int_t * vModel;
+    abctime clk;
+    int q, u, iLit, status, Result;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pPipe->pJob == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        clk = Abc_Clock();
+        pJob = pPipe->pJob;
+        while ( 1 )
+        {
+            status = pthread_mutex_lock(&pPipe->mutex);  assert( status == 0 );
+            q = Bmcs_ManPipeNextQuery( pPipe, pThData->iThread );
+            while ( q >= 0 && q > pPipe->Limit )
+                q = Bmcs_ManPipeNextQuery( pPipe, pThData->iThread );
+            pThData->iQuery = q;
+            pThData->fStop  = 0;
+            status = pthread_mutex_unlock(&pPipe->mutex);  assert( status == 0 );
+            if ( q == -1 )
+                break;
+            if ( pThData->nJobsLoaded <= pJob->iJob )
+                Bmcs_ManPipeLoadJobs( pPipe, pThData, pJob->iJob );
+            iLit   = Vec_IntEntry( pJob->vLits, Vec_IntEntry(pPipe->vQueries, q) );
+            Result = bmc_sat_solver_solve( pThData->pSat, &iLit, 1 );
+            vModel = Result == l_True ? Bmcs_ManPipeModel( pPipe, pThData->pSat, pJob ) : NULL;
+            status = pthread_mutex_lock(&pPipe->mutex);  assert( status == 0 );
+            pPipe->pStatus[q]  = Result;
+            pPipe->ppModels[q] = vModel;
+            // without solve-all, the queries after a non-UNSAT one are not needed
+            if ( Result != l_False && !pPipe->pMan->pPars->fSolveAll && q < pPipe->Limit )
+            {
+                pPipe->Limit = q;
+                for ( u = 0; u < pPipe->nProcs; u++ )
+                    if ( pPipe->pThData[u].iQuery > q )
+                        pPipe->pThData[u].fStop = 1;
+            }
+            pThData->iQuery = -1;
+            pThData->nSolved++;
+            status = pthread_mutex_unlock(&pPipe->mutex);  assert( status == 0 );
+        }
+        pThData->clkUsed += Abc_Clock() - clk;
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+int Bmcs_ManPerformPipe( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    abctime clkStart = Abc_Clock(), clk;
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Bmcs_PipeThData_t ThData[PAR_THR_MAX];
+    Bmcs_Pipe_t Pipe, * pPipe = &Pipe;
+    Bmcs_Man_t * p = Bmcs_ManStart( pGia, pPars );
+    Bmcs_Job_t * pJob, * pJobNext;
+    Vec_Ptr_t * vCexes = pPars->fSolveAll ? Vec_PtrStart( Gia_ManPoNum(pGia) ) : NULL;
+    Abc_Cex_t * pCex;
+    int nPos = Gia_ManPoNum(pGia), nProcs = pPars->nProcs;
+    int f, k, i, q, t, nQueries, status, fRunning, fStop = 0, nFramesDone = 0, RetValue = -1, nClauses = 0;
+    assert( nProcs > 0 && nProcs < PAR_THR_MAX );
+    Abc_CexFreeP( &pGia->pCexSeq );
+    memset( pPipe, 0, sizeof(Bmcs_Pipe_t) );
+    pPipe->pMan     = p;
+    pPipe->nProcs   = nProcs;
+    pPipe->pThData  = ThData;
+    pPipe->vQueries = Vec_IntAlloc( 100 );
+    pPipe->vJobs    = Vec_PtrAlloc( 100 );
+    status = pthread_mutex_init(&pPipe->mutex, NULL);     assert( status == 0 );
+    status = pthread_mutex_init(&pPipe->mutexUnf, NULL);  assert( status == 0 );
+    // start threads
+    for ( t = 0; t < nProcs; t++ )
+    {
+        memset( ThData + t, 0, sizeof(Bmcs_PipeThData_t) );
+        ThData[t].pPipe    = pPipe;
+        ThData[t].pSat     = p->pSats[t];
+        ThData[t].iThread  = t;
+        ThData[t].iQuery   = -1;
+        bmc_sat_solver_setstop( p->pSats[t], &ThData[t].fStop );
+        status = pthread_create( WorkerThread + t, NULL, Bmcs_ManPipeWorkerThread, (void *)(ThData + t) );  assert( status == 0 );
+    }
+    // solve the timeframes in groups, while unfolding the next group
+    pJob = Bmcs_ManPipeJobStart( pPipe, 0 );
+    for ( ; pJob; pJob = pJobNext )
+    {
+        f = pJob->f;
+        if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
+            pPipe->fTimeout = 1;
+        // collect the outputs, which are not solved yet
+        Vec_IntClear( pPipe->vQueries );
+        for ( q = 0; q < Vec_IntSize(pJob->vLits); q++ )
+            if ( vCexes == NULL || Vec_PtrEntry(vCexes, q % nPos) == NULL )
+                Vec_IntPush( pPipe->vQueries, q );
+        nQueries = Vec_IntSize(pPipe->vQueries);
+        pPipe->pStatus  = ABC_FALLOC( int, nQueries );
+        pPipe->ppModels = ABC_CALLOC( Vec_Int_t *, nQueries );
+        pPipe->Limit    = nQueries;
+        // start the workers unless the outputs are trivially UNSAT
+        if ( pJob->iJob >= 0 )
+        {
+            nClauses += pJob->nClauses;
+            for ( q = 0; q < nQueries; q++ )
+                pPipe->pStatus[q] = l_Undef;
+            for ( t = 0; t < nProcs; t++ )
+            {
+                pPipe->pBeg[t] = t * nQueries / nProcs;
+                pPipe->pEnd[t] = (t + 1) * nQueries / nProcs;
+            }
+            pPipe->pJob = pJob;
+            for ( t = 0; t < nProcs; t++ )
+                ThData[t].fWorking = 1;
+        }
+        else
+            for ( q = 0; q < nQueries; q++ )
+                pPipe->pStatus[q] = l_False;
+        // unfold the next group of timeframes while the current one is solved
+        pJobNext = NULL;
+        if ( (!pPars->nFramesMax || f + pPars->nFramesAdd < pPars->nFramesMax) && !pPipe->fTimeout )
+            pJobNext = Bmcs_ManPipeJobStart( pPipe, f + pPars->nFramesAdd );
+        // wait till the workers finish
+        clk = Abc_Clock();
+        for ( fRunning = (pJob->iJob >= 0); fRunning; )
+        {
+            fRunning = 0;
+            for ( t = 0; t < nProcs; t++ )
+                if ( ThData[t].fWorking )
+                    fRunning = 1;
+            if ( fRunning && !pPipe->fTimeout && pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
+            {
+                status = pthread_mutex_lock(&pPipe->mutex);  assert( status == 0 );
+                pPipe->fTimeout = 1;
+                for ( t = 0; t < nProcs; t++ )
+                    ThData[t].fStop = 1;
+                status = pthread_mutex_unlock(&pPipe->mutex);  assert( status == 0 );
+            }
+        }
+        p->timeSat += Abc_Clock() - clk;
+        // report the results in the order of timeframes and outputs
+        for ( q = k = 0; k < pJob->nFrames; k++ )
+        {
+            for ( i = 0; i < nPos; i++ )
+            {
+                if ( q == nQueries || Vec_IntEntry(pPipe->vQueries, q) != k * nPos + i ) // failed in an earlier job
+                    continue;
+                status = pPipe->pStatus[q++];
+                if ( vCexes && Vec_PtrEntry(vCexes, i) ) // failed in an earlier frame of this job
+                    continue;
+                if ( status == l_False ) // unsat
+                {
+                    if( pPars->pFuncOnFrameDone )
+                        pPars->pFuncOnFrameDone(f+k, i, 0);
+                    continue;
+                }
+                if ( status == l_True ) // sat
+                {
+                    RetValue = 0;
+                    pPars->iFrame = f+k;
+                    pCex = Bmcs_ManPipeCex( p, i, f+k, pPipe->ppModels[q-1] );
+                    pPars->nFailOuts++;
+                    if ( vCexes )
+                        Vec_PtrWriteEntry( vCexes, i, pCex );
+                    else
+                        pGia->pCexSeq = pCex;
+                    if ( !pPars->fNotVerbose )
+                    {
+                        int nOutDigits = Abc_Base10Log( nPos );
+                        Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).  ",  
+                            nOutDigits, i, f+k, nOutDigits, pPars->nFailOuts, nOutDigits, nPos );
+                        if ( vCexes )
+                            Abc_Print( 1, "\n" );
+                        fflush( stdout );
+                    }
+                    if( pPars->pFuncOnFrameDone )
+                        pPars->pFuncOnFrameDone(f+k, i, 1);
+                    if ( vCexes )
+                        continue;
+                }
+                // the output is satisfiable (without solve-all) or undecided
+                fStop = 1;
+                break;
+            }
+            if ( fStop )
+                break;
+            Bmcs_ManPrintFrame( p, f+k, nClauses, -1, clkStart );
+            nFramesDone = f+k+1;
+            if ( vCexes && pPars->nFailOuts == nPos )
+            {
+                fStop = 1;
+                break;
+            }
+        }
+        for ( q = 0; q < nQueries; q++ )
+            Vec_IntFreeP( &pPipe->ppModels[q] );
+        ABC_FREE( pPipe->ppModels );
+        ABC_FREE( pPipe->pStatus );
+        // the jobs with CNF are freed at the end because some threads may still need to load them
+        if ( pJob->iJob == -1 )
+            Bmcs_ManPipeJobStop( pJob );
+        else
+            Vec_IntFreeP( &pJob->vLits );
+        if ( fStop )
+        {
+            if ( pJobNext && pJobNext->iJob == -1 )
+                Bmcs_ManPipeJobStop( pJobNext );
+            break;
+        }
+    }
+    // stop threads
+    pPipe->pJob = NULL;
+    for ( t = 0; t < nProcs; t++ )
+    {
+        assert( !ThData[t].fWorking );
+        ThData[t].fWorking = 1;
+    }
+    for ( t = 0; t < nProcs; t++ )
+    {
+        status = pthread_join( WorkerThread[t], NULL );  assert( status == 0 );
+    }
+    status = pthread_mutex_destroy(&pPipe->mutex);     assert( status == 0 );
+    status = pthread_mutex_destroy(&pPipe->mutexUnf);  assert( status == 0 );
+    Vec_IntFree( pPipe->vQueries );
+    Vec_PtrForEachEntry( Bmcs_Job_t *, pPipe->vJobs, pJob, t )
+        Bmcs_ManPipeJobStop( pJob );
+    Vec_PtrFree( pPipe->vJobs );
+    p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
+    if ( vCexes )
+    {
+        if ( pPars->nFailOuts == 0 )
+            Vec_PtrFree( vCexes );
+        else
+        {
+            Vec_PtrFreeFree( pGia->vSeqModelVec );
+            pGia->vSeqModelVec = vCexes;
+        }
+    }
+    if ( RetValue == -1 && !pPars->fNotVerbose )
+        printf( "No output failed in %d frames.  ", nFramesDone );
+    else if ( vCexes && !pPars->fNotVerbose )
+        printf( "Found %d failed outputs in %d frames.  ", pPars->nFailOuts, nFramesDone );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
+    if ( pPars->fVerbose )
+    {
+        for ( t = 0; t < nProcs; t++ )
+        {
+            Abc_Print( 1, "Thread %2d : Queries = %6d.  Steals = %5d.  ", t, ThData[t].nSolved, ThData[t].nStolen );
+            Abc_PrintTime( 1, "Time", ThData[t].clkUsed );
+        }
+    }
+    Bmcs_ManPrintTime( p );
+    Bmcs_ManStop( p );
+    return RetValue;
+}
+
 #endif // pthreads are used
 
 
@@ -925,6 +1385,8 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 int Bmcs_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) 
 { 
     assert( pPars->nProcs < PAR_THR_MAX );
+    if ( pPars->fPipeline )
+        return Bmcs_ManPerformPipe( pGia, pPars );
     if ( pPars->nProcs == 1 )
         return Bmcs_ManPerformOne( pGia, pPars );
     else
@@ -148,6 +148,9 @@ extern void            Cnf_ComputeClauses( Aig_Man_t * p, Aig_Obj_t * pRoot, Vec
                            Vec_Ptr_t * vNodes, Vec_Int_t * vMap, Vec_Int_t * vCover, Vec_Int_t * vClauses );
 extern void            Cnf_DeriveFastMark( Aig_Man_t * p );
 extern Cnf_Dat_t *     Cnf_DeriveFast( Aig_Man_t * p, int nOutputs );
+/*=== cnfPth.c ========================================================*/
+extern Cnf_Dat_t *     Cnf_DeriveFastPar( Aig_Man_t * p, int nOutputs, int nThreads, int fVerbose );
+extern int             Cnf_DeriveFastWriteStream( Aig_Man_t * p, int nOutputs, FILE * pFile, int fChangePol, int nThreads, int fVerbose );
 /*=== cnfMan.c ========================================================*/
 extern Cnf_Man_t *     Cnf_ManStart();
 extern void            Cnf_ManStop( Cnf_Man_t * p );
@@ -0,0 +1,769 @@
+/**CFile****************************************************************
+
+  FileName    [cnfPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [Multi-threaded version of the fast CNF computation.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - April 28, 2007.]
+
+  Revision    [$Id: cnfPth.c,v 1.00 2007/04/28 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+#include "bool/kit/kit.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PAR_THR_MAX 100
+#define CNF_JOB_SIZE 1000  // the number of cones in one job
+#define CNF_JOB_MUL     4  // the number of jobs per thread in one batch
+
+// what the threads are doing with the cones
+enum { CNF_PAR_COUNT, CNF_PAR_FILL, CNF_PAR_TEXT };
+
+typedef struct Cnf_ParMan_t_ Cnf_ParMan_t;
+struct Cnf_ParMan_t_
+{
+    Aig_Man_t *    pAig;        // the marked AIG (read-only)
+    Vec_Int_t *    vMap;        // the SAT variable of each object (read-only)
+    Vec_Ptr_t *    vRoots;      // the roots of the cones in the order of clauses
+    int *          pClaBeg;     // the first clause of each cone (nRoots + 1)
+    int *          pLitBeg;     // the first literal of each cone (nRoots + 1)
+    int **         pClauses;    // the resulting clauses (when filling)
+    char *         pVarToPol;   // the polarity of each variable (when writing)
+    int            nThreads;    // the number of threads
+};
+
+typedef struct Cnf_Job_t_ Cnf_Job_t;
+struct Cnf_Job_t_
+{
+    int            iStart;      // the first cone
+    int            iStop;       // the cone after the last one
+    int            Mode;        // what should be done
+    Vec_Str_t *    vOut;        // the text of the clauses (when writing)
+};
+
+typedef struct Cnf_ThData_t_
+{
+    Cnf_ParMan_t * p;           // the shared data
+    Cnf_Job_t *    pJob;        // the current job (or NULL to stop)
+    Vec_Ptr_t *    vLeaves;     // the leaves of the cone
+    Vec_Ptr_t *    vNodes;      // the internal nodes of the cone
+    Vec_Int_t *    vCover;      // the ISOP storage
+    Vec_Int_t *    vClauses;    // the clauses of the cone
+    Vec_Int_t *    vStamps;     // thread-private traversal IDs
+    Vec_Int_t *    vIndex;      // thread-private truth table indexes
+    int            nStamp;      // the current traversal ID
+    int            fWorking;    // the thread is busy
+    abctime        clkUsed;     // runtime of the thread
+} Cnf_ThData_t;
+
+static inline int Cnf_ObjGetLit( Vec_Int_t * vMap, Aig_Obj_t * pObj, int fCompl ) { int iSatVar = Vec_IntEntry(vMap, Aig_ObjId(pObj)); assert( iSatVar > 0 ); return iSatVar + iSatVar + fCompl; }
+static inline int Cnf_Lit2Var( int Lit )                                          { return (Lit & 1)? -(Lit >> 1)-1 : (Lit >> 1)+1;  }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collects nodes inside the cone.]
+
+  Description [Same as Cnf_CollectVolume() but uses the thread-private
+  traversal IDs instead of those stored in the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_ParCollectVolume_rec( Cnf_ThData_t * pTh, Aig_Obj_t * pObj )
+{
+    if ( Vec_IntEntry(pTh->vStamps, Aig_ObjId(pObj)) == pTh->nStamp )
+        return;
+    Vec_IntWriteEntry( pTh->vStamps, Aig_ObjId(pObj), pTh->nStamp );
+    assert( Aig_ObjIsNode(pObj) );
+    Cnf_ParCollectVolume_rec( pTh, Aig_ObjFanin0(pObj) );
+    Cnf_ParCollectVolume_rec( pTh, Aig_ObjFanin1(pObj) );
+    Vec_PtrPush( pTh->vNodes, pObj );
+}
+static void Cnf_ParCollectVolume( Cnf_ThData_t * pTh, Aig_Obj_t * pRoot )
+{
+    Aig_Obj_t * pObj;
+    int i;
+    pTh->nStamp++;
+    Vec_PtrForEachEntry( Aig_Obj_t *, pTh->vLeaves, pObj, i )
+        Vec_IntWriteEntry( pTh->vStamps, Aig_ObjId(pObj), pTh->nStamp );
+    Vec_PtrClear( pTh->vNodes );
+    Cnf_ParCollectVolume_rec( pTh, pRoot );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derive truth table.]
+
+  Description [Same as Cnf_CutDeriveTruth() but does not use the static
+  storage and the data fields of the AIG objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Cnf_ParDeriveTruth( Cnf_ThData_t * pTh )
+{
+    static word Truth6[6] = {
+        ABC_CONST(0xAAAAAAAAAAAAAAAA),
+        ABC_CONST(0xCCCCCCCCCCCCCCCC),
+        ABC_CONST(0xF0F0F0F0F0F0F0F0),
+        ABC_CONST(0xFF00FF00FF00FF00),
+        ABC_CONST(0xFFFF0000FFFF0000),
+        ABC_CONST(0xFFFFFFFF00000000)
+    };
+    static word C[2] = { 0, ~(word)0 };
+    word S[256];
+    Vec_Ptr_t * vLeaves = pTh->vLeaves;
+    Vec_Ptr_t * vNodes = pTh->vNodes;
+    Aig_Obj_t * pObj = NULL;
+    int i, iObj = 0, iFan0, iFan1;
+    assert( Vec_PtrSize(vLeaves) <= 6 && Vec_PtrSize(vNodes) > 0 );
+    assert( Vec_PtrSize(vLeaves) + Vec_PtrSize(vNodes) <= 256 );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vLeaves, pObj, i )
+    {
+        Vec_IntWriteEntry( pTh->vIndex, Aig_ObjId(pObj), i );
+        S[i] = Truth6[i];
+    }
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+    {
+        iObj  = Vec_PtrSize(vLeaves) + i;
+        iFan0 = Vec_IntEntry( pTh->vIndex, Aig_ObjFaninId0(pObj) );
+        iFan1 = Vec_IntEntry( pTh->vIndex, Aig_ObjFaninId1(pObj) );
+        Vec_IntWriteEntry( pTh->vIndex, Aig_ObjId(pObj), iObj );
+        S[iObj] = (S[iFan0] ^ C[Aig_ObjFaninC0(pObj)]) & (S[iFan1] ^ C[Aig_ObjFaninC1(pObj)]);
+    }
+    return S[iObj];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the clauses of one cone.]
+
+  Description [Same as Cnf_ComputeClauses() but can be called by several
+  threads at the same time because it does not modify the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_ParComputeClauses( Cnf_ThData_t * pTh, Aig_Obj_t * pRoot )
+{
+    Vec_Int_t * vMap = pTh->p->vMap;
+    Vec_Ptr_t * vLeaves = pTh->vLeaves;
+    Vec_Int_t * vCover = pTh->vCover;
+    Vec_Int_t * vClauses = pTh->vClauses;
+    Aig_Obj_t * pLeaf;
+    int c, k, Cube, OutLit, RetValue;
+    word Truth;
+    assert( pRoot->fMarkA );
+
+    Vec_IntClear( vClauses );
+
+    OutLit = Cnf_ObjGetLit( vMap, pRoot, 0 );
+    // detect cone
+    Cnf_CollectLeaves( pRoot, vLeaves, 0 );
+    Cnf_ParCollectVolume( pTh, pRoot );
+    assert( pRoot == Vec_PtrEntryLast(pTh->vNodes) );
+    // check if this is an AND-gate
+    Vec_PtrForEachEntry( Aig_Obj_t *, pTh->vNodes, pLeaf, k )
+    {
+        if ( Aig_ObjFaninC0(pLeaf) && !Aig_ObjFanin0(pLeaf)->fMarkA )
+            break;
+        if ( Aig_ObjFaninC1(pLeaf) && !Aig_ObjFanin1(pLeaf)->fMarkA )
+            break;
+    }
+    if ( k == Vec_PtrSize(pTh->vNodes) )
+    {
+        Cnf_CollectLeaves( pRoot, vLeaves, 1 );
+        // write big clause
+        Vec_IntPush( vClauses, 0 );
+        Vec_IntPush( vClauses, OutLit );
+        Vec_PtrForEachEntry( Aig_Obj_t *, vLeaves, pLeaf, k )
+            Vec_IntPush( vClauses, Cnf_ObjGetLit(vMap, Aig_Regular(pLeaf), !Aig_IsComplement(pLeaf)) );
+        // write small clauses
+        Vec_PtrForEachEntry( Aig_Obj_t *, vLeaves, pLeaf, k )
+        {
+            Vec_IntPush( vClauses, 0 );
+            Vec_IntPush( vClauses, OutLit ^ 1 );
+            Vec_IntPush( vClauses, Cnf_ObjGetLit(vMap, Aig_Regular(pLeaf), Aig_IsComplement(pLeaf)) );
+        }
+        return;
+    }
+    assert( Vec_PtrSize(vLeaves) <= 6 );
+
+    Truth = Cnf_ParDeriveTruth( pTh );
+    if ( Truth == 0 || Truth == ~(word)0 )
+    {
+        Vec_IntPush( vClauses, 0 );
+        Vec_IntPush( vClauses, (Truth == 0) ? (OutLit ^ 1) : OutLit );
+        return;
+    }
+
+    RetValue = Kit_TruthIsop( (unsigned *)&Truth, Vec_PtrSize(vLeaves), vCover, 0 );
+    assert( RetValue >= 0 );
+    Vec_IntForEachEntry( vCover, Cube, c )
+    {
+        Vec_IntPush( vClauses, 0 );
+        Vec_IntPush( vClauses, OutLit );
+        for ( k = 0; k < Vec_PtrSize(vLeaves); k++, Cube >>= 2 )
+        {
+            if ( (Cube & 3) == 0 )
+                continue;
+            assert( (Cube & 3) != 3 );
+            Vec_IntPush( vClauses, Cnf_ObjGetLit(vMap, (Aig_Obj_t *)Vec_PtrEntry(vLeaves,k), (Cube&3)!=1) );
+        }
+    }
+
+    Truth = ~Truth;
+
+    RetValue = Kit_TruthIsop( (unsigned *)&Truth, Vec_PtrSize(vLeaves), vCover, 0 );
+    assert( RetValue >= 0 );
+    Vec_IntForEachEntry( vCover, Cube, c )
+    {
+        Vec_IntPush( vClauses, 0 );
+        Vec_IntPush( vClauses, OutLit ^ 1 );
+        for ( k = 0; k < Vec_PtrSize(vLeaves); k++, Cube >>= 2 )
+        {
+            if ( (Cube & 3) == 0 )
+                continue;
+            assert( (Cube & 3) != 3 );
+            Vec_IntPush( vClauses, Cnf_ObjGetLit(vMap, (Aig_Obj_t *)Vec_PtrEntry(vLeaves,k), (Cube&3)!=1) );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the cones of one job.]
+
+  Description [When counting, records the number of clauses and literals
+  of each cone in the entries of the arrays of the first clause/literal,
+  which are later converted into offsets by the prefix sum. When filling,
+  writes the clauses starting from these offsets. When writing, prints
+  the clauses in the DIMACS format into the buffer of the job.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_ParJobProcess( Cnf_ThData_t * pTh, Cnf_Job_t * pJob )
+{
+    Cnf_ParMan_t * p = pTh->p;
+    Aig_Obj_t * pRoot;
+    int i, k, Entry, nClauses, iClause, * pLits;
+    for ( i = pJob->iStart; i < pJob->iStop; i++ )
+    {
+        pRoot = (Aig_Obj_t *)Vec_PtrEntry( p->vRoots, i );
+        Cnf_ParComputeClauses( pTh, pRoot );
+        if ( pJob->Mode == CNF_PAR_COUNT )
+        {
+            nClauses = 0;
+            Vec_IntForEachEntry( pTh->vClauses, Entry, k )
+                nClauses += (Entry == 0);
+            p->pClaBeg[i] = nClauses;
+            p->pLitBeg[i] = Vec_IntSize(pTh->vClauses) - nClauses;
+        }
+        else if ( pJob->Mode == CNF_PAR_FILL )
+        {
+            iClause = p->pClaBeg[i];
+            pLits   = p->pClauses[0] + p->pLitBeg[i];
+            Vec_IntForEachEntry( pTh->vClauses, Entry, k )
+            {
+                if ( Entry == 0 )
+                    p->pClauses[iClause++] = pLits;
+                else
+                    *pLits++ = Entry;
+            }
+            assert( iClause == p->pClaBeg[i+1] );
+            assert( pLits == p->pClauses[0] + p->pLitBeg[i+1] );
+        }
+        else if ( pJob->Mode == CNF_PAR_TEXT )
+        {
+            Vec_IntForEachEntry( pTh->vClauses, Entry, k )
+            {
+                if ( Entry == 0 )
+                {
+                    if ( k > 0 )
+                        Vec_StrPrintStr( pJob->vOut, "0\n" );
+                    continue;
+                }
+                Vec_StrPrintNum( pJob->vOut, Cnf_Lit2Var(Entry ^ p->pVarToPol[Entry >> 1]) );
+                Vec_StrPush( pJob->vOut, ' ' );
+            }
+            if ( Vec_IntSize(pTh->vClauses) > 0 )
+                Vec_StrPrintStr( pJob->vOut, "0\n" );
+        }
+        else assert( 0 );
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Thread procedure.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Cnf_ParWorkerThread( void * pArg )
+{
+    Cnf_ThData_t * pThData = (Cnf_ThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    abctime clk;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->pJob == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        clk = Abc_Clock();
+        Cnf_ParJobProcess( pThData, pThData->pJob );
+        pThData->clkUsed += Abc_Clock() - clk;
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Processes all cones using several threads.]
+
+  Description [The cones are divided into jobs of consecutive cones,
+  which are given to the first idle thread. The jobs are processed in
+  batches, so that the text of the clauses, if it is requested, can be
+  written into the file in the original order after each batch.
+  Returns 0 if writing into the file has failed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_ParRun( Cnf_ParMan_t * p, int Mode, FILE * pFile, int fVerbose )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[PAR_THR_MAX];
+    int status, fRunning;
+#endif
+    Cnf_ThData_t ThData[PAR_THR_MAX];
+    Cnf_Job_t * pJobs, * pJob;
+    int nThreads = Abc_MaxInt( 1, Abc_MinInt( p->nThreads, PAR_THR_MAX ) );
+    int nBatch   = CNF_JOB_MUL * nThreads;
+    int nJobs    = (Vec_PtrSize(p->vRoots) + CNF_JOB_SIZE - 1) / CNF_JOB_SIZE;
+    int i, k, t, nJobsCur, fError = 0;
+#ifndef ABC_USE_PTHREADS
+    nThreads = 1;
+#endif
+    pJobs = ABC_CALLOC( Cnf_Job_t, nBatch );
+    for ( i = 0; i < nBatch; i++ )
+        pJobs[i].vOut = Mode == CNF_PAR_TEXT ? Vec_StrAlloc( 1 << 16 ) : NULL;
+    // start the threads
+    for ( t = 0; t < nThreads; t++ )
+    {
+        ThData[t].p        = p;
+        ThData[t].pJob     = NULL;
+        ThData[t].vLeaves  = Vec_PtrAlloc( 100 );
+        ThData[t].vNodes   = Vec_PtrAlloc( 100 );
+        ThData[t].vCover   = Vec_IntAlloc( 1 << 16 );
+        ThData[t].vClauses = Vec_IntAlloc( 100 );
+        ThData[t].vStamps  = Vec_IntStart( Aig_ManObjNumMax(p->pAig) );
+        ThData[t].vIndex   = Vec_IntStart( Aig_ManObjNumMax(p->pAig) );
+        ThData[t].nStamp   = 0;
+        ThData[t].fWorking = 0;
+        ThData[t].clkUsed  = 0;
+#ifdef ABC_USE_PTHREADS
+        if ( nThreads > 1 )
+        {
+            status = pthread_create( WorkerThread + t, NULL, Cnf_ParWorkerThread, (void *)(ThData + t) );  assert( status == 0 );
+        }
+#endif
+    }
+    for ( i = 0; i < nJobs; i += nBatch )
+    {
+        nJobsCur = Abc_MinInt( nBatch, nJobs - i );
+        for ( k = 0; k < nJobsCur; k++ )
+        {
+            pJob = pJobs + k;
+            pJob->iStart = (i + k) * CNF_JOB_SIZE;
+            pJob->iStop  = Abc_MinInt( pJob->iStart + CNF_JOB_SIZE, Vec_PtrSize(p->vRoots) );
+            pJob->Mode   = Mode;
+            if ( pJob->vOut )
+                Vec_StrClear( pJob->vOut );
+#ifdef ABC_USE_PTHREADS
+            if ( nThreads > 1 )
+            {
+                for ( t = 0; *(volatile int *)&ThData[t].fWorking; t = (t + 1) % nThreads );
+                ThData[t].pJob = pJob;
+                ThData[t].fWorking = 1;
+                continue;
+            }
+#endif
+            {
+                abctime clk = Abc_Clock();
+                Cnf_ParJobProcess( ThData, pJob );
+                ThData[0].clkUsed += Abc_Clock() - clk;
+            }
+        }
+#ifdef ABC_USE_PTHREADS
+        // wait till the threads finish
+        for ( fRunning = (nThreads > 1); fRunning; )
+        {
+            fRunning = 0;
+            for ( t = 0; t < nThreads; t++ )
+                if ( *(volatile int *)&ThData[t].fWorking )
+                    fRunning = 1;
+        }
+#endif
+        // write the clauses in the original order
+        if ( pFile )
+            for ( k = 0; k < nJobsCur && !fError; k++ )
+                if ( fwrite( Vec_StrArray(pJobs[k].vOut), 1, Vec_StrSize(pJobs[k].vOut), pFile ) != (size_t)Vec_StrSize(pJobs[k].vOut) )
+                    fError = 1;
+    }
+    // stop the threads
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        for ( t = 0; t < nThreads; t++ )
+        {
+            assert( !ThData[t].fWorking );
+            ThData[t].pJob = NULL;
+            ThData[t].fWorking = 1;
+        }
+        for ( t = 0; t < nThreads; t++ )
+        {
+            status = pthread_join( WorkerThread[t], NULL );  assert( status == 0 );
+        }
+    }
+#endif
+    if ( fVerbose )
+    {
+        printf( "Pass \"%s\" with %d thread%s on %d jobs:\n", Mode == CNF_PAR_COUNT ? "count" : (Mode == CNF_PAR_FILL ? "fill" : "write"),
+            nThreads, nThreads == 1 ? "" : "s", nJobs );
+        for ( t = 0; t < nThreads; t++ )
+        {
+            printf( "Thread %2d : ", t );
+            Abc_PrintTime( 1, "Time", ThData[t].clkUsed );
+        }
+    }
+    for ( t = 0; t < nThreads; t++ )
+    {
+        Vec_PtrFree( ThData[t].vLeaves );
+        Vec_PtrFree( ThData[t].vNodes );
+        Vec_IntFree( ThData[t].vCover );
+        Vec_IntFree( ThData[t].vClauses );
+        Vec_IntFree( ThData[t].vStamps );
+        Vec_IntFree( ThData[t].vIndex );
+    }
+    for ( i = 0; i < nBatch; i++ )
+        if ( pJobs[i].vOut )
+            Vec_StrFree( pJobs[i].vOut );
+    ABC_FREE( pJobs );
+    return !fError;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the AIG and counts the clauses of each cone.]
+
+  Description [Assigns the SAT variables in the same way as
+  Cnf_DeriveFastClauses(), collects the cones in the order of their
+  clauses, and computes the offsets of the first clause and the first
+  literal of each cone. Returns the total number of clauses and literals,
+  including those of the COs and the constant node.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Cnf_ParMan_t * Cnf_ParManStart( Aig_Man_t * p, int nOutputs, int nThreads, int fVerbose, int * pnVars, int * pnClauses, int * pnLiterals )
+{
+    Cnf_ParMan_t * pMan;
+    Aig_Obj_t * pObj;
+    int i, nVars, nRoots;
+    Aig_ManCleanMarkAB( p );
+    Cnf_DeriveFastMark( p );
+    pMan = ABC_CALLOC( Cnf_ParMan_t, 1 );
+    pMan->pAig     = p;
+    pMan->nThreads = nThreads;
+    pMan->vMap     = Vec_IntStartFull( Aig_ManObjNumMax(p) );
+    pMan->vRoots   = Vec_PtrAlloc( Aig_ManNodeNum(p) );
+    // assign variables for the outputs
+    nVars = 1;
+    if ( nOutputs )
+    {
+        if ( Aig_ManRegNum(p) == 0 )
+        {
+            assert( nOutputs == Aig_ManCoNum(p) );
+            Aig_ManForEachCo( p, pObj, i )
+                Vec_IntWriteEntry( pMan->vMap, Aig_ObjId(pObj), nVars++ );
+        }
+        else
+        {
+            assert( nOutputs == Aig_ManRegNum(p) );
+            Aig_ManForEachLiSeq( p, pObj, i )
+                Vec_IntWriteEntry( pMan->vMap, Aig_ObjId(pObj), nVars++ );
+        }
+    }
+    // assign variables to the internal nodes
+    Aig_ManForEachNodeReverse( p, pObj, i )
+        if ( pObj->fMarkA )
+        {
+            Vec_IntWriteEntry( pMan->vMap, Aig_ObjId(pObj), nVars++ );
+            Vec_PtrPush( pMan->vRoots, pObj );
+        }
+    // assign variables to the PIs and constant node
+    Aig_ManForEachCi( p, pObj, i )
+        Vec_IntWriteEntry( pMan->vMap, Aig_ObjId(pObj), nVars++ );
+    Vec_IntWriteEntry( pMan->vMap, Aig_ObjId(Aig_ManConst1(p)), nVars++ );
+    // count clauses and literals of each cone
+    nRoots = Vec_PtrSize(pMan->vRoots);
+    pMan->pClaBeg = ABC_CALLOC( int, nRoots + 1 );
+    pMan->pLitBeg = ABC_CALLOC( int, nRoots + 1 );
+    Cnf_ParRun( pMan, CNF_PAR_COUNT, NULL, fVerbose );
+    // convert the counts into offsets
+    *pnClauses = *pnLiterals = 0;
+    for ( i = 0; i <= nRoots; i++ )
+    {
+        int nClas = pMan->pClaBeg[i];
+        int nLits = pMan->pLitBeg[i];
+        pMan->pClaBeg[i] = *pnClauses;
+        pMan->pLitBeg[i] = *pnLiterals;
+        *pnClauses  += nClas;
+        *pnLiterals += nLits;
+    }
+    // add the clauses of the COs and the constant node
+    *pnClauses  += (Aig_ManCoNum(p) - nOutputs) + 2 * nOutputs + 1;
+    *pnLiterals += (Aig_ManCoNum(p) - nOutputs) + 4 * nOutputs + 1;
+    *pnVars = nVars;
+    return pMan;
+}
+static void Cnf_ParManStop( Cnf_ParMan_t * p )
+{
+    Vec_IntFreeP( &p->vMap );
+    Vec_PtrFree( p->vRoots );
+    ABC_FREE( p->pClaBeg );
+    ABC_FREE( p->pLitBeg );
+    ABC_FREE( p->pVarToPol );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the clauses of the COs and the constant node.]
+
+  Description [These are the clauses following the clauses of the cones
+  in Cnf_DeriveFastClauses().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_ParCollectOutputClauses( Aig_Man_t * p, Vec_Int_t * vMap, int nOutputs, Vec_Int_t * vClauses )
+{
+    Aig_Obj_t * pObj;
+    int i, OutLit, DriLit;
+    Vec_IntClear( vClauses );
+    Aig_ManForEachCo( p, pObj, i )
+    {
+        DriLit = Cnf_ObjGetLit( vMap, Aig_ObjFanin0(pObj), Aig_ObjFaninC0(pObj) );
+        if ( i < Aig_ManCoNum(p) - nOutputs )
+        {
+            Vec_IntPush( vClauses, 0 );
+            Vec_IntPush( vClauses, DriLit );
+        }
+        else
+        {
+            OutLit = Cnf_ObjGetLit( vMap, pObj, 0 );
+            // first clause
+            Vec_IntPush( vClauses, 0 );
+            Vec_IntPush( vClauses, OutLit );
+            Vec_IntPush( vClauses, DriLit ^ 1 );
+            // second clause
+            Vec_IntPush( vClauses, 0 );
+            Vec_IntPush( vClauses, OutLit ^ 1 );
+            Vec_IntPush( vClauses, DriLit );
+        }
+    }
+    // write the constant literal
+    OutLit = Cnf_ObjGetLit( vMap, Aig_ManConst1(p), 0 );
+    Vec_IntPush( vClauses, 0 );
+    Vec_IntPush( vClauses, OutLit );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Fast CNF computation using several threads.]
+
+  Description [Produces the same CNF as Cnf_DeriveFast(). The clauses
+  are derived in two passes over the cones: the first pass counts the
+  clauses and literals of each cone, the second one writes them at the
+  offsets given by the prefix sum of the counts. As a result, the arrays
+  of the CNF are allocated once and never reallocated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_DeriveFastPar( Aig_Man_t * p, int nOutputs, int nThreads, int fVerbose )
+{
+    Cnf_ParMan_t * pMan;
+    Cnf_Dat_t * pCnf;
+    Vec_Int_t * vClauses;
+    int i, Entry, nVars, nClauses, nLiterals, iClause, * pLits;
+    abctime clk = Abc_Clock();
+    pMan = Cnf_ParManStart( p, nOutputs, nThreads, fVerbose, &nVars, &nClauses, &nLiterals );
+    pCnf = Cnf_DataAlloc( p, nVars, nClauses, nLiterals );
+    // fill in the clauses of the cones
+    pMan->pClauses = pCnf->pClauses;
+    Cnf_ParRun( pMan, CNF_PAR_FILL, NULL, fVerbose );
+    // add the remaining clauses
+    vClauses = Vec_IntAlloc( 3 * Aig_ManCoNum(p) + 2 );
+    Cnf_ParCollectOutputClauses( p, pMan->vMap, nOutputs, vClauses );
+    iClause = pMan->pClaBeg[Vec_PtrSize(pMan->vRoots)];
+    pLits   = pCnf->pClauses[0] + pMan->pLitBeg[Vec_PtrSize(pMan->vRoots)];
+    Vec_IntForEachEntry( vClauses, Entry, i )
+    {
+        if ( Entry == 0 )
+            pCnf->pClauses[iClause++] = pLits;
+        else
+            *pLits++ = Entry;
+    }
+    assert( iClause == nClauses );
+    assert( pLits == pCnf->pClauses[nClauses] );
+    Vec_IntFree( vClauses );
+    ABC_FREE( pCnf->pVarNums );
+    pCnf->pVarNums = Vec_IntReleaseArray( pMan->vMap );
+    Cnf_ParManStop( pMan );
+    Aig_ManCleanMarkA( p );
+    if ( fVerbose )
+    {
+        printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d.   ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the fast CNF into a file without storing it.]
+
+  Description [Writes the same text as Cnf_DataWriteIntoFile() called for
+  the result of Cnf_DeriveFast(), followed by Cnf_DataTranformPolarity()
+  if fChangePol is set. After the clauses are counted, the cones are
+  processed in batches of jobs, whose clauses are printed by the threads
+  into their own buffers and written into the file in the original order.
+  The memory is linear in the size of the AIG rather than the size of
+  the CNF. The file can be a pipe or the standard output. Returns the
+  number of clauses written, or -1 if writing has failed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_DeriveFastWriteStream( Aig_Man_t * p, int nOutputs, FILE * pFile, int fChangePol, int nThreads, int fVerbose )
+{
+    Cnf_ParMan_t * pMan;
+    Vec_Int_t * vClauses;
+    Aig_Obj_t * pObj;
+    int i, Entry, nVars, nClauses, nLiterals, fOkay;
+    abctime clk = Abc_Clock();
+    pMan = Cnf_ParManStart( p, nOutputs, nThreads, fVerbose, &nVars, &nClauses, &nLiterals );
+    // create map from the variable number to its polarity
+    pMan->pVarToPol = ABC_CALLOC( char, nVars );
+    if ( fChangePol )
+    {
+        Aig_ManForEachObj( p, pObj, i )
+            if ( !Aig_ObjIsCo(pObj) && Vec_IntEntry(pMan->vMap, i) >= 0 )
+                pMan->pVarToPol[Vec_IntEntry(pMan->vMap, i)] = (char)pObj->fPhase;
+    }
+    // write the header and the clauses of the cones
+    fprintf( pFile, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
+    fprintf( pFile, "p cnf %d %d\n", nVars, nClauses );
+    fOkay = Cnf_ParRun( pMan, CNF_PAR_TEXT, pFile, fVerbose );
+    // write the remaining clauses
+    vClauses = Vec_IntAlloc( 3 * Aig_ManCoNum(p) + 2 );
+    Cnf_ParCollectOutputClauses( p, pMan->vMap, nOutputs, vClauses );
+    Vec_IntForEachEntry( vClauses, Entry, i )
+    {
+        if ( Entry == 0 )
+        {
+            if ( i > 0 )
+                fprintf( pFile, "0\n" );
+            continue;
+        }
+        fprintf( pFile, "%d ", Cnf_Lit2Var(Entry ^ pMan->pVarToPol[Entry >> 1]) );
+    }
+    fprintf( pFile, "0\n\n" );
+    // the errors of fprintf() are caught by ferror()
+    fOkay &= (fflush( pFile ) == 0 && !ferror( pFile ));
+    Vec_IntFree( vClauses );
+    Cnf_ParManStop( pMan );
+    Aig_ManCleanMarkA( p );
+    if ( fVerbose )
+    {
+        printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d.   ", nVars, nClauses, nLiterals );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return fOkay ? nClauses : -1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
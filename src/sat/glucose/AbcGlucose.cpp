@@ -559,6 +559,86 @@ int bmcg_sat_solver_minimize_assumptions( bmcg_sat_solver * s, int * plits, int
 #endif
 
 
+/**Function*************************************************************
+
+  Synopsis    [Solves a batch of incremental queries.]
+
+  Description [Each level of vAssumps is one query given by its assumption
+  literals. The query status (GLUCOSE_SAT, GLUCOSE_UNSAT or GLUCOSE_UNDEC)
+  is written into vStatus in the original order of the queries. If vVars
+  is not NULL, for each query, the values of these variables are appended
+  to vValues (the values are -1 if the query is not satisfiable). If
+  nConfLimit is positive, it is the conflict limit of each query, and the
+  conflict budget is turned off after the batch. The queries are solved
+  in the lexicographic order of their assumptions. The decision levels of
+  the assumptions shared by the consecutive queries are kept, so these
+  assumptions are not propagated again, and the restarts do not undo them.
+  Returns the number of satisfiable queries.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int bmcg_sat_solver_compare_queries( Vec_Int_t ** pp1, Vec_Int_t ** pp2 )
+{
+    int i, nSize = Abc_MinInt( Vec_IntSize(*pp1), Vec_IntSize(*pp2) );
+    for ( i = 0; i < nSize; i++ )
+        if ( Vec_IntEntry(*pp1, i) != Vec_IntEntry(*pp2, i) )
+            return Vec_IntEntry(*pp1, i) < Vec_IntEntry(*pp2, i) ? -1 : 1;
+    if ( Vec_IntSize(*pp1) != Vec_IntSize(*pp2) )
+        return Vec_IntSize(*pp1) < Vec_IntSize(*pp2) ? -1 : 1;
+    if ( *pp1 == *pp2 )
+        return 0;
+    return *pp1 < *pp2 ? -1 : 1; // keep the original order of the identical queries
+}
+int bmcg_sat_solver_solve_batch( bmcg_sat_solver * s, Vec_Wec_t * vAssumps, Vec_Int_t * vStatus, Vec_Int_t * vVars, Vec_Int_t * vValues, int nConfLimit )
+{
+#ifdef USE_SIMP_SOLVER
+    Gluco::SimpSolver * S = (Gluco::SimpSolver *)s;
+#else
+    Gluco::Solver * S = (Gluco::Solver *)s;
+#endif
+    Vec_Int_t ** pOrder = ABC_ALLOC( Vec_Int_t *, Vec_WecSize(vAssumps) + 1 );
+    Vec_Int_t * vLevel;
+    int i, k, iQuery, iVar, status, nSat = 0;
+    Vec_WecForEachLevel( vAssumps, vLevel, i )
+        pOrder[i] = vLevel;
+    qsort( (void *)pOrder, (size_t)Vec_WecSize(vAssumps), sizeof(Vec_Int_t *), (int (*)(const void *, const void *))bmcg_sat_solver_compare_queries );
+    Vec_IntFill( vStatus, Vec_WecSize(vAssumps), GLUCOSE_UNDEC );
+    S->keepAssumptions( true );
+    if ( vVars )
+        Vec_IntFill( vValues, Vec_WecSize(vAssumps) * Vec_IntSize(vVars), -1 );
+    for ( i = 0; i < Vec_WecSize(vAssumps); i++ )
+    {
+        vLevel = pOrder[i];
+        iQuery = vLevel - Vec_WecArray(vAssumps);
+        if ( nConfLimit > 0 )
+            bmcg_sat_solver_set_conflict_budget( s, nConfLimit );
+        status = bmcg_sat_solver_solve( s, Vec_IntArray(vLevel), Vec_IntSize(vLevel) );
+        Vec_IntWriteEntry( vStatus, iQuery, status );
+        if ( status != GLUCOSE_SAT )
+            continue;
+        nSat++;
+        if ( vVars )
+            Vec_IntForEachEntry( vVars, iVar, k )
+                Vec_IntWriteEntry( vValues, iQuery * Vec_IntSize(vVars) + k, bmcg_sat_solver_read_cex_varvalue(s, iVar) );
+    }
+    S->keepAssumptions( false );
+    if ( nConfLimit > 0 )
+        bmcg_sat_solver_set_conflict_budget( s, 0 );
+    ABC_FREE( pOrder );
+    return nSat;
+}
+int bmcg_sat_solver_kept_levels( bmcg_sat_solver * s )
+{
+#ifdef USE_SIMP_SOLVER
+    return (int)((Gluco::SimpSolver *)s)->nbKeptLevels;
+#else
+    return (int)((Gluco::Solver *)s)->nbKeptLevels;
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    []
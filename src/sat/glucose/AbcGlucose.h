@@ -76,6 +76,8 @@ extern void              bmcg_sat_solver_reset( bmcg_sat_solver* s );
 extern int               bmcg_sat_solver_addclause( bmcg_sat_solver* s, int * plits, int nlits );
 extern void              bmcg_sat_solver_setcallback( bmcg_sat_solver* s, void * pman, int(*pfunc)(void*, int, int*) );
 extern int               bmcg_sat_solver_solve( bmcg_sat_solver* s, int * plits, int nlits );
+extern int               bmcg_sat_solver_solve_batch( bmcg_sat_solver * s, Vec_Wec_t * vAssumps, Vec_Int_t * vStatus, Vec_Int_t * vVars, Vec_Int_t * vValues, int nConfLimit );
+extern int               bmcg_sat_solver_kept_levels( bmcg_sat_solver * s );
 extern int               bmcg_sat_solver_final( bmcg_sat_solver* s, int ** ppArray );
 extern int               bmcg_sat_solver_addvar( bmcg_sat_solver* s );
 extern void              bmcg_sat_solver_set_nvars( bmcg_sat_solver* s, int nvars );
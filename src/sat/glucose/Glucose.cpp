@@ -97,6 +97,8 @@ Solver::Solver() :
     , terminate_search_early(false)
     , pstop(NULL)
     , nRuntimeLimit(0)
+    , keep_assumps(false)
+    , nbKeptLevels(0)
 
     , verbosity      (0)
     , verbEveryConflicts(10000)
@@ -1112,7 +1114,7 @@ lbool Solver::search(int nof_conflicts)
             lbdQueue.fastclear();
             progress_estimate = progressEstimate();
             int bt = 0;
-            if(incremental) { // DO NOT BACKTRACK UNTIL 0.. USELESS
+            if(incremental || keep_assumps) { // DO NOT BACKTRACK UNTIL 0.. USELESS
               bt = (decisionLevel()<assumptions.size()) ? decisionLevel() : assumptions.size();
             }
             cancelUntil(bt);
@@ -1215,7 +1217,15 @@ lbool Solver::solve_()
   }
     model.clear();
     conflict.clear();
-    if (!ok) return l_False;
+    if (!ok) { cancelUntil(0); return l_False; }
+    // reuse the decision levels of the assumptions shared with the previous call
+    if (decisionLevel() > 0){
+        int level = 0;
+        while (level < decisionLevel() && level < assumptions.size() && assumptions[level] == kept_assumps[level])
+            level++;
+        cancelUntil(level);
+        nbKeptLevels += level;
+    }
     double curTime = cpuTime();
 
     
@@ -1271,7 +1281,12 @@ printf("c ==================================[ Search Statistics (every %6d confl
     }else if (status == l_False && conflict.size() == 0)
         ok = false;
 
-    cancelUntil(0);
+    if (keep_assumps && ok){
+        // the levels above the assumptions are always undone
+        cancelUntil(decisionLevel() < assumptions.size() ? decisionLevel() : assumptions.size());
+        assumptions.copyTo(kept_assumps);
+    }else
+        cancelUntil(0);
 
     double finalTime = cpuTime();
     if(status==l_True) {
@@ -61,6 +61,9 @@ public:
     bool terminate_search_early;         // used to stop the solver early if it as instructed by an external caller
     int * pstop;                         // another callback
     uint64_t nRuntimeLimit;              // runtime limit
+    bool keep_assumps;                   // keep the decision levels of the assumptions after solving
+    vec<Lit> kept_assumps;               // the assumptions whose decision levels are kept
+    int64_t nbKeptLevels;                // the number of assumption levels reused by the following calls
     vec<int> user_vec;
     vec<Lit> user_lits;
 
@@ -87,6 +90,7 @@ public:
     bool    solve        (Lit p, Lit q);            // Search for a model that respects two assumptions.
     bool    solve        (Lit p, Lit q, Lit r);     // Search for a model that respects three assumptions.
     bool    okay         () const;                  // FALSE means solver is in a conflicting state
+    void    keepAssumptions (bool keep);            // Keep the assumption levels between the calls (no clauses can be added while kept).
 
     void    toDimacs     (FILE* f, const vec<Lit>& assumps);            // Write CNF to file in DIMACS-format.
     void    toDimacs     (const char *file, const vec<Lit>& assumps);
@@ -447,6 +451,7 @@ inline bool     Solver::solve         (Lit p, Lit q, Lit r) { budgetOff(); assum
 inline bool     Solver::solve         (const vec<Lit>& assumps){ budgetOff(); assumps.copyTo(assumptions); return solve_() == l_True; }
 inline lbool    Solver::solveLimited  (const vec<Lit>& assumps){ assumps.copyTo(assumptions); return solve_(); }
 inline bool     Solver::okay          ()      const   { return ok; }
+inline void     Solver::keepAssumptions (bool keep)   { keep_assumps = keep; if (!keep) cancelUntil(0); }
 
 inline void     Solver::toDimacs      (const char* file){ vec<Lit> as; toDimacs(file, as); }
 inline void     Solver::toDimacs      (const char* file, Lit p){ vec<Lit> as; as.push(p); toDimacs(file, as); }
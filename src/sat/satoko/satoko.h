@@ -65,6 +65,8 @@ struct satoko_opts {
     unsigned clause_max_sz_bin_resol;
     unsigned clause_min_lbd_bin_resol;
     float garbage_max_ratio;
+    /* Seed used to perturb the initial variable order (0 = no perturbation) */
+    unsigned seed;
     char verbose;
     char no_simplify;
 };
@@ -83,6 +85,10 @@ struct satoko_stats {
 
     long n_original_lits;
     long n_learnt_lits;
+
+    /* Portfolio mode */
+    long n_shared_out;
+    long n_shared_in;
 };
 
 
@@ -101,6 +107,10 @@ extern void satoko_assump_push(satoko_t *s, int);
 extern void satoko_assump_pop(satoko_t *s);
 extern int  satoko_simplify(satoko_t *);
 extern int  satoko_solve(satoko_t *);
+/* Solves the problem with a portfolio of diversified solvers running in
+ * separate threads, which exchange short learnt clauses and units. The first
+ * solver is the given one. The solvers stop as soon as one of them is done. */
+extern int  satoko_solve_parallel(satoko_t *, int);
 extern int  satoko_solve_assumptions(satoko_t *s, int * plits, int nlits);
 extern int  satoko_solve_assumptions_limit(satoko_t *s, int * plits, int nlits, int nconflim);
 extern int  satoko_minimize_assumptions(satoko_t *s, int * plits, int nlits, int nconflim);
@@ -347,6 +347,8 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
 
     vec_uint_clear(s->temp_lits);
     solver_analyze(s, confl_cref, s->temp_lits, &bt_level, &lbd);
+    if (s->share)
+        solver_share_export(s, s->temp_lits, lbd);
     s->sum_lbd += lbd;
     b_queue_push(s->bq_lbd, lbd);
     solver_cancel_until(s, bt_level);
@@ -34,6 +34,22 @@ ABC_NAMESPACE_HEADER_START
 
 #define UNDEF 0xFFFFFFFF
 
+/* Clause exchange among the solvers of a portfolio (see solver_par.c).
+ * Each solver owns one ring buffer, where it appends its short learnt clauses
+ * stored as [size, lit_0, ..., lit_size-1], and reads the buffers of the other
+ * solvers without locking. */
+struct share_buf {
+    unsigned *data;
+    volatile word head; /* Number of words written by the owner */
+    word pad[6];        /* Keeps the heads in different cache lines */
+};
+
+struct share {
+    struct share_buf *bufs;
+    unsigned n_solvers;
+    volatile int stop;  /* Set when one of the solvers is done */
+};
+
 typedef struct solver_t_ solver_t;
 struct solver_t_ {
     int status;
@@ -106,6 +122,11 @@ struct solver_t_ {
     int     RunId;           
     int   (*pFuncStop)(int);  
 
+    /* Clause sharing in the portfolio mode */
+    struct share *share;
+    unsigned share_id;  /* Index of the buffer owned by this solver */
+    word *share_pos;    /* Read positions in the buffers of the other solvers */
+
     struct satoko_stats stats;
     struct satoko_opts opts;
 };
@@ -115,6 +136,8 @@ extern unsigned solver_clause_create(solver_t *, vec_uint_t *, unsigned);
 extern char solver_search(solver_t *);
 extern void solver_cancel_until(solver_t *, unsigned);
 extern unsigned solver_propagate(solver_t *);
+extern void solver_share_export(solver_t *, vec_uint_t *, unsigned);
+extern int solver_share_import(solver_t *);
 
 /* Debuging */
 extern void solver_debug_check(solver_t *, int);
@@ -223,7 +246,7 @@ static inline int solver_has_marks(satoko_t *s)
 
 static inline int solver_stop(satoko_t *s)
 {
-    return s->pstop && *s->pstop;
+    return (s->pstop && *s->pstop) || (s->share && s->share->stop);
 }
 
 //===------------------------------------------------------------------------===
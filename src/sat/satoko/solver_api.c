@@ -336,6 +336,9 @@ int satoko_solve(solver_t *s)
             break;
         if (s->pFuncStop && s->pFuncStop(s->RunId))
             break;
+        /* Learn the clauses of the other solvers of the portfolio */
+        if (s->share && status == SATOKO_UNDEC && solver_share_import(s) == SATOKO_ERR)
+            status = SATOKO_UNSAT;
     }
     if (s->opts.verbose)
         print_stats(s);
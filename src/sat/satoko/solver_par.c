@@ -0,0 +1,389 @@
+//===--- solver_par.c -------------------------------------------------------===
+//
+//                     satoko: Satisfiability solver
+//
+// This file is distributed under the BSD 2-Clause License.
+// See LICENSE for details.
+//
+//===------------------------------------------------------------------------===
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#include "solver.h"
+#include "utils/heap.h"
+#include "utils/mem.h"
+#include "utils/sdbl.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+#if defined(__GNUC__)
+#define share_barrier() __sync_synchronize()
+#elif defined(_WIN32)
+#include <windows.h>
+#define share_barrier() MemoryBarrier()
+#endif
+
+#include "misc/util/abc_global.h"
+ABC_NAMESPACE_IMPL_START
+
+/* The number of words in the exchange buffer of one solver */
+#define SHARE_BUF_SIZE (1 << 16)
+#define SHARE_BUF_MASK (SHARE_BUF_SIZE - 1)
+/* Only binary clauses and clauses satisfying both limits are shared */
+#define SHARE_MAX_SIZE 8
+#define SHARE_MAX_LBD 4
+/* A clause starting at 'pos' is intact as long as the owner has not
+ * published more than this many words after 'pos' */
+#define SHARE_BUF_SAFE (SHARE_BUF_SIZE - SHARE_MAX_SIZE - 1)
+#define PAR_THR_MAX 64
+
+//===------------------------------------------------------------------------===
+// Clause exchange
+//===------------------------------------------------------------------------===
+static inline int share_clause_ok(unsigned size, unsigned lbd)
+{
+    return size <= 2 || (size <= SHARE_MAX_SIZE && lbd <= SHARE_MAX_LBD);
+}
+
+/** Appends a learnt clause to the buffer of the solver.
+ *
+ * The buffer is written only by its owner. The literals are written before
+ * the head is advanced, so the readers never see a partially written clause
+ * below the head. Old clauses are overwritten when the buffer wraps around.
+ */
+void solver_share_export(solver_t *s, vec_uint_t *lits, unsigned lbd)
+{
+#ifdef share_barrier
+    struct share_buf *buf = s->share->bufs + s->share_id;
+    unsigned i, size = vec_uint_size(lits);
+    word head = buf->head;
+
+    if (!share_clause_ok(size, lbd))
+        return;
+    for (i = 0; i < size; i++)
+        buf->data[(head + 1 + i) & SHARE_BUF_MASK] = vec_uint_at(lits, i);
+    buf->data[head & SHARE_BUF_MASK] = size;
+    share_barrier();
+    buf->head = head + size + 1;
+    s->stats.n_shared_out++;
+#endif
+}
+
+/** Adds a clause learnt by another solver at decision level 0.
+ *
+ * The literals false at level 0 are dropped. The clause is ignored if it is
+ * satisfied, enqueued if it is a unit, and added as a learnt clause otherwise.
+ * Returns SATOKO_ERR if all literals are false.
+ */
+static int solver_share_add(solver_t *s, vec_uint_t *lits)
+{
+    unsigned i, j = 0, lit, cref;
+
+    assert(solver_dlevel(s) == 0);
+    vec_uint_foreach(lits, lit, i) {
+        if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+            return SATOKO_OK;
+        if (lit_value(s, lit) != SATOKO_LIT_FALSE)
+            vec_uint_assign(lits, j++, lit);
+    }
+    vec_uint_shrink(lits, j);
+    if (j == 0)
+        return SATOKO_ERR;
+    if (j == 1) {
+        solver_enqueue(s, vec_uint_at(lits, 0), UNDEF);
+        return SATOKO_OK;
+    }
+    cref = solver_clause_create(s, lits, 1);
+    clause_watch(s, cref);
+    return SATOKO_OK;
+}
+
+/** Reads the clauses published by the other solvers since the last call.
+ *
+ * Called between restarts, when the solver is at decision level 0. A clause
+ * is copied first and checked afterwards: if its owner has wrapped around and
+ * may have overwritten it while it was copied, the rest of that buffer is
+ * skipped. Returns SATOKO_ERR if the problem is found to be unsatisfiable.
+ */
+int solver_share_import(solver_t *s)
+{
+#ifdef share_barrier
+    struct share *p = s->share;
+    vec_uint_t *lits = s->temp_lits;
+    unsigned i, j, size;
+
+    assert(solver_dlevel(s) == 0);
+    for (i = 0; i < p->n_solvers; i++) {
+        struct share_buf *buf = p->bufs + i;
+        word head, pos = s->share_pos[i];
+
+        if (i == s->share_id)
+            continue;
+        head = buf->head;
+        share_barrier();
+        if (head - pos > SHARE_BUF_SAFE)
+            pos = head;
+        while (pos < head) {
+            size = buf->data[pos & SHARE_BUF_MASK];
+            if (size == 0 || size > SHARE_MAX_SIZE) {
+                pos = head;
+                break;
+            }
+            vec_uint_clear(lits);
+            for (j = 0; j < size; j++)
+                vec_uint_push_back(lits, buf->data[(pos + 1 + j) & SHARE_BUF_MASK]);
+            share_barrier();
+            if (buf->head - pos > SHARE_BUF_SAFE) {
+                pos = buf->head;
+                break;
+            }
+            pos += size + 1;
+            s->stats.n_shared_in++;
+            if (solver_share_add(s, lits) == SATOKO_ERR) {
+                s->share_pos[i] = pos;
+                return SATOKO_ERR;
+            }
+        }
+        s->share_pos[i] = pos;
+    }
+    if (solver_propagate(s) != UNDEF)
+        return SATOKO_ERR;
+#endif
+    return SATOKO_OK;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+//===------------------------------------------------------------------------===
+// Portfolio
+//===------------------------------------------------------------------------===
+struct par_man {
+    struct share share;
+    pthread_mutex_t mutex;
+    int winner;         /* The first solver to finish, or -1 */
+};
+
+struct par_thdata {
+    struct par_man *p;
+    solver_t *s;
+    unsigned id;
+    abctime time_left;  /* The runtime left when the thread starts */
+    int status;
+};
+
+/** Changes the heuristics of the i-th solver of the portfolio.
+ */
+static void par_diversify(satoko_opts_t *opts, unsigned i)
+{
+    static const double var_decay[8] = { 0.95, 0.85, 0.99, 0.90, 0.80, 0.97, 0.92, 0.88 };
+    static const double f_rst[8]     = { 0.80, 0.70, 0.90, 0.75, 0.85, 0.80, 0.60, 0.95 };
+    static const double b_rst[8]     = { 1.40, 1.20, 1.60, 1.40, 1.30, 1.50, 1.40, 1.20 };
+
+    if (i == 0)
+        return;
+    opts->var_decay = var_decay[i % 8];
+    opts->f_rst = f_rst[i % 8];
+    opts->b_rst = b_rst[i % 8];
+    opts->seed = opts->seed + i;
+    opts->verbose = 0;
+}
+
+/** Randomizes the initial variable order and, for odd seeds, inverts the
+ * initial polarity of the variables that are not assumptions.
+ */
+static void par_seed(solver_t *s, unsigned seed)
+{
+    vec_uint_t *vars = vec_uint_alloc(vec_char_size(s->assigns));
+    vec_char_t *fixed = vec_char_init(vec_char_size(s->assigns), 0);
+    act_t *activity = vec_act_data(s->activity);
+    unsigned var, lit, i, rand = seed;
+
+    vec_uint_foreach(s->assumptions, lit, i)
+        vec_char_assign(fixed, lit2var(lit), 1);
+    for (var = 0; var < vec_char_size(s->assigns); var++) {
+        rand = rand * 1103515245 + 12345;
+        activity[var] = double2sdbl(1.0 + (double)(rand >> 8) / (1 << 24));
+        if ((seed & 1) && !vec_char_at(fixed, var))
+            vec_char_assign(s->polarity, var, !vec_char_at(s->polarity, var));
+        if (var_value(s, var) == SATOKO_VAR_UNASSING)
+            vec_uint_push_back(vars, var);
+    }
+    heap_build(s->var_order, vars);
+    vec_char_free(fixed);
+    vec_uint_free(vars);
+}
+
+/** Creates a copy of the problem held by the solver.
+ *
+ * The copy has the level-0 assignments, the original clauses, the short
+ * learnt clauses, the assumptions, the saved polarities, and the cone marks
+ * of the solver, but its own options.
+ */
+static solver_t *par_clone(solver_t *s, satoko_opts_t *opts)
+{
+    solver_t *c = satoko_create();
+    vec_uint_t *lits = vec_uint_alloc(0);
+    unsigned i, j, cref, lit;
+    unsigned n_units = solver_dlevel(s) ? vec_uint_at(s->trail_lim, 0) : vec_uint_size(s->trail);
+
+    satoko_configure(c, opts);
+    satoko_setnvars(c, satoko_varnum(s));
+    for (i = 0; i < n_units; i++) {
+        lit = vec_uint_at(s->trail, i);
+        satoko_add_clause(c, (int *)&lit, 1);
+    }
+    vec_uint_foreach(s->originals, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+        vec_uint_clear(lits);
+        for (j = 0; j < clause->size; j++)
+            vec_uint_push_back(lits, clause->data[j].lit);
+        satoko_add_clause(c, (int *)vec_uint_data(lits), vec_uint_size(lits));
+    }
+    vec_uint_foreach(s->learnts, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+        if (!share_clause_ok(clause->size, clause->lbd))
+            continue;
+        vec_uint_clear(lits);
+        for (j = 0; j < clause->size; j++)
+            vec_uint_push_back(lits, clause->data[j].lit);
+        solver_share_add(c, lits);
+    }
+    vec_uint_free(lits);
+    vec_uint_copy(c->assumptions, s->assumptions);
+    vec_char_copy(c->polarity, s->polarity);
+    if (solver_has_marks(s)) {
+        c->marks = vec_char_alloc(0);
+        vec_char_copy(c->marks, s->marks);
+    }
+    if (opts->seed)
+        par_seed(c, opts->seed);
+    c->pstop = s->pstop;
+    c->pFuncStop = s->pFuncStop;
+    c->RunId = s->RunId;
+    return c;
+}
+
+/** Records the result of one solver and stops the others if it is final.
+ */
+static void par_finish(struct par_man *p, unsigned id, int status)
+{
+    int rc;
+
+    if (status == SATOKO_UNDEC)
+        return;
+    rc = pthread_mutex_lock(&p->mutex);  assert(rc == 0);
+    if (p->winner == -1)
+        p->winner = (int)id;
+    p->share.stop = 1;
+    rc = pthread_mutex_unlock(&p->mutex);  assert(rc == 0);
+}
+
+static void *par_worker_thread(void *arg)
+{
+    struct par_thdata *d = (struct par_thdata *)arg;
+
+    // the runtime is measured separately for each thread
+    if (d->time_left)
+        d->s->nRuntimeLimit = Abc_Clock() + d->time_left;
+    d->status = satoko_solve(d->s);
+    par_finish(d->p, d->id, d->status);
+    pthread_exit(NULL);
+    assert(0);
+    return NULL;
+}
+
+int satoko_solve_parallel(solver_t *s, int n_solvers)
+{
+    struct par_man *p;
+    struct par_thdata *thdata;
+    pthread_t *threads;
+    unsigned i, n;
+    int rc, status;
+    abctime clk = Abc_Clock();
+
+    if (n_solvers <= 1 || s->status == SATOKO_ERR)
+        return satoko_solve(s);
+    n = n_solvers < PAR_THR_MAX ? (unsigned)n_solvers : PAR_THR_MAX;
+    solver_cancel_until(s, 0);
+    p = satoko_calloc(struct par_man, 1);
+    p->share.n_solvers = n;
+    p->share.bufs = satoko_calloc(struct share_buf, n);
+    p->winner = -1;
+    rc = pthread_mutex_init(&p->mutex, NULL);  assert(rc == 0);
+    thdata = satoko_calloc(struct par_thdata, n);
+    threads = satoko_calloc(pthread_t, n);
+    for (i = 0; i < n; i++) {
+        satoko_opts_t opts = s->opts;
+        par_diversify(&opts, i);
+        p->share.bufs[i].data = satoko_calloc(unsigned, SHARE_BUF_SIZE);
+        thdata[i].p = p;
+        thdata[i].s = i ? par_clone(s, &opts) : s;
+        thdata[i].id = i;
+        thdata[i].time_left = s->nRuntimeLimit ? (s->nRuntimeLimit > clk ? s->nRuntimeLimit - clk : 1) : 0;
+        thdata[i].status = SATOKO_UNDEC;
+        thdata[i].s->share = &p->share;
+        thdata[i].s->share_id = i;
+        thdata[i].s->share_pos = satoko_calloc(word, n);
+    }
+    // the given solver runs in the calling thread
+    for (i = 1; i < n; i++) {
+        rc = pthread_create(threads + i, NULL, par_worker_thread, (void *)(thdata + i));  assert(rc == 0);
+    }
+    thdata[0].status = satoko_solve(s);
+    par_finish(p, 0, thdata[0].status);
+    for (i = 1; i < n; i++) {
+        rc = pthread_join(threads[i], NULL);  assert(rc == 0);
+    }
+    // transfer the result of the winner
+    status = p->winner == -1 ? SATOKO_UNDEC : thdata[p->winner].status;
+    if (p->winner > 0) {
+        solver_t *w = thdata[p->winner].s;
+        if (status == SATOKO_SAT)
+            vec_char_copy(s->polarity, w->polarity);
+        else
+            vec_uint_copy(s->final_conflict, w->final_conflict);
+    }
+    if (s->opts.verbose) {
+        for (i = 0; i < n; i++) {
+            satoko_stats_t *stats = satoko_stats(thdata[i].s);
+            printf("Solver %2d : %-6s  Conflicts = %9ld.  Shared out = %7ld.  in = %7ld.\n", i,
+                thdata[i].status == SATOKO_SAT ? "SAT" : thdata[i].status == SATOKO_UNSAT ? "UNSAT" : "UNDEC",
+                stats->n_conflicts, stats->n_shared_out, stats->n_shared_in);
+        }
+        printf("Winner    : %d\n", p->winner);
+    }
+    for (i = 0; i < n; i++) {
+        satoko_free(thdata[i].s->share_pos);
+        thdata[i].s->share = NULL;
+        if (i)
+            satoko_destroy(thdata[i].s);
+        satoko_free(p->share.bufs[i].data);
+    }
+    rc = pthread_mutex_destroy(&p->mutex);  assert(rc == 0);
+    satoko_free(threads);
+    satoko_free(thdata);
+    satoko_free(p->share.bufs);
+    satoko_free(p);
+    return status;
+}
+
+#else // pthreads are not used
+
+int satoko_solve_parallel(solver_t *s, int n_solvers)
+{
+    return satoko_solve(s);
+}
+
+#endif // pthreads are used
+
+ABC_NAMESPACE_IMPL_END